@@ -0,0 +1,513 @@
+// Benchmarks over operand sizes from 1 to 100000 limbs, results as JSON.
+//
+//   ./build.sh bench
+//   ./bench [--max-limbs N] [--min-time SECONDS] [--op NAME]... > run.json
+//   ./bench --compare baseline.json [run.json] [--threshold PERCENT]
+//
+// Compare mode runs the suite when no second file is given, then exits with
+// status 1 if any (op, limbs) pair present in both is slower than the
+// baseline by more than the threshold (default 10%).
+#define _GNU_SOURCE
+#include "bigint.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#define BENCH_MAX_LIMBS 100000
+#define BENCH_REPEATS 3
+#define BENCH_BATCH 8
+
+typedef struct bench_ctx {
+  size_t limbs;
+  bigint a;
+  bigint b;
+  bigint wide;    // twice as long as a, the dividend
+  bigint a_mod;   // a mod m
+  bigint b_mod;   // b mod m
+  bigint product; // a_mod b_mod, the Montgomery reduce input
+  bigint q;
+  bigint r;
+  Montgomery m;
+  bigint batch[BENCH_BATCH];
+  char *hex;
+} bench_ctx;
+
+typedef struct bench_op {
+  const char *name;
+  size_t max_limbs; // quadratic operations stop early
+  BigIntError (*run)(bench_ctx *ctx);
+} bench_op;
+
+static BigIntError op_add(bench_ctx *c) { return bigint_add(&c->a, &c->b, &c->r); }
+static BigIntError op_sub(bench_ctx *c) { return bigint_sub(&c->a, &c->b, &c->r); }
+static BigIntError op_shiftl(bench_ctx *c) {
+  return bigint_bit_shiftl(&c->a, c->limbs * LIMB_SIZE_BITS / 2 + 3, &c->r);
+}
+static BigIntError op_shiftr(bench_ctx *c) {
+  return bigint_bit_shiftr(&c->a, c->limbs * LIMB_SIZE_BITS / 2 + 3, &c->r);
+}
+static BigIntError op_xor(bench_ctx *c) { return bigint_bit_xor(&c->a, &c->b, &c->r); }
+static BigIntError op_and(bench_ctx *c) { return bigint_bit_and(&c->a, &c->b, &c->r); }
+static BigIntError op_mul_classic(bench_ctx *c) {
+  return bigint_mul_classic(&c->a, &c->b, &c->r);
+}
+static BigIntError op_mul_karatsuba(bench_ctx *c) {
+  return bigint_mul_karatsuba(&c->a, &c->b, &c->r);
+}
+static BigIntError op_mul(bench_ctx *c) { return bigint_mul(&c->a, &c->b, &c->r); }
+static BigIntError op_div(bench_ctx *c) {
+  return bigint_div(&c->wide, &c->b, &c->q, &c->r);
+}
+static BigIntError op_montgomery_reduce(bench_ctx *c) {
+  return bigint_montgomery_reduce(&c->m, &c->product, &c->r);
+}
+static BigIntError op_montgomery_mul(bench_ctx *c) {
+  return bigint_montgomery_mul(&c->m, &c->a_mod, &c->b_mod, &c->r);
+}
+// BENCH_BATCH independent products, scalar calls against the lanes engine
+static BigIntError op_montgomery_mul_batch(bench_ctx *c) {
+  BigIntError result = Ok;
+  for (size_t i = 0; result == Ok && i < BENCH_BATCH; i++) {
+    result = bigint_montgomery_mul(&c->m, &c->a_mod, &c->b_mod, &c->batch[i]);
+  }
+  return result;
+}
+static BigIntError op_montgomery_mul_lanes(bench_ctx *c) {
+  const Montgomery *m[BENCH_BATCH];
+  const bigint *a[BENCH_BATCH], *b[BENCH_BATCH];
+  bigint *r[BENCH_BATCH];
+  for (size_t i = 0; i < BENCH_BATCH; i++) {
+    m[i] = &c->m;
+    a[i] = &c->a_mod;
+    b[i] = &c->b_mod;
+    r[i] = &c->batch[i];
+  }
+  return bigint_montgomery_mul_lanes(m, a, b, r, BENCH_BATCH);
+}
+static BigIntError op_get_hex(bench_ctx *c) {
+  char *hex = bigint_get_hex(&c->a, false);
+  free(hex);
+  return hex == NULL ? MemoryError : Ok;
+}
+// bigint_set_hex returns true on success
+static BigIntError op_set_hex(bench_ctx *c) {
+  return bigint_set_hex(c->hex, &c->r) ? Ok : InvalidFormat;
+}
+
+static const bench_op ops[] = {
+    {"add", BENCH_MAX_LIMBS, op_add},
+    {"sub", BENCH_MAX_LIMBS, op_sub},
+    {"shiftl", BENCH_MAX_LIMBS, op_shiftl},
+    {"shiftr", BENCH_MAX_LIMBS, op_shiftr},
+    {"xor", BENCH_MAX_LIMBS, op_xor},
+    {"and", BENCH_MAX_LIMBS, op_and},
+    {"mul_classic", 8192, op_mul_classic},
+    {"mul_karatsuba", BENCH_MAX_LIMBS, op_mul_karatsuba},
+    {"mul", BENCH_MAX_LIMBS, op_mul},
+    {"div", 16384, op_div},
+    {"montgomery_reduce", 8192, op_montgomery_reduce},
+    {"montgomery_mul", 8192, op_montgomery_mul},
+    {"montgomery_mul_batch", 64, op_montgomery_mul_batch},
+    {"montgomery_mul_lanes", 64, op_montgomery_mul_lanes},
+    {"get_hex", BENCH_MAX_LIMBS, op_get_hex},
+    {"set_hex", BENCH_MAX_LIMBS, op_set_hex},
+};
+#define OPS_COUNT (sizeof(ops) / sizeof(ops[0]))
+
+static unsigned long long rng_state = 0x9e3779b97f4a7c15ull;
+
+static Limb random_limb(void) {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 7;
+  rng_state ^= rng_state << 17;
+  return (Limb)rng_state;
+}
+
+// exactly len limbs, the top one has its high bit set if high is true
+static void random_bigint(bigint *x, size_t len, bool high) {
+  bigint_resize(x, len);
+  for (size_t i = 0; i < len; i++) {
+    x->limbs[i] = random_limb();
+  }
+  const Limb top_bit = (Limb)1 << (LIMB_SIZE_BITS - 1);
+  x->limbs[len - 1] = high ? x->limbs[len - 1] | top_bit
+                           : (x->limbs[len - 1] & ~top_bit) | 1;
+  x->len = len;
+  x->negative = false;
+}
+
+static void bench_ctx_init(bench_ctx *c, size_t limbs, bool montgomery) {
+  memset(c, 0, sizeof(*c));
+  c->limbs = limbs;
+  random_bigint(&c->a, limbs, true);
+  random_bigint(&c->b, limbs, false);
+  random_bigint(&c->wide, 2 * limbs, true);
+  c->b.limbs[0] |= 1;
+  c->hex = bigint_get_hex(&c->a, false);
+  if (montgomery) {
+    bigint_montgomery_init(&c->b, &c->m);
+    bigint_div(&c->a, &c->b, &c->q, &c->a_mod);
+    bigint_div(&c->wide, &c->b, &c->q, &c->b_mod);
+    bigint_mul(&c->a_mod, &c->b_mod, &c->product);
+  }
+}
+
+static void bench_ctx_free(bench_ctx *c) {
+  bigint *values[] = {&c->a, &c->b, &c->wide, &c->a_mod, &c->b_mod,
+                      &c->product, &c->q, &c->r, &c->m.rrm};
+  for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+    bigint_free_limbs(values[i]);
+  }
+  for (size_t i = 0; i < BENCH_BATCH; i++) {
+    bigint_free_limbs(&c->batch[i]);
+  }
+  free(c->hex);
+}
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// user space cycle counter, -1 when perf_event_open is not available
+static int cycles_open(void) {
+#ifdef __linux__
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = PERF_COUNT_HW_CPU_CYCLES;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+  return -1;
+#endif
+}
+
+static void cycles_start(int fd) {
+#ifdef __linux__
+  if (fd >= 0) {
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+#else
+  (void)fd;
+#endif
+}
+
+static long long cycles_stop(int fd) {
+#ifdef __linux__
+  long long count;
+  if (fd >= 0) {
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    if (read(fd, &count, sizeof(count)) == sizeof(count)) {
+      return count;
+    }
+  }
+#else
+  (void)fd;
+#endif
+  return -1;
+}
+
+static void run_or_die(const bench_op *op, bench_ctx *c) {
+  const BigIntError result = op->run(c);
+  if (result != Ok) {
+    fprintf(stderr, "%s at %zu limbs: %s\n", op->name, c->limbs,
+            BigIntErrorStrings[result]);
+    exit(EXIT_FAILURE);
+  }
+}
+
+// Doubles the iteration count until a run takes min_time, then keeps the
+// fastest of BENCH_REPEATS runs of that length. Runs over a second are not
+// repeated, the calibration run that reached min_time counts as one.
+static void bench_one(const bench_op *op, bench_ctx *c, double min_time_ns,
+                      int cycles_fd, FILE *out, bool *first) {
+  size_t iterations = 1;
+  double best_ns = -1;
+  long long best_cycles = -1;
+  for (int repeat = 0; repeat < BENCH_REPEATS;) {
+    cycles_start(cycles_fd);
+    const double start = now_ns();
+    for (size_t i = 0; i < iterations; i++) {
+      run_or_die(op, c);
+    }
+    const double elapsed = now_ns() - start;
+    const long long cycles = cycles_stop(cycles_fd);
+    if (best_ns < 0 && elapsed < min_time_ns) {
+      iterations *= 2;
+      continue;
+    }
+    if (best_ns < 0 || elapsed < best_ns) {
+      best_ns = elapsed;
+      best_cycles = cycles;
+    }
+    if (elapsed > 1e9) {
+      break;
+    }
+    repeat++;
+  }
+  const double ns_per_op = best_ns / iterations;
+  fprintf(out, "%s    {\"op\": \"%s\", \"limbs\": %zu, \"iterations\": %zu, "
+               "\"ns_per_op\": %.3f, \"limbs_per_s\": %.1f, \"cycles_per_op\": ",
+          *first ? "" : ",\n", op->name, c->limbs, iterations, ns_per_op,
+          c->limbs / ns_per_op * 1e9);
+  if (best_cycles >= 0) {
+    fprintf(out, "%.1f}", (double)best_cycles / iterations);
+  } else {
+    fprintf(out, "null}");
+  }
+  fflush(out);
+  *first = false;
+}
+
+static bool op_selected(const char *name, const char **selected,
+                        size_t selected_count) {
+  if (selected_count == 0) {
+    return true;
+  }
+  for (size_t i = 0; i < selected_count; i++) {
+    if (strcmp(name, selected[i]) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void run_suite(size_t max_limbs, double min_time_ns,
+                      const char **selected, size_t selected_count,
+                      FILE *out) {
+  const int cycles_fd = cycles_open();
+  bool first = true;
+  fprintf(out, "{\n  \"limb_bits\": %d,\n  \"results\": [\n", LIMB_SIZE_BITS);
+  // powers of two, then the top size itself
+  for (size_t limbs = 1; limbs <= max_limbs;
+       limbs = (limbs * 2 > max_limbs && limbs < max_limbs) ? max_limbs
+                                                            : limbs * 2) {
+    bool montgomery = false;
+    bool any = false;
+    for (size_t i = 0; i < OPS_COUNT; i++) {
+      if (limbs <= ops[i].max_limbs &&
+          op_selected(ops[i].name, selected, selected_count)) {
+        any = true;
+        montgomery |= strncmp(ops[i].name, "montgomery", 10) == 0;
+      }
+    }
+    if (!any) {
+      continue;
+    }
+    bench_ctx c;
+    bench_ctx_init(&c, limbs, montgomery);
+    for (size_t i = 0; i < OPS_COUNT; i++) {
+      if (limbs <= ops[i].max_limbs &&
+          op_selected(ops[i].name, selected, selected_count)) {
+        bench_one(&ops[i], &c, min_time_ns, cycles_fd, out, &first);
+      }
+    }
+    bench_ctx_free(&c);
+    if (limbs == max_limbs) {
+      break;
+    }
+  }
+  fprintf(out, "\n  ]\n}\n");
+#ifdef __linux__
+  if (cycles_fd >= 0) {
+    close(cycles_fd);
+  }
+#endif
+}
+
+typedef struct bench_result {
+  char op[32];
+  size_t limbs;
+  double ns_per_op;
+} bench_result;
+
+// reads the one result per line layout run_suite writes
+static bench_result *read_results(FILE *in, size_t *count) {
+  bench_result *results = NULL;
+  size_t capacity = 0;
+  char line[512];
+  *count = 0;
+  while (fgets(line, sizeof(line), in) != NULL) {
+    bench_result r;
+    const char *start = strstr(line, "{\"op\"");
+    if (start == NULL ||
+        sscanf(start, "{\"op\": \"%31[^\"]\", \"limbs\": %zu, \"iterations\": "
+                      "%*u, \"ns_per_op\": %lf",
+               r.op, &r.limbs, &r.ns_per_op) != 3) {
+      continue;
+    }
+    if (*count == capacity) {
+      capacity = capacity == 0 ? 64 : capacity * 2;
+      bench_result *grown = realloc(results, capacity * sizeof(*results));
+      if (grown == NULL) {
+        free(results);
+        *count = 0;
+        return NULL;
+      }
+      results = grown;
+    }
+    results[(*count)++] = r;
+  }
+  return results;
+}
+
+static bench_result *read_results_file(const char *path, size_t *count) {
+  FILE *in = fopen(path, "r");
+  if (in == NULL) {
+    perror(path);
+    exit(EXIT_FAILURE);
+  }
+  bench_result *results = read_results(in, count);
+  fclose(in);
+  return results;
+}
+
+static bool same_result(const bench_result *a, const bench_result *b) {
+  return a->limbs == b->limbs && strcmp(a->op, b->op) == 0;
+}
+
+// prints every pair present in both and every baseline result the current
+// run should have measured but lacks, returns the number of regressions
+static size_t compare(const bench_result *baseline, size_t baseline_count,
+                      const bench_result *current, size_t current_count,
+                      double threshold, size_t max_limbs,
+                      const char **selected, size_t selected_count,
+                      size_t *matched, size_t *missing) {
+  size_t regressions = 0;
+  *matched = *missing = 0;
+  for (size_t j = 0; j < baseline_count; j++) {
+    if (baseline[j].limbs > max_limbs ||
+        !op_selected(baseline[j].op, selected, selected_count)) {
+      continue;
+    }
+    size_t i = 0;
+    while (i < current_count && !same_result(&current[i], &baseline[j])) {
+      i++;
+    }
+    if (i == current_count) {
+      (*missing)++;
+      fprintf(stderr, "%-18s %7zu limbs %12.1f ns -> missing\n",
+              baseline[j].op, baseline[j].limbs, baseline[j].ns_per_op);
+    }
+  }
+  for (size_t i = 0; i < current_count; i++) {
+    for (size_t j = 0; j < baseline_count; j++) {
+      if (!same_result(&current[i], &baseline[j])) {
+        continue;
+      }
+      (*matched)++;
+      const double change =
+          (current[i].ns_per_op / baseline[j].ns_per_op - 1) * 100;
+      const bool regressed = change > threshold;
+      regressions += regressed;
+      fprintf(stderr, "%-18s %7zu limbs %12.1f ns -> %12.1f ns %+7.1f%%%s\n",
+              current[i].op, current[i].limbs, baseline[j].ns_per_op,
+              current[i].ns_per_op, change, regressed ? "  REGRESSION" : "");
+      break;
+    }
+  }
+  return regressions;
+}
+
+static void usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s [--max-limbs N] [--min-time SECONDS] [--op NAME]...\n"
+          "       %s --compare BASELINE [CURRENT] [--threshold PERCENT]\n",
+          program, program);
+  exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+  size_t max_limbs = BENCH_MAX_LIMBS;
+  double min_time = 0.05;
+  double threshold = 10;
+  const char *baseline_path = NULL;
+  const char *current_path = NULL;
+  const char **selected = calloc(argc, sizeof(*selected));
+  size_t selected_count = 0;
+  if (selected == NULL) {
+    return EXIT_FAILURE;
+  }
+  for (int i = 1; i < argc; i++) {
+    const bool has_value = i + 1 < argc;
+    if (strcmp(argv[i], "--max-limbs") == 0 && has_value) {
+      max_limbs = strtoul(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--min-time") == 0 && has_value) {
+      min_time = strtod(argv[++i], NULL);
+    } else if (strcmp(argv[i], "--op") == 0 && has_value) {
+      selected[selected_count++] = argv[++i];
+    } else if (strcmp(argv[i], "--threshold") == 0 && has_value) {
+      threshold = strtod(argv[++i], NULL);
+    } else if (strcmp(argv[i], "--compare") == 0 && has_value) {
+      baseline_path = argv[++i];
+      if (i + 1 < argc && strncmp(argv[i + 1], "--", 2) != 0) {
+        current_path = argv[++i];
+      }
+    } else {
+      usage(argv[0]);
+    }
+  }
+  if (max_limbs == 0) {
+    usage(argv[0]);
+  }
+
+  if (baseline_path == NULL) {
+    run_suite(max_limbs, min_time * 1e9, selected, selected_count, stdout);
+    free(selected);
+    return EXIT_SUCCESS;
+  }
+
+  size_t baseline_count, current_count;
+  bench_result *baseline = read_results_file(baseline_path, &baseline_count);
+  bench_result *current;
+  if (current_path != NULL) {
+    current = read_results_file(current_path, &current_count);
+    // two files are compared in full
+    max_limbs = SIZE_MAX;
+    selected_count = 0;
+  } else {
+    FILE *run = tmpfile();
+    if (run == NULL) {
+      perror("tmpfile");
+      return EXIT_FAILURE;
+    }
+    run_suite(max_limbs, min_time * 1e9, selected, selected_count, run);
+    rewind(run);
+    current = read_results(run, &current_count);
+    fclose(run);
+  }
+  if (baseline_count == 0 || current_count == 0) {
+    fprintf(stderr, "no results in %s\n",
+            baseline_count == 0 ? baseline_path
+            : current_path != NULL ? current_path
+                                   : "the current run");
+    free(baseline);
+    free(current);
+    free(selected);
+    return EXIT_FAILURE;
+  }
+  size_t matched, missing;
+  const size_t regressions =
+      compare(baseline, baseline_count, current, current_count, threshold,
+              max_limbs, selected, selected_count, &matched, &missing);
+  fprintf(stderr,
+          "%zu regressions over %.1f%%, %zu results compared, %zu missing\n",
+          regressions, threshold, matched, missing);
+  free(baseline);
+  free(current);
+  free(selected);
+  return regressions == 0 && matched > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,4 +1,6 @@
 #include "bigint.h"
+#include "bigint_comba.h"
+#include "bigint_stats.h"
 #include "utils.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -6,7 +8,9 @@
 #include <limits.h>
 
 const char *BigIntErrorStrings[] = {"Ok", "ResultMemoryTooSmall", "MemoryError",
-                                    "NotImplemented", "DivisionByZeroError"};
+                                    "NotImplemented", "DivisionByZeroError",
+                                    "NotInvertible", "InvalidFormat",
+                                    "IOError"};
 
 bigint *bigint_new_capacity(size_t capacity) {
   capacity = (capacity < MIN_LIMBS) ? MIN_LIMBS : capacity;
@@ -21,11 +25,20 @@ bigint *bigint_new_capacity(size_t capacity) {
   }
   bigint->capacity = capacity;
   bigint->len = 0;
+  bigint->negative = false;
+  STATS_ADD(allocations, 2);
+  STATS_ADD(bytes, sizeof(*bigint) + capacity * LIMB_SIZE_BYTES);
   return bigint;
 }
 
 BigIntError bigint_resize(bigint *a, size_t len) {
   if (a->capacity < len) {
+    if (a->limbs == NULL) {
+      STATS_ADD(allocations, 1);
+    } else {
+      STATS_ADD(reallocs, 1);
+    }
+    STATS_ADD(bytes, LIMB_SIZE_BYTES * len);
     a->limbs = realloc(a->limbs, LIMB_SIZE_BYTES * len);
     if (a->limbs == NULL) {
       return MemoryError;
@@ -39,7 +52,12 @@ BigIntError bigint_resize(bigint *a, size_t len) {
   return Ok;
 }
 
+// capacity 0 marks views into memory the bigint does not own (fixed-base
+// table entries, mapped files), those are left alone
 void bigint_free_limbs(bigint *bigint) {
+  if (bigint->capacity == 0) {
+    return;
+  }
   free(bigint->limbs);
   bigint->capacity = 0;
 }
@@ -53,9 +71,12 @@ size_t calc_needed_limbs_for_hex(size_t hex_len) {
 }
 
 BigIntError bigint_set_hex(const char *hex, bigint *result) {
+  const bool negative = hex[0] == '-';
+  hex += negative;
   const size_t hex_len = strlen(hex);
   const size_t needed_limbs = calc_needed_limbs_for_hex(hex_len);
 
+  result->len = 0;
   bigint_resize(result, needed_limbs);
 
   size_t current_limb = 0;
@@ -86,35 +107,37 @@ BigIntError bigint_set_hex(const char *hex, bigint *result) {
   if (nibble_count > 0) {
     result->limbs[current_limb] = limb;
   }
+  bigint_fit(result);
+  result->negative = negative && result->len > 0;
   return true;
 }
 
 BigIntError bigint_set_from_limb(Limb from, bigint *result) {
-  bigint_resize(result, MIN_LIMBS);
+  result->len = 0;
+  bigint_resize(result, 1);
   result->limbs[0] = from;
-  result->len = 1;
+  bigint_fit(result);
   return Ok;
 }
 
 BigIntError bigint_get_to_limb(bigint *input, Limb* result) {
-  if (input->len != 1) {
+  if (input->len > 1) {
     return NotImplemented;
   }
-  *result = input->limbs[0];
+  *result = input->len ? input->limbs[0] : 0;
   return Ok;
 }
 
 char *bigint_get_hex(const bigint *bigint, bool upper) {
-  if (bigint->len == 0) {
-    return "0";
-  }
   const char *OUT_HEX = upper ? "0123456789ABCDEF" : "0123456789abcdef";
-  const size_t hex_len = bigint->len * LIMB_SIZE_BYTES * 2 + 1;
+  const size_t hex_len =
+      (bigint->len ? bigint->len : 1) * LIMB_SIZE_BYTES * 2 + 1;
 
-  char *hex = malloc(hex_len);
+  char *hex = malloc(hex_len + bigint->negative);
   if (hex == NULL) {
     return NULL;
   }
+  memset(hex, '0', hex_len - 1);
   hex[hex_len-1] = '\0';
 
   size_t hex_index = 0;
@@ -129,6 +152,10 @@ char *bigint_get_hex(const bigint *bigint, bool upper) {
   }
 
   ltrim(hex);
+  if (bigint->negative) {
+    memmove(hex + 1, hex, strlen(hex) + 1);
+    hex[0] = '-';
+  }
   return hex;
 }
 
@@ -137,6 +164,7 @@ BigIntError bigint_bit_not(const bigint *a, bigint *result) {
   for (size_t i = 0; i < a->len; i++) {
     result->limbs[i] = ~(a->limbs[i]);
   }
+  bigint_fit(result);
   return Ok;
 }
 
@@ -156,51 +184,68 @@ BigIntError bigint_bit_and(const bigint *first, const bigint *second,
 }
 
 BigIntError bigint_bit_shiftl(const bigint *a, size_t n, bigint *result) {
-  size_t limb_shifts = n / LIMB_SIZE_BITS;
-  size_t bit_shifts = n % LIMB_SIZE_BITS;
-  
-  size_t offset = (n + LIMB_SIZE_BITS - 1) / LIMB_SIZE_BITS;
-  
-  bigint_resize(result, a->len + offset);
-  
-  if(n % CHAR_BIT == 0) {
-    memcpy((uint8_t*) result->limbs + n / CHAR_BIT, a->limbs, a->len * sizeof(Limb));
+  const size_t limb_shifts = n / LIMB_SIZE_BITS;
+  const size_t bit_shifts = n % LIMB_SIZE_BITS;
+  const size_t len_a = a->len;
+
+  if (len_a == 0) {
+    result->len = 0;
+    result->negative = false;
+    return Ok;
+  }
+
+  BigIntError resize_result = bigint_resize(result, len_a + limb_shifts + 1);
+  if (resize_result != Ok) {
+    return resize_result;
+  }
+
+  // top-down so that result may alias a
+  if (bit_shifts == 0) {
+    memmove(result->limbs + limb_shifts, a->limbs, len_a * LIMB_SIZE_BYTES);
+    result->limbs[len_a + limb_shifts] = 0;
   } else {
-    for (size_t i = 0; i < a->len; i++) {
-      result->limbs[i + limb_shifts] = 0;
-      result->limbs[i + limb_shifts] |= a->limbs[i] << bit_shifts;
-      if(i > 0) {
-        result->limbs[i + limb_shifts] |= a->limbs[i - 1] >> (LIMB_SIZE_BITS - bit_shifts);
-    }
+    result->limbs[len_a + limb_shifts] =
+        a->limbs[len_a - 1] >> (LIMB_SIZE_BITS - bit_shifts);
+    for (size_t i = len_a - 1; i > 0; i--) {
+      result->limbs[i + limb_shifts] =
+          (a->limbs[i] << bit_shifts) |
+          (a->limbs[i - 1] >> (LIMB_SIZE_BITS - bit_shifts));
     }
-    result->limbs[a->len + limb_shifts] = a->limbs[a->len - 1] >> (LIMB_SIZE_BITS - bit_shifts);
+    result->limbs[limb_shifts] = a->limbs[0] << bit_shifts;
   }
-  
+  memset(result->limbs, 0, limb_shifts * LIMB_SIZE_BYTES);
+
+  bigint_fit(result);
   return Ok;
 }
 
-
 BigIntError bigint_bit_shiftr(const bigint *a, size_t n, bigint *result) {
-  size_t limb_shifts = n / LIMB_SIZE_BITS;
-  size_t bit_shifts = n % LIMB_SIZE_BITS;
+  const size_t limb_shifts = n / LIMB_SIZE_BITS;
+  const size_t bit_shifts = n % LIMB_SIZE_BITS;
+  const size_t len_a = a->len;
 
-  if (limb_shifts >= a->len) {
-    bigint_free_limbs(result);
-    *result = BIGINT_ZERO;
+  if (limb_shifts >= len_a) {
+    result->len = 0;
+    result->negative = false;
     return Ok;
   }
 
-  size_t new_len = a->len - limb_shifts;
-  bigint_resize(result, new_len);
+  const size_t new_len = len_a - limb_shifts;
+  BigIntError resize_result = bigint_resize(result, new_len);
+  if (resize_result != Ok) {
+    return resize_result;
+  }
 
-  Limb carry = 0;
-  for (size_t i = new_len - 1; i + 1 > 0; i--) {
-    Limb shifted = (a->limbs[i + limb_shifts] >> bit_shifts) | carry;
-    carry = (a->limbs[i + limb_shifts] << (LIMB_SIZE_BITS - bit_shifts));
-    if (bit_shifts == 0)
-      carry = 0;
+  // bottom-up so that result may alias a
+  for (size_t i = 0; i < new_len; i++) {
+    Limb shifted = a->limbs[i + limb_shifts] >> bit_shifts;
+    if (bit_shifts != 0 && i + 1 < new_len) {
+      shifted |= a->limbs[i + limb_shifts + 1] << (LIMB_SIZE_BITS - bit_shifts);
+    }
     result->limbs[i] = shifted;
   }
+
+  bigint_fit(result);
   return Ok;
 }
 
@@ -225,88 +270,87 @@ BigIntError bigint_add(const bigint *a, const bigint *b, bigint *result) {
     bigint_resize(result, result->len + 1);
     result->limbs[max_len] = carry;
   }
+  bigint_fit(result);
   return Ok;
 }
 
-bool bigint_greater_than(const bigint *a, const bigint *b) {
-  if (bigint_equal(a, b)) {
-    return false;
+int bigint_cmp(const bigint *a, const bigint *b) {
+  if (a->len != b->len) {
+    return a->len > b->len ? 1 : -1;
   }
-
-  const size_t min_len = (a->len > b->len) ? b->len : a->len;
-
-  if (a->len > b->len) {
-    for (size_t i = min_len; i < a->len; i++) {
-      if (a->limbs[i]) {
-        return true;
-      }
-    }
-  } else if (b->len > a->len) {
-    for (size_t i = min_len; i < b->len; i++) {
-      if (b->limbs[i]) {
-        return false;
-      }
-    }
-  }
-
-  for (int i = min_len - 1; i >= 0; i--) {
-    if (a->limbs[i] > b->limbs[i]) {
-      return true;
-    }
-    if (a->limbs[i] < b->limbs[i]) {
-      return false;
+  for (size_t i = a->len - 1; i + 1 > 0; i--) {
+    if (a->limbs[i] != b->limbs[i]) {
+      return a->limbs[i] > b->limbs[i] ? 1 : -1;
     }
   }
+  return 0;
+}
 
-  return false;
+bool bigint_greater_than(const bigint *a, const bigint *b) {
+  return bigint_cmp(a, b) > 0;
 }
 
 bool bigint_less_than(const bigint *a, const bigint *b) {
-  return bigint_greater_than(b, a);
+  return bigint_cmp(a, b) < 0;
 }
 
 bool bigint_equal(const bigint *a, const bigint *b) {
-  const size_t min_len = (a->len > b->len) ? b->len : a->len;
-  size_t x = 0;
-  for (size_t i = 0; i < min_len; i++) {
-    x |= a->limbs[i] ^ b->limbs[i];
-  }
-  return x == 0;
+  return a->len == b->len &&
+         (a->len == 0 ||
+          memcmp(a->limbs, b->limbs, a->len * LIMB_SIZE_BYTES) == 0);
 }
 
-BigIntError bigint_sub(const bigint *a, const bigint *b, bigint *result) {
-
-  if (bigint_less_than(a, b)) {
-    return NotImplemented;
+// Subtracts magnitudes. Returns true when |a| < |b|, result then holds
+// |b| - |a|. With normalized lengths only an equal-length subtraction can
+// borrow, so the sign comes from the final borrow instead of a compare.
+static bool bigint_sub_magnitude(const bigint *a, const bigint *b,
+                                 bigint *result) {
+  bool negative = false;
+  if (a->len < b->len) {
+    const bigint *t = a;
+    a = b;
+    b = t;
+    negative = true;
   }
 
-  const size_t len = a->len;
+  const size_t len_a = a->len;
+  const size_t len_b = b->len;
 
-  bigint_resize(result, len);
+  bigint_resize(result, len_a);
 
-  Limb carry = 0;
-  for (size_t i = 0; i < len; i++) {
-    Limb a_ = (i < a->len) ? a->limbs[i] : 0;
-    Limb b_ = (i < b->len) ? b->limbs[i] : 0;
+  Limb borrow = 0;
+  for (size_t i = 0; i < len_a; i++) {
+    Limb a_ = a->limbs[i];
+    Limb b_ = (i < len_b) ? b->limbs[i] : 0;
     Limb difference = a_ - b_;
-    Limb res = difference - carry;
-    carry = (difference > a->limbs[i]) | (res > difference);
+    Limb res = difference - borrow;
+    borrow = (a_ < b_) | (difference < borrow);
     result->limbs[i] = res;
   }
-  // carry == 0
 
-  result->len = len;
+  if (borrow) {
+    Limb carry = 1;
+    for (size_t i = 0; i < len_a; i++) {
+      result->limbs[i] = ~result->limbs[i] + carry;
+      carry = carry && result->limbs[i] == 0;
+    }
+    negative = !negative;
+  }
+
+  result->len = len_a;
+  bigint_fit(result);
+  return negative;
+}
 
+BigIntError bigint_sub(const bigint *a, const bigint *b, bigint *result) {
+  if (bigint_sub_magnitude(a, b, result)) {
+    return NotImplemented;
+  }
   return Ok;
 }
 
 static bool bigint_is_zero(const bigint *bi) {
-  for (size_t i = 0; i < bi->len; i++) {
-    if (bi->limbs[i]) {
-      return false;
-    }
-  }
-  return true;
+  return bi->len == 0;
 }
 
 BigIntError bigint_copy(const bigint *src, bigint *dst) {
@@ -315,23 +359,57 @@ BigIntError bigint_copy(const bigint *src, bigint *dst) {
     return resize_result;
   }
   memcpy(dst->limbs, src->limbs, src->len * LIMB_SIZE_BYTES);
+  dst->negative = src->negative;
   return Ok;
 }
 
-static void bigint_fit(bigint *bi) {
-  while (bi->limbs[bi->len - 1] == 0) {
+void bigint_fit(bigint *bi) {
+  while (bi->len > 0 && bi->limbs[bi->len - 1] == 0) {
     bi->len--;
   }
+  bi->negative = false;
 }
 
-BigIntError bigint_div(const bigint *A, const bigint *B, bigint *q, bigint *r) {
+BigIntError bigint_divrem_limb(const bigint *a, Limb d, bigint *q, Limb *r) {
+  if (d == 0) {
+    return DivisionByZeroError;
+  }
+  const size_t len = a->len;
+  STATS_START(timer, StatsDivLimb, len);
+  if (q != NULL) {
+    bigint_resize(q, len);
+  }
+
+  DoubleLimb partial = 0;
+  for (size_t i = len - 1; i + 1 > 0; i--) {
+    partial = (partial << LIMB_SIZE_BITS) | a->limbs[i];
+    if (q != NULL) {
+      q->limbs[i] = partial / d;
+    }
+    partial %= d;
+  }
+
+  if (q != NULL) {
+    bigint_fit(q);
+  }
+  if (r != NULL) {
+    *r = partial;
+  }
+  STATS_STOP(timer);
+  return Ok;
+}
+
+static BigIntError bigint_div_internal(const bigint *A, const bigint *B,
+                                       bigint *q, bigint *r) {
   if (bigint_is_zero(B)) {
     return DivisionByZeroError;
   }
 
   if (bigint_less_than(A, B)) {
-    *q = BIGINT_ZERO;
+    q->len = 0;
+    bigint_fit(q);
     bigint_copy(A, r);
+    bigint_fit(r);
     return Ok;
   }
 
@@ -341,27 +419,20 @@ BigIntError bigint_div(const bigint *A, const bigint *B, bigint *q, bigint *r) {
   bigint_copy(A, &a);
   bigint_copy(B, &b);
 
-  bigint_fit(&a);
-  bigint_fit(&b);
-
   if (b.len < 2) {
-    DoubleLimb partial = 0;
-
-    bigint_resize(q, a.len);
-    for (intmax_t i = a.len - 1; i >= 0; i--) {
-      partial = (partial << LIMB_SIZE_BITS) + a.limbs[i];
-      q->limbs[i] = partial / b.limbs[0];
-      partial %= b.limbs[0];
-    }
-
-    bigint_resize(r, 1);
-    r->limbs[0] = partial;
+    Limb remainder;
+    bigint_divrem_limb(&a, b.limbs[0], q, &remainder);
+    bigint_set_from_limb(remainder, r);
 
+    bigint_free_limbs(&a);
+    bigint_free_limbs(&b);
     return Ok;
   }
 
+  q->len = 0;
   bigint_resize(q, a.len);
-  bigint_resize(r, a.len);
+  r->len = 0;
+  bigint_resize(r, b.len);
 
   intmax_t shifts = 0;
 
@@ -402,12 +473,14 @@ BigIntError bigint_div(const bigint *A, const bigint *B, bigint *q, bigint *r) {
     if (qhat == uno) {
       qhat -= 1;
       rhat += b.limbs[b.len - 1];
+      STATS_ADD(div_corrections, 1);
     }
 
     while (rhat < uno &&
            (qhat * b.limbs[b.len - 2] > uno * rhat + a.limbs[k + b.len - 2])) {
       qhat -= 1;
       rhat += b.limbs[b.len - 1];
+      STATS_ADD(div_corrections, 1);
     }
 
     __int128_t carry = 0;
@@ -428,14 +501,15 @@ BigIntError bigint_div(const bigint *A, const bigint *B, bigint *q, bigint *r) {
     q->limbs[k] = qhat;
 
     if (widedigit < 0) {
+      STATS_ADD(div_corrections, 1);
       q->limbs[k] -= 1;
       widedigit = 0;
       for (uintmax_t i = 0; i < b.len; i++) {
-        widedigit += a.limbs[k + i] + b.limbs[i];
+        widedigit += (DoubleLimb)a.limbs[k + i] + b.limbs[i];
         a.limbs[k + i] = widedigit;
         widedigit >>= LIMB_SIZE_BITS;
       }
-      a.limbs[k + b.len] += carry;
+      a.limbs[k + b.len] += widedigit;
     }
   }
 
@@ -445,12 +519,102 @@ BigIntError bigint_div(const bigint *A, const bigint *B, bigint *q, bigint *r) {
   }
   r->limbs[b.len - 1] = a.limbs[b.len - 1] >> shifts;
 
+  bigint_fit(q);
+  bigint_fit(r);
+
   bigint_free_limbs(&a);
   bigint_free_limbs(&b);
 
   return Ok;
 }
 
+BigIntError bigint_div(const bigint *A, const bigint *B, bigint *q, bigint *r) {
+  STATS_START(timer, StatsDiv, A->len);
+  const BigIntError result = bigint_div_internal(A, B, q, r);
+  STATS_STOP(timer);
+  return result;
+}
+
+static void bigint_set_sign(bigint *bi, bool negative) {
+  bi->negative = negative && bi->len > 0;
+}
+
+static BigIntError bigint_add_signed(const bigint *a, bool a_negative,
+                                     const bigint *b, bool b_negative,
+                                     bigint *result) {
+  if (a_negative == b_negative) {
+    BigIntError add_result = bigint_add(a, b, result);
+    bigint_set_sign(result, a_negative);
+    return add_result;
+  }
+  bool borrowed = bigint_sub_magnitude(a, b, result);
+  bigint_set_sign(result, a_negative != borrowed);
+  return Ok;
+}
+
+BigIntError bigint_neg(const bigint *a, bigint *result) {
+  const bool negative = !a->negative;
+  BigIntError copy_result = bigint_copy(a, result);
+  bigint_set_sign(result, negative);
+  return copy_result;
+}
+
+BigIntError bigint_sadd(const bigint *a, const bigint *b, bigint *result) {
+  return bigint_add_signed(a, a->negative, b, b->negative, result);
+}
+
+BigIntError bigint_ssub(const bigint *a, const bigint *b, bigint *result) {
+  return bigint_add_signed(a, a->negative, b, !b->negative, result);
+}
+
+BigIntError bigint_smul(const bigint *a, const bigint *b, bigint *result) {
+  const bool negative = a->negative != b->negative;
+  BigIntError mul_result = bigint_mul(a, b, result);
+  bigint_set_sign(result, negative);
+  return mul_result;
+}
+
+BigIntError bigint_sdiv(const bigint *a, const bigint *b, bigint *q, bigint *r,
+                        BigIntRounding rounding) {
+  const bool a_negative = a->negative;
+  const bool b_negative = b->negative;
+
+  bigint b_copy = BIGINT_ZERO;
+  const bigint *divisor = b;
+  if (rounding == RoundFloor && (b == q || b == r)) {
+    bigint_copy(b, &b_copy);
+    divisor = &b_copy;
+  }
+
+  BigIntError div_result = bigint_div(a, b, q, r);
+  if (div_result != Ok) {
+    bigint_free_limbs(&b_copy);
+    return div_result;
+  }
+
+  if (rounding == RoundFloor && a_negative != b_negative && r->len > 0) {
+    Limb one_limb = 1;
+    bigint one = {&one_limb, 1, 1, false};
+    bigint_add(q, &one, q);
+    bigint_sub(divisor, r, r);
+    bigint_set_sign(r, b_negative);
+  } else {
+    bigint_set_sign(r, a_negative);
+  }
+  bigint_set_sign(q, a_negative != b_negative);
+
+  bigint_free_limbs(&b_copy);
+  return Ok;
+}
+
+int bigint_scmp(const bigint *a, const bigint *b) {
+  if (a->negative != b->negative) {
+    return a->negative ? -1 : 1;
+  }
+  const int cmp = bigint_cmp(a, b);
+  return a->negative ? -cmp : cmp;
+}
+
 size_t bigint_bit_length(const bigint *a) {
   for (size_t i = a->len - 1; i + 1 > 0; i--) {
     if (a->limbs[i] != 0) {
@@ -479,27 +643,98 @@ BigIntError bigint_montgomery_init(const bigint *modulus, Montgomery *m) {
 
   bigint q = BIGINT_ZERO;
   bigint_div(&dividend, modulus, &q, &m->rrm);
+  bigint_free_limbs(&dividend);
+  bigint_free_limbs(&q);
+
+  // Newton's iteration doubles the correct low bits of m^-1 mod 2^LIMB_SIZE_BITS
+  Limb inverse = modulus->limbs[0];
+  for (size_t bits = 3; bits < LIMB_SIZE_BITS; bits *= 2) {
+    inverse *= 2 - modulus->limbs[0] * inverse;
+  }
+  m->minv = -inverse;
   return Ok;
 }
 
+// R = 2^n, but the word-level reduction divides by 2^(LIMB_SIZE_BITS k) for a
+// k limb modulus, so inputs are shifted up by the difference first.
+static size_t montgomery_shift(const Montgomery *m) {
+  return m->modulus.len * LIMB_SIZE_BITS - m->n;
+}
+
 BigIntError bigint_montgomery_reduce(const Montgomery *m, const bigint* a, bigint* result) {
-  bigint_copy(a, result);
-  for (size_t i = 0; i < m->n; i++) {
-    if ((result->limbs[0] & 1) == 1) {
-      bigint_add(result, &m->modulus, result);
+  const size_t k = m->modulus.len;
+  const Limb *modulus = m->modulus.limbs;
+  STATS_START(timer, StatsMontgomeryReduce, a->len);
+  bigint t = BIGINT_ZERO;
+  bigint_bit_shiftl(a, montgomery_shift(m), &t);
+  const size_t len = (t.len > 2 * k ? t.len : 2 * k) + 1;
+  BigIntError resize_result = bigint_resize(&t, len);
+  if (resize_result != Ok) {
+    bigint_free_limbs(&t);
+    STATS_STOP(timer);
+    return resize_result;
+  }
+
+  for (size_t i = 0; i < k; i++) {
+    const Limb q = t.limbs[i] * m->minv;
+    DoubleLimb carry = 0;
+    for (size_t j = 0; j < k; j++) {
+      carry += (DoubleLimb)q * modulus[j] + t.limbs[i + j];
+      t.limbs[i + j] = (Limb)carry;
+      carry >>= LIMB_SIZE_BITS;
+    }
+    for (size_t j = i + k; carry != 0; j++) {
+      carry += t.limbs[j];
+      t.limbs[j] = (Limb)carry;
+      carry >>= LIMB_SIZE_BITS;
     }
-    bigint_bit_shiftr(result, 1, result);
   }
+  bigint_bit_shiftr(&t, k * LIMB_SIZE_BITS, result);
+  bigint_free_limbs(&t);
 
-  if (bigint_equal(result, &m->modulus) || bigint_greater_than(result, &m->modulus)) {
+  if (bigint_cmp(result, &m->modulus) >= 0) {
     bigint_sub(result, &m->modulus, result);
   }
+  if (bigint_cmp(result, &m->modulus) >= 0) {
+    // only for inputs past m R
+    bigint q = BIGINT_ZERO;
+    bigint_div(result, &m->modulus, &q, result);
+    bigint_free_limbs(&q);
+  }
+  STATS_STOP(timer);
   return Ok;
 }
 
-
 BigIntError bigint_montgomery_mul(const Montgomery *m, const bigint* r1, const bigint* r2, bigint* result) {
-  bigint_mul(r1, r2, result);
-  bigint_montgomery_reduce(m, result, result);
-  return Ok;
+  const size_t k = m->modulus.len;
+  STATS_START(timer, StatsMontgomeryMul, k);
+  if (k > COMBA_MAX_LIMBS || !bigint_less_than(r1, &m->modulus) ||
+      !bigint_less_than(r2, &m->modulus)) {
+    bigint_mul(r1, r2, result);
+    const BigIntError reduce_result =
+        bigint_montgomery_reduce(m, result, result);
+    STATS_STOP(timer);
+    return reduce_result;
+  }
+
+  Limb a[COMBA_MAX_LIMBS] = {0}, b[COMBA_MAX_LIMBS] = {0};
+  Limb r[COMBA_MAX_LIMBS];
+  const size_t shift = montgomery_shift(m);
+  for (size_t i = 0; i < r1->len; i++) {
+    a[i] |= r1->limbs[i] << shift;
+    if (shift != 0 && i + 1 < k) {
+      a[i + 1] = r1->limbs[i] >> (LIMB_SIZE_BITS - shift);
+    }
+  }
+  memcpy(b, r2->limbs, r2->len * LIMB_SIZE_BYTES);
+  bigint_comba_mont[k](r, a, b, m->modulus.limbs, m->minv);
+
+  result->len = 0;
+  BigIntError resize_result = bigint_resize(result, k);
+  if (resize_result == Ok) {
+    memcpy(result->limbs, r, k * LIMB_SIZE_BYTES);
+    bigint_fit(result);
+  }
+  STATS_STOP(timer);
+  return resize_result;
 }
@@ -1,43 +1,65 @@
+#ifndef BIGINT_H
+#define BIGINT_H
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 typedef enum BigIntError {
   Ok,
   ResultMemoryTooSmall,
   MemoryError,
   NotImplemented,
   DivisionByZeroError,
+  NotInvertible,
+  InvalidFormat,
+  IOError,
 } BigIntError;
 extern const char *BigIntErrorStrings[];
 
+typedef enum BigIntRounding {
+  RoundTrunc,
+  RoundFloor,
+} BigIntRounding;
+
 #if UINTPTR_MAX == 0xFFFFFFFFFFFFFFFF
 typedef uint64_t Limb;
 typedef __uint128_t DoubleLimb;
+typedef __int128_t SignedDoubleLimb;
 #define LIMB_SIZE_BYTES 8
 #define LIMB_SIZE_BITS (LIMB_SIZE_BYTES * 8)
 #elif UINTPTR_MAX == 0xFFFFFFFF
 typedef uint32_t Limb;
 typedef uint64_t DoubleLimb;
+typedef int64_t SignedDoubleLimb;
 #define LIMB_SIZE_BYTES 4
 #define LIMB_SIZE_BITS (LIMB_SIZE_BYTES * 8)
 #elif UINTPTR_MAX == 0xFFFF
 typedef uint16_t Limb;
 typedef uint32_t DoubleLimb;
+typedef int32_t SignedDoubleLimb;
 #define LIMB_SIZE_BYTES 2
 #define LIMB_SIZE_BITS (LIMB_SIZE_BYTES * 8)
 #elif UINTPTR_MAX == 0xFF
 typedef uint8_t Limb;
 typedef uint16_t DoubleLimb;
+typedef int16_t SignedDoubleLimb;
 #define LIMB_SIZE_BYTES 1
 #define LIMB_SIZE_BITS (LIMB_SIZE_BYTES * 8)
 #endif
 
 #define MIN_LIMBS 4
+#define KARATSUBA_THRESHOLD 40
 
 typedef struct bigint {
   Limb *limbs;
   size_t capacity;
   size_t len;
+  bool negative;
 } bigint;
 #define BIGINT_ZERO ((bigint){0})
 
@@ -52,6 +74,7 @@ typedef struct bigint {
                   (i < b->len ? b->limbs[i] : 0);                              \
   }                                                                            \
   c->len = max_len;                                                            \
+  bigint_fit(c);                                                               \
   return Ok;
 
 
@@ -59,6 +82,8 @@ bigint *bigint_new_capacity(size_t capacity);
 BigIntError bigint_resize(bigint *a, size_t len);
 void bigint_free_limbs(bigint *bigint);
 BigIntError bigint_set_hex(const char *hex, bigint *result);
+BigIntError bigint_set_from_limb(Limb from, bigint *result);
+BigIntError bigint_get_to_limb(bigint *input, Limb *result);
 char *bigint_get_hex(const bigint *bigint, bool upper);
 BigIntError bigint_bit_not(const bigint *a, bigint *result);
 BigIntError bigint_bit_xor(const bigint *first, const bigint *second,
@@ -71,21 +96,244 @@ BigIntError bigint_bit_shiftl(const bigint *a, size_t n, bigint *result);
 BigIntError bigint_bit_shiftr(const bigint *a, size_t n, bigint *result);
 BigIntError bigint_add(const bigint *a, const bigint *b, bigint *result);
 BigIntError bigint_sub(const bigint *a, const bigint *b, bigint *result);
+int bigint_cmp(const bigint *a, const bigint *b);
 bool bigint_greater_than(const bigint *a, const bigint *b);
 bool bigint_less_than(const bigint *a, const bigint *b);
 bool bigint_equal(const bigint *a, const bigint *b);
 BigIntError bigint_mul(const bigint *a, const bigint *b, bigint *result);
 BigIntError bigint_copy(const bigint *src, bigint *dst);
+void bigint_fit(bigint *bi);
 BigIntError bigint_div(const bigint *a, const bigint *b, bigint *q, bigint *r);
+BigIntError bigint_divrem_limb(const bigint *a, Limb d, bigint *q, Limb *r);
 size_t bigint_bit_length(const bigint *a);
+BigIntError bigint_neg(const bigint *a, bigint *result);
+BigIntError bigint_sadd(const bigint *a, const bigint *b, bigint *result);
+BigIntError bigint_ssub(const bigint *a, const bigint *b, bigint *result);
+BigIntError bigint_smul(const bigint *a, const bigint *b, bigint *result);
+BigIntError bigint_sdiv(const bigint *a, const bigint *b, bigint *q, bigint *r,
+                        BigIntRounding rounding);
+int bigint_scmp(const bigint *a, const bigint *b);
+BigIntError bigint_gcd(const bigint *a, const bigint *b, bigint *g);
+BigIntError bigint_gcdext(const bigint *a, const bigint *b, bigint *g,
+                          bigint *s, bigint *t);
+BigIntError bigint_invert(const bigint *a, const bigint *m, bigint *result);
 typedef struct Montgomery {
     bigint modulus;
     bigint rrm;
     size_t n;
+    Limb minv;
 } Montgomery;
 BigIntError bigint_montgomery_init(const bigint* modulus, Montgomery *m);
 BigIntError bigint_montgomery_reduce(const Montgomery *m, const bigint* a, bigint* result);
 BigIntError bigint_montgomery_mul(const Montgomery *m, const bigint* r1, const bigint* r2, bigint* result);
+BigIntError bigint_montgomery_to(const Montgomery *m, const bigint *a,
+                                 bigint *result);
+// out[i] may be in[i], NotInvertible if any input shares a factor with m
+BigIntError bigint_batch_invert(const Montgomery *m, const bigint *in[],
+                                bigint *out[], size_t n);
+BigIntError bigint_batch_invert_parallel(const Montgomery *m,
+                                         const bigint *in[], bigint *out[],
+                                         size_t n, size_t threads);
+BigIntError bigint_montgomery_exp(const Montgomery *m, const bigint *base,
+                                  const bigint *e, bigint *result);
+BigIntError bigint_montgomery_multiexp(const Montgomery *m,
+                                       const bigint *bases[],
+                                       const bigint *exps[], size_t n,
+                                       bigint *result);
+// Many independent products or powers, each with its own context, computed
+// side by side in SIMD lanes (AVX2 or AVX-512 when compiled for them). The
+// results match bigint_montgomery_mul and bigint_montgomery_exp per item.
+BigIntError bigint_montgomery_mul_lanes(const Montgomery *m[],
+                                        const bigint *r1[], const bigint *r2[],
+                                        bigint *result[], size_t n);
+BigIntError bigint_montgomery_exp_lanes(const Montgomery *m[],
+                                        const bigint *bases[],
+                                        const bigint *exps[], bigint *result[],
+                                        size_t n);
+#define MONTGOMERY_ACC_HEADROOM 1
+typedef struct bigint_montgomery_acc {
+  const Montgomery *m;
+  bigint sum;
+  size_t terms;
+  size_t max_terms;
+} bigint_montgomery_acc;
+BigIntError bigint_montgomery_acc_init(const Montgomery *m,
+                                       bigint_montgomery_acc *acc);
+BigIntError bigint_montgomery_acc_addmul(bigint_montgomery_acc *acc,
+                                         const bigint *a, const bigint *b);
+BigIntError bigint_montgomery_acc_finish(bigint_montgomery_acc *acc,
+                                         bigint *result);
+void bigint_montgomery_acc_free(bigint_montgomery_acc *acc);
+#define SOLINAS_MAX_TERMS 8
+typedef enum SpecialForm {
+  SpecialMersenne,
+  SpecialPseudoMersenne,
+  SpecialSolinas,
+  SpecialGeneric,
+} SpecialForm;
+typedef struct SpecialModulus {
+  bigint modulus;
+  bigint rrm;
+  size_t n;
+  SpecialForm form;
+  bigint c;
+  size_t terms;
+  size_t shifts[SOLINAS_MAX_TERMS];
+  bool negative_terms[SOLINAS_MAX_TERMS];
+} SpecialModulus;
+BigIntError bigint_special_init(const bigint *modulus, SpecialModulus *m);
+BigIntError bigint_special_init_form(size_t k, const bigint *c,
+                                     SpecialModulus *m);
+BigIntError bigint_special_reduce(const SpecialModulus *m, const bigint *a,
+                                  bigint *result);
+BigIntError bigint_special_mul(const SpecialModulus *m, const bigint *r1,
+                               const bigint *r2, bigint *result);
+void bigint_special_free(SpecialModulus *m);
+typedef struct bigint_fixed_base {
+  const Montgomery *m;
+  size_t teeth;
+  size_t spacing;
+  size_t max_bits;
+  size_t entry_limbs;
+  Limb *table;
+} bigint_fixed_base;
+BigIntError bigint_fixed_base_init(const Montgomery *m, const bigint *base,
+                                   size_t max_bits, size_t teeth,
+                                   bigint_fixed_base *fb);
+BigIntError bigint_fixed_base_exp(const bigint_fixed_base *fb, const bigint *e,
+                                  bigint *result);
+void bigint_fixed_base_free(bigint_fixed_base *fb);
+size_t bigint_fixed_base_serialized_size(const bigint_fixed_base *fb);
+BigIntError bigint_fixed_base_serialize(const bigint_fixed_base *fb,
+                                        uint8_t *buffer);
+BigIntError bigint_fixed_base_deserialize(const Montgomery *m,
+                                          const uint8_t *buffer, size_t size,
+                                          bigint_fixed_base *fb);
+int bigint_probab_prime(const bigint *n, int reps);
+BigIntError bigint_next_prime(const bigint *n, bigint *result);
+BigIntError bigint_sqrt_rem(const bigint *a, bigint *s, bigint *r);
+BigIntError bigint_root(const bigint *a, size_t k, bigint *result);
+bool bigint_perfect_square(const bigint *a);
+BigIntError bigint_product(const bigint *items[], size_t n, bigint *out);
+BigIntError bigint_product_parallel(const bigint *items[], size_t n,
+                                    bigint *out, size_t threads);
+BigIntError bigint_fac_ui(Limb n, bigint *result);
+BigIntError bigint_bin_ui(Limb n, Limb k, bigint *result);
+BigIntError bigint_primorial_ui(Limb n, bigint *result);
+// reciprocals[i] is floor(2^(2k) / nodes[i]) for a k bit node, zero for
+// nodes too small to reduce by Barrett
+typedef struct bigint_subproduct_tree {
+  size_t n;
+  bigint *nodes;
+  bigint *reciprocals;
+} bigint_subproduct_tree;
+BigIntError bigint_subproduct_tree_init(const bigint *moduli[], size_t n,
+                                        bigint_subproduct_tree *tree);
+void bigint_subproduct_tree_free(bigint_subproduct_tree *tree);
+BigIntError bigint_remainder_tree(const bigint_subproduct_tree *tree,
+                                  const bigint *x, bigint *out[]);
+typedef struct bigint_rns {
+  size_t n;
+  Limb *moduli;
+  Limb *inverses;
+  bigint_subproduct_tree tree;
+} bigint_rns;
+BigIntError bigint_rns_init(const Limb *moduli, size_t n, bigint_rns *rns);
+void bigint_rns_free(bigint_rns *rns);
+BigIntError bigint_rns_from(const bigint_rns *rns, const bigint *x,
+                            Limb *residues);
+BigIntError bigint_rns_to(const bigint_rns *rns, const Limb *residues,
+                          bigint *result);
+void bigint_rns_add(const bigint_rns *rns, const Limb *a, const Limb *b,
+                    Limb *out);
+void bigint_rns_sub(const bigint_rns *rns, const Limb *a, const Limb *b,
+                    Limb *out);
+void bigint_rns_mul(const bigint_rns *rns, const Limb *a, const Limb *b,
+                    Limb *out);
+// Binary container for large datasets: a header, the limbs of every value
+// and an index of (offset, len | sign << 63) entries at the end. Files are
+// written in native limb size and the requested byte order, the byte order
+// of the magic declares it to readers. The writer streams the limbs and
+// keeps only the index in memory. Readers reject entries that are not
+// normalized.
+typedef enum BigIntByteOrder {
+  ByteOrderNative,
+  ByteOrderLittle,
+  ByteOrderBig,
+} BigIntByteOrder;
+typedef struct bigint_file_writer {
+  FILE *fp;
+  uint64_t offset;
+  size_t count;
+  size_t capacity;
+  uint64_t *index;
+  bool failed; // a short write, later appends and close fail with IOError
+  bool swap;   // the file's byte order is not the host's
+} bigint_file_writer;
+BigIntError bigint_file_writer_open(const char *path, BigIntByteOrder order,
+                                    bigint_file_writer *w);
+BigIntError bigint_file_writer_append(bigint_file_writer *w, const bigint *a);
+BigIntError bigint_file_writer_close(bigint_file_writer *w);
+typedef struct bigint_file {
+  const uint8_t *data;
+  size_t size;
+  size_t count;
+  size_t limb_size;
+  bool swap;
+  const uint8_t *index;
+} bigint_file;
+BigIntError bigint_file_open(const char *path, bigint_file *f);
+// view points into the read-only mapping and stays valid until
+// bigint_file_close, NotImplemented for files in a foreign limb layout
+BigIntError bigint_file_view(const bigint_file *f, size_t i, bigint *view);
+BigIntError bigint_file_get(const bigint_file *f, size_t i, bigint *out);
+void bigint_file_close(bigint_file *f);
+// Counters kept when the library is built with -DBIGINT_STATS. Each thread
+// counts into its own block, bigint_stats_snapshot sums the blocks of live
+// and exited threads. ns includes nested tiers (bigint_mul counts its
+// Karatsuba and classic calls), Karatsuba times only its outermost call.
+typedef enum BigIntStatsOp {
+  StatsMulClassic,
+  StatsMulComba,
+  StatsMulKaratsuba,
+  StatsDiv,
+  StatsDivLimb,
+  StatsMontgomeryReduce,
+  StatsMontgomeryMul,
+  StatsOpCount,
+} BigIntStatsOp;
+extern const char *BigIntStatsOpNames[];
+
+// sizes[i] counts calls whose largest operand has bit_length(limbs) == i
+#define BIGINT_STATS_SIZE_BUCKETS 24
+typedef struct bigint_stats_op {
+  uint64_t calls;
+  uint64_t ns;
+  uint64_t sizes[BIGINT_STATS_SIZE_BUCKETS];
+} bigint_stats_op;
+
+typedef struct bigint_stats {
+  uint64_t allocations;
+  uint64_t reallocs;
+  uint64_t bytes; // requested by allocations and reallocs
+  uint64_t div_corrections; // quotient digit decrements and add-backs
+  uint64_t karatsuba_max_depth;
+  bigint_stats_op ops[StatsOpCount];
+} bigint_stats;
+
+// NotImplemented when built without BIGINT_STATS
+BigIntError bigint_stats_snapshot(bigint_stats *out);
+BigIntError bigint_stats_reset(void);
 size_t calc_needed_limbs_for_hex(size_t hex_len);
 BigIntError bigint_mul_karatsuba(const bigint *a, const bigint *b, bigint *result);
-BigIntError bigint_mul_classic(const bigint *a, const bigint *b, bigint *result);
\ No newline at end of file
+BigIntError bigint_mul_classic(const bigint *a, const bigint *b, bigint *result);
+BigIntError bigint_addmul(bigint *acc, const bigint *a, const bigint *b);
+BigIntError bigint_submul(bigint *acc, const bigint *a, const bigint *b);
+BigIntError bigint_addmul_limb(bigint *acc, const bigint *a, Limb b);
+BigIntError bigint_dot(bigint *acc, const bigint *a[], const bigint *b[],
+                       size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
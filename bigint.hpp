@@ -0,0 +1,489 @@
+#ifndef BIGINT_HPP
+#define BIGINT_HPP
+#include "bigint.h"
+#include "bigint_fixed.h"
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// Header-only RAII wrapper around struct bigint. Values are signed, errors
+// from the C functions become exceptions.
+//
+// a * b does not multiply, it returns an expression that is evaluated when
+// assigned, so x = a * b + c and x += a * b run as a copy plus bigint_addmul
+// into the storage x already owns. Expressions keep references to their
+// operands and must not outlive the statement (no auto e = a * b).
+
+class BigIntException : public std::runtime_error {
+public:
+  explicit BigIntException(BigIntError error)
+      : std::runtime_error(BigIntErrorStrings[error]), error_(error) {}
+  BigIntError error() const { return error_; }
+
+private:
+  BigIntError error_;
+};
+
+namespace bigint_detail {
+inline void check(BigIntError error) {
+  if (error == MemoryError) {
+    throw std::bad_alloc();
+  }
+  if (error != Ok) {
+    throw BigIntException(error);
+  }
+}
+struct Expr {};
+template <class L> struct SumExpr;
+} // namespace bigint_detail
+
+class BigInt;
+
+namespace bigint_detail {
+struct MulExpr : Expr {
+  const BigInt &a;
+  const BigInt &b;
+  MulExpr(const BigInt &a_, const BigInt &b_) : a(a_), b(b_) {}
+  bool references(const BigInt *x) const { return &a == x || &b == x; }
+  void eval_into(BigInt &dst) const;
+};
+} // namespace bigint_detail
+
+class BigInt {
+public:
+  BigInt() : value_() {}
+  BigInt(int x) : BigInt((long long)x) {}
+  BigInt(long x) : BigInt((long long)x) {}
+  BigInt(long long x) : value_() {
+    set_magnitude(x < 0 ? 0ull - (unsigned long long)x : (unsigned long long)x,
+                  x < 0);
+  }
+  BigInt(unsigned x) : BigInt((unsigned long long)x) {}
+  BigInt(unsigned long x) : BigInt((unsigned long long)x) {}
+  BigInt(unsigned long long x) : value_() { set_magnitude(x, false); }
+  explicit BigInt(const char *hex) : value_() {
+    if (!valid_hex(hex)) {
+      throw BigIntException(InvalidFormat);
+    }
+    bigint_set_hex(hex, &value_);
+    if (value_.limbs == NULL) {
+      throw std::bad_alloc();
+    }
+  }
+  explicit BigInt(const std::string &hex) : BigInt(hex.c_str()) {}
+  BigInt(const BigInt &other) : value_() {
+    bigint_detail::check(bigint_copy(&other.value_, &value_));
+  }
+  BigInt(BigInt &&other) noexcept : value_(other.value_) {
+    other.value_ = bigint();
+  }
+  BigInt(const bigint_detail::MulExpr &e) : value_() { e.eval_into(*this); }
+  template <class L>
+  BigInt(const bigint_detail::SumExpr<L> &e) : value_() {
+    e.eval_into(*this);
+  }
+  ~BigInt() { bigint_free_limbs(&value_); }
+
+  // copies reuse the limbs this value already owns
+  BigInt &operator=(const BigInt &other) {
+    if (this != &other) {
+      bigint_detail::check(bigint_copy(&other.value_, &value_));
+    }
+    return *this;
+  }
+  BigInt &operator=(BigInt &&other) noexcept {
+    swap(other);
+    return *this;
+  }
+  BigInt &operator=(const bigint_detail::MulExpr &e) {
+    assign_expr(e);
+    return *this;
+  }
+  template <class L> BigInt &operator=(const bigint_detail::SumExpr<L> &e) {
+    assign_expr(e);
+    return *this;
+  }
+
+  void swap(BigInt &other) noexcept { std::swap(value_, other.value_); }
+
+  bigint *raw() { return &value_; }
+  const bigint *raw() const { return &value_; }
+  // hands the limbs over to the caller, who must bigint_free_limbs them
+  bigint release() {
+    bigint value = value_;
+    value_ = bigint();
+    return value;
+  }
+
+  bool is_zero() const { return value_.len == 0; }
+  bool is_negative() const { return value_.negative; }
+  size_t bit_length() const { return bigint_bit_length(&value_); }
+
+  std::string hex() const {
+    char *hex = bigint_get_hex(&value_, false);
+    if (hex == NULL) {
+      throw std::bad_alloc();
+    }
+    std::string result(hex);
+    free(hex);
+    return result;
+  }
+
+  BigInt &operator+=(const BigInt &other) {
+    bigint_detail::check(bigint_sadd(&value_, &other.value_, &value_));
+    return *this;
+  }
+  BigInt &operator-=(const BigInt &other) {
+    bigint_detail::check(bigint_ssub(&value_, &other.value_, &value_));
+    return *this;
+  }
+  BigInt &operator*=(const BigInt &other) {
+    bigint_detail::check(bigint_smul(&value_, &other.value_, &value_));
+    return *this;
+  }
+  BigInt &operator/=(const BigInt &other) {
+    BigInt r;
+    bigint_detail::check(bigint_sdiv(&value_, &other.value_, &value_,
+                                     &r.value_, RoundTrunc));
+    return *this;
+  }
+  BigInt &operator%=(const BigInt &other) {
+    BigInt q;
+    bigint_detail::check(bigint_sdiv(&value_, &other.value_, &q.value_,
+                                     &value_, RoundTrunc));
+    return *this;
+  }
+  // shifts move the magnitude and keep the sign
+  BigInt &operator<<=(size_t n) {
+    const bool negative = value_.negative;
+    bigint_detail::check(bigint_bit_shiftl(&value_, n, &value_));
+    value_.negative = negative && value_.len > 0;
+    return *this;
+  }
+  BigInt &operator>>=(size_t n) {
+    const bool negative = value_.negative;
+    bigint_detail::check(bigint_bit_shiftr(&value_, n, &value_));
+    value_.negative = negative && value_.len > 0;
+    return *this;
+  }
+  BigInt &operator+=(const bigint_detail::MulExpr &e) {
+    addmul(e.a, e.b, false);
+    return *this;
+  }
+  BigInt &operator-=(const bigint_detail::MulExpr &e) {
+    addmul(e.a, e.b, true);
+    return *this;
+  }
+
+  // this += a b, or this -= a b, through bigint_addmul when the signs allow
+  // it and the signed functions otherwise
+  void addmul(const BigInt &a, const BigInt &b, bool subtract) {
+    if (!value_.negative && !a.value_.negative && !b.value_.negative) {
+      if (!subtract) {
+        bigint_detail::check(bigint_addmul(&value_, &a.value_, &b.value_));
+        return;
+      }
+      // NotImplemented when the result would be negative, value_ is intact
+      const BigIntError error =
+          bigint_submul(&value_, &a.value_, &b.value_);
+      if (error != NotImplemented) {
+        bigint_detail::check(error);
+        return;
+      }
+    }
+    BigInt product;
+    bigint_detail::check(bigint_smul(&a.value_, &b.value_, &product.value_));
+    bigint_detail::check(subtract
+                             ? bigint_ssub(&value_, &product.value_, &value_)
+                             : bigint_sadd(&value_, &product.value_, &value_));
+  }
+
+  friend BigInt operator-(const BigInt &a) {
+    BigInt result;
+    bigint_detail::check(bigint_neg(&a.value_, &result.value_));
+    return result;
+  }
+  friend BigInt operator+(BigInt a, const BigInt &b) {
+    a += b;
+    return a;
+  }
+  friend BigInt operator-(BigInt a, const BigInt &b) {
+    a -= b;
+    return a;
+  }
+  friend BigInt operator/(BigInt a, const BigInt &b) {
+    a /= b;
+    return a;
+  }
+  friend BigInt operator%(BigInt a, const BigInt &b) {
+    a %= b;
+    return a;
+  }
+  friend BigInt operator<<(BigInt a, size_t n) {
+    a <<= n;
+    return a;
+  }
+  friend BigInt operator>>(BigInt a, size_t n) {
+    a >>= n;
+    return a;
+  }
+  friend bigint_detail::MulExpr operator*(const BigInt &a, const BigInt &b) {
+    return bigint_detail::MulExpr(a, b);
+  }
+
+  friend bool operator==(const BigInt &a, const BigInt &b) {
+    return bigint_scmp(&a.value_, &b.value_) == 0;
+  }
+  friend bool operator!=(const BigInt &a, const BigInt &b) {
+    return bigint_scmp(&a.value_, &b.value_) != 0;
+  }
+  friend bool operator<(const BigInt &a, const BigInt &b) {
+    return bigint_scmp(&a.value_, &b.value_) < 0;
+  }
+  friend bool operator>(const BigInt &a, const BigInt &b) {
+    return bigint_scmp(&a.value_, &b.value_) > 0;
+  }
+  friend bool operator<=(const BigInt &a, const BigInt &b) {
+    return bigint_scmp(&a.value_, &b.value_) <= 0;
+  }
+  friend bool operator>=(const BigInt &a, const BigInt &b) {
+    return bigint_scmp(&a.value_, &b.value_) >= 0;
+  }
+
+private:
+  void set_magnitude(unsigned long long magnitude, bool negative) {
+    for (size_t i = 0; i * LIMB_SIZE_BITS < 64; i++) {
+      const Limb limb = (Limb)(magnitude >> (i * LIMB_SIZE_BITS));
+      if (limb != 0) {
+        bigint_detail::check(bigint_resize(&value_, i + 1));
+        value_.limbs[i] = limb;
+      }
+    }
+    bigint_fit(&value_);
+    value_.negative = negative;
+  }
+  static bool valid_hex(const char *hex) {
+    hex += hex[0] == '-';
+    if (*hex == '\0') {
+      return false;
+    }
+    for (; *hex != '\0'; hex++) {
+      const char c = *hex;
+      if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') ||
+            (c >= 'A' && c <= 'F'))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // evaluates in place unless the destination is also an operand
+  template <class E> void assign_expr(const E &e) {
+    if (e.references(this)) {
+      BigInt result(e);
+      swap(result);
+    } else {
+      e.eval_into(*this);
+    }
+  }
+
+  bigint value_;
+};
+
+namespace bigint_detail {
+inline void MulExpr::eval_into(BigInt &dst) const {
+  check(bigint_smul(a.raw(), b.raw(), dst.raw()));
+}
+
+// lhs + a b or lhs - a b, where lhs is a BigInt or another expression
+template <class L> struct SumExpr : Expr {
+  L lhs;
+  const BigInt &a;
+  const BigInt &b;
+  bool subtract;
+  SumExpr(const L &lhs_, const BigInt &a_, const BigInt &b_, bool subtract_)
+      : lhs(lhs_), a(a_), b(b_), subtract(subtract_) {}
+  bool references(const BigInt *x) const {
+    return lhs_references(lhs, x) || &a == x || &b == x;
+  }
+  void eval_into(BigInt &dst) const {
+    lhs_eval_into(lhs, dst);
+    dst.addmul(a, b, subtract);
+  }
+
+private:
+  // dst may be the lhs operand itself, x = x + a b adds in place
+  static bool lhs_references(const BigInt *lhs, const BigInt *) {
+    (void)lhs;
+    return false;
+  }
+  template <class E> static bool lhs_references(const E &lhs, const BigInt *x) {
+    return lhs.references(x);
+  }
+  static void lhs_eval_into(const BigInt *lhs, BigInt &dst) {
+    if (lhs != &dst) {
+      dst = *lhs;
+    }
+  }
+  template <class E> static void lhs_eval_into(const E &lhs, BigInt &dst) {
+    lhs.eval_into(dst);
+  }
+};
+} // namespace bigint_detail
+
+inline bigint_detail::SumExpr<const BigInt *>
+operator+(const BigInt &c, const bigint_detail::MulExpr &e) {
+  return bigint_detail::SumExpr<const BigInt *>(&c, e.a, e.b, false);
+}
+inline bigint_detail::SumExpr<const BigInt *>
+operator+(const bigint_detail::MulExpr &e, const BigInt &c) {
+  return bigint_detail::SumExpr<const BigInt *>(&c, e.a, e.b, false);
+}
+inline bigint_detail::SumExpr<const BigInt *>
+operator-(const BigInt &c, const bigint_detail::MulExpr &e) {
+  return bigint_detail::SumExpr<const BigInt *>(&c, e.a, e.b, true);
+}
+inline bigint_detail::SumExpr<bigint_detail::MulExpr>
+operator+(const bigint_detail::MulExpr &l, const bigint_detail::MulExpr &r) {
+  return bigint_detail::SumExpr<bigint_detail::MulExpr>(l, r.a, r.b, false);
+}
+inline bigint_detail::SumExpr<bigint_detail::MulExpr>
+operator-(const bigint_detail::MulExpr &l, const bigint_detail::MulExpr &r) {
+  return bigint_detail::SumExpr<bigint_detail::MulExpr>(l, r.a, r.b, true);
+}
+template <class L>
+bigint_detail::SumExpr<bigint_detail::SumExpr<L> >
+operator+(const bigint_detail::SumExpr<L> &l, const bigint_detail::MulExpr &r) {
+  return bigint_detail::SumExpr<bigint_detail::SumExpr<L> >(l, r.a, r.b, false);
+}
+template <class L>
+bigint_detail::SumExpr<bigint_detail::SumExpr<L> >
+operator-(const bigint_detail::SumExpr<L> &l, const bigint_detail::MulExpr &r) {
+  return bigint_detail::SumExpr<bigint_detail::SumExpr<L> >(l, r.a, r.b, true);
+}
+
+// Fixed width counterparts of the bigint_fixedBITS types, N is the number of
+// limbs. Arithmetic wraps modulo 2^(LIMB_SIZE_BITS N) like the unsigned
+// built-in types, mul and sqr give both halves.
+template <size_t N> class FixedInt {
+  static_assert(N >= 1 && N <= BIGINT_FIXED_MAX_LIMBS, "unsupported width");
+
+public:
+  Limb limbs[N];
+
+  FixedInt() : limbs() {}
+  FixedInt(Limb x) : limbs() { limbs[0] = x; }
+  explicit FixedInt(const BigInt &x) {
+    bigint_detail::check(bigint_fixed_from_bigint_n(x.raw(), limbs, N));
+  }
+
+  BigInt to_bigint() const {
+    BigInt result;
+    bigint_detail::check(bigint_fixed_to_bigint_n(limbs, result.raw(), N));
+    return result;
+  }
+  bool is_zero() const { return *this == FixedInt(); }
+
+  FixedInt &operator+=(const FixedInt &other) {
+    bigint_fixed_add_n(limbs, other.limbs, limbs, N);
+    return *this;
+  }
+  FixedInt &operator-=(const FixedInt &other) {
+    bigint_fixed_sub_n(limbs, other.limbs, limbs, N);
+    return *this;
+  }
+  FixedInt &operator*=(const FixedInt &other) {
+    FixedInt hi;
+    mul(*this, other, *this, hi);
+    return *this;
+  }
+  FixedInt &operator<<=(size_t n) {
+    bigint_fixed_shl_n(limbs, n, limbs, N);
+    return *this;
+  }
+  FixedInt &operator>>=(size_t n) {
+    bigint_fixed_shr_n(limbs, n, limbs, N);
+    return *this;
+  }
+
+  friend void mul(const FixedInt &a, const FixedInt &b, FixedInt &lo,
+                  FixedInt &hi) {
+    Limb t[2 * N];
+    bigint_fixed_mul_n(a.limbs, b.limbs, t, N);
+    std::copy(t, t + N, lo.limbs);
+    std::copy(t + N, t + 2 * N, hi.limbs);
+  }
+  friend void sqr(const FixedInt &a, FixedInt &lo, FixedInt &hi) {
+    Limb t[2 * N];
+    bigint_fixed_sqr_n(a.limbs, t, N);
+    std::copy(t, t + N, lo.limbs);
+    std::copy(t + N, t + 2 * N, hi.limbs);
+  }
+  friend FixedInt operator+(FixedInt a, const FixedInt &b) { return a += b; }
+  friend FixedInt operator-(FixedInt a, const FixedInt &b) { return a -= b; }
+  friend FixedInt operator*(FixedInt a, const FixedInt &b) { return a *= b; }
+  friend FixedInt operator<<(FixedInt a, size_t n) { return a <<= n; }
+  friend FixedInt operator>>(FixedInt a, size_t n) { return a >>= n; }
+
+  friend bool operator==(const FixedInt &a, const FixedInt &b) {
+    return bigint_fixed_cmp_n(a.limbs, b.limbs, N) == 0;
+  }
+  friend bool operator!=(const FixedInt &a, const FixedInt &b) {
+    return bigint_fixed_cmp_n(a.limbs, b.limbs, N) != 0;
+  }
+  friend bool operator<(const FixedInt &a, const FixedInt &b) {
+    return bigint_fixed_cmp_n(a.limbs, b.limbs, N) < 0;
+  }
+  friend bool operator>(const FixedInt &a, const FixedInt &b) {
+    return bigint_fixed_cmp_n(a.limbs, b.limbs, N) > 0;
+  }
+  friend bool operator<=(const FixedInt &a, const FixedInt &b) {
+    return bigint_fixed_cmp_n(a.limbs, b.limbs, N) <= 0;
+  }
+  friend bool operator>=(const FixedInt &a, const FixedInt &b) {
+    return bigint_fixed_cmp_n(a.limbs, b.limbs, N) >= 0;
+  }
+};
+
+typedef FixedInt<256 / LIMB_SIZE_BITS> FixedInt256;
+typedef FixedInt<512 / LIMB_SIZE_BITS> FixedInt512;
+typedef FixedInt<1024 / LIMB_SIZE_BITS> FixedInt1024;
+typedef FixedInt<2048 / LIMB_SIZE_BITS> FixedInt2048;
+typedef FixedInt<4096 / LIMB_SIZE_BITS> FixedInt4096;
+
+// Montgomery arithmetic modulo an odd FixedInt<N> with R = 2^(LIMB_SIZE_BITS N).
+// Operands of mul and exp are in Montgomery form and below the modulus.
+template <size_t N> class FixedMontgomery {
+public:
+  explicit FixedMontgomery(const FixedInt<N> &modulus) : modulus_(modulus) {
+    bigint_detail::check(bigint_fixed_mont_setup(modulus.limbs, N, one_.limbs,
+                                                 rr_.limbs, &minv_));
+  }
+
+  const FixedInt<N> &modulus() const { return modulus_; }
+  FixedInt<N> to(const FixedInt<N> &a) const { return mul(a, rr_); }
+  FixedInt<N> from(const FixedInt<N> &a) const { return mul(a, FixedInt<N>(1)); }
+  FixedInt<N> mul(const FixedInt<N> &a, const FixedInt<N> &b) const {
+    FixedInt<N> result;
+    bigint_fixed_mont_mul_n(a.limbs, b.limbs, modulus_.limbs, minv_,
+                            result.limbs, N);
+    return result;
+  }
+  FixedInt<N> exp(const FixedInt<N> &base, const FixedInt<N> &exponent) const {
+    FixedInt<N> result;
+    Limb table[17 * N];
+    bigint_fixed_mont_exp_n(base.limbs, exponent.limbs, modulus_.limbs, minv_,
+                            one_.limbs, result.limbs, table, N);
+    return result;
+  }
+
+private:
+  FixedInt<N> modulus_;
+  FixedInt<N> one_;
+  FixedInt<N> rr_;
+  Limb minv_;
+};
+#endif
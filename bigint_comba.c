@@ -0,0 +1,64 @@
+// Generated by gen_comba.py, do not edit.
+#include "bigint.h"
+#include "bigint_comba.h"
+#include "bigint_comba_kernels.h"
+
+const bigint_comba_mul_fn bigint_comba_mul[COMBA_MAX_LIMBS + 1] = {
+    NULL,
+    bigint_comba_mul_1,
+    bigint_comba_mul_2,
+    bigint_comba_mul_3,
+    bigint_comba_mul_4,
+    bigint_comba_mul_5,
+    bigint_comba_mul_6,
+    bigint_comba_mul_7,
+    bigint_comba_mul_8,
+    bigint_comba_mul_9,
+    bigint_comba_mul_10,
+    bigint_comba_mul_11,
+    bigint_comba_mul_12,
+    bigint_comba_mul_13,
+    bigint_comba_mul_14,
+    bigint_comba_mul_15,
+    bigint_comba_mul_16,
+};
+
+const bigint_comba_sqr_fn bigint_comba_sqr[COMBA_MAX_LIMBS + 1] = {
+    NULL,
+    bigint_comba_sqr_1,
+    bigint_comba_sqr_2,
+    bigint_comba_sqr_3,
+    bigint_comba_sqr_4,
+    bigint_comba_sqr_5,
+    bigint_comba_sqr_6,
+    bigint_comba_sqr_7,
+    bigint_comba_sqr_8,
+    bigint_comba_sqr_9,
+    bigint_comba_sqr_10,
+    bigint_comba_sqr_11,
+    bigint_comba_sqr_12,
+    bigint_comba_sqr_13,
+    bigint_comba_sqr_14,
+    bigint_comba_sqr_15,
+    bigint_comba_sqr_16,
+};
+
+const bigint_comba_mont_fn bigint_comba_mont[COMBA_MAX_LIMBS + 1] = {
+    NULL,
+    bigint_comba_mont_1,
+    bigint_comba_mont_2,
+    bigint_comba_mont_3,
+    bigint_comba_mont_4,
+    bigint_comba_mont_5,
+    bigint_comba_mont_6,
+    bigint_comba_mont_7,
+    bigint_comba_mont_8,
+    bigint_comba_mont_9,
+    bigint_comba_mont_10,
+    bigint_comba_mont_11,
+    bigint_comba_mont_12,
+    bigint_comba_mont_13,
+    bigint_comba_mont_14,
+    bigint_comba_mont_15,
+    bigint_comba_mont_16,
+};
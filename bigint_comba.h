@@ -0,0 +1,12 @@
+// Generated by gen_comba.py, do not edit.
+#ifndef BIGINT_COMBA_H
+#define BIGINT_COMBA_H
+#define COMBA_MAX_LIMBS 16
+typedef void (*bigint_comba_mul_fn)(Limb *r, const Limb *a, const Limb *b);
+typedef void (*bigint_comba_sqr_fn)(Limb *r, const Limb *a);
+typedef void (*bigint_comba_mont_fn)(Limb *r, const Limb *a, const Limb *b,
+                                     const Limb *m, Limb minv);
+extern const bigint_comba_mul_fn bigint_comba_mul[COMBA_MAX_LIMBS + 1];
+extern const bigint_comba_sqr_fn bigint_comba_sqr[COMBA_MAX_LIMBS + 1];
+extern const bigint_comba_mont_fn bigint_comba_mont[COMBA_MAX_LIMBS + 1];
+#endif
@@ -0,0 +1,7408 @@
+// Generated by gen_comba.py, do not edit.
+#ifndef BIGINT_COMBA_KERNELS_H
+#define BIGINT_COMBA_KERNELS_H
+#include "bigint.h"
+#include "bigint_comba.h"
+
+// (c2, c1, c0) is a three limb column accumulator
+#define COMBA_ADD(p)                                                           \
+  do {                                                                         \
+    DoubleLimb s_ = (DoubleLimb)c0 + (Limb)(p);                                \
+    c0 = (Limb)s_;                                                             \
+    s_ = (DoubleLimb)c1 + (Limb)((p) >> LIMB_SIZE_BITS) +                      \
+         (s_ >> LIMB_SIZE_BITS);                                               \
+    c1 = (Limb)s_;                                                             \
+    c2 += (Limb)(s_ >> LIMB_SIZE_BITS);                                        \
+  } while (0)
+
+#define COMBA_MULADD(x, y)                                                     \
+  do {                                                                         \
+    const DoubleLimb p_ = (DoubleLimb)(x) * (y);                               \
+    COMBA_ADD(p_);                                                             \
+  } while (0)
+
+#define COMBA_MULADD2(x, y)                                                    \
+  do {                                                                         \
+    const DoubleLimb p_ = (DoubleLimb)(x) * (y);                               \
+    COMBA_ADD(p_);                                                             \
+    COMBA_ADD(p_);                                                             \
+  } while (0)
+
+#define COMBA_SHIFT()                                                          \
+  do {                                                                         \
+    c0 = c1;                                                                   \
+    c1 = c2;                                                                   \
+    c2 = 0;                                                                    \
+  } while (0)
+
+// r = t - m if t >= m else t, where t has n + 1 limbs and t < 2 m
+static inline void bigint_comba_mont_finish(Limb *r, const Limb *t,
+                                            const Limb *m, size_t n) {
+  Limb d[COMBA_MAX_LIMBS];
+  Limb borrow = 0;
+  for (size_t i = 0; i < n; i++) {
+    const Limb x = t[i] - m[i];
+    const Limb y = x - borrow;
+    borrow = (t[i] < m[i]) | (x < borrow);
+    d[i] = y;
+  }
+  const bool subtract = t[n] >= borrow;
+  for (size_t i = 0; i < n; i++) {
+    r[i] = subtract ? d[i] : t[i];
+  }
+}
+
+
+static inline void bigint_comba_mul_1(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  r[1] = c0;
+}
+
+static inline void bigint_comba_sqr_1(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  r[1] = c0;
+}
+
+static inline void bigint_comba_mont_1(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[1], t[2];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  t[0] = c0;
+  COMBA_SHIFT();
+  t[1] = c0;
+  bigint_comba_mont_finish(r, t, m, 1);
+}
+
+static inline void bigint_comba_mul_2(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  r[3] = c0;
+}
+
+static inline void bigint_comba_sqr_2(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  r[3] = c0;
+}
+
+static inline void bigint_comba_mont_2(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[2], t[3];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  t[1] = c0;
+  COMBA_SHIFT();
+  t[2] = c0;
+  bigint_comba_mont_finish(r, t, m, 2);
+}
+
+static inline void bigint_comba_mul_3(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(a[2], b[0]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(a[2], b[1]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  r[5] = c0;
+}
+
+static inline void bigint_comba_sqr_3(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[2]);
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[1], a[2]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], a[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  r[5] = c0;
+}
+
+static inline void bigint_comba_mont_3(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[3], t[4];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(q[0], m[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  COMBA_MULADD(a[2], b[0]);
+  q[2] = c0 * minv;
+  COMBA_MULADD(q[2], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(q[1], m[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(q[2], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(q[2], m[2]);
+  t[1] = c0;
+  COMBA_SHIFT();
+  t[2] = c0;
+  COMBA_SHIFT();
+  t[3] = c0;
+  bigint_comba_mont_finish(r, t, m, 3);
+}
+
+static inline void bigint_comba_mul_4(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(a[2], b[0]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(a[3], b[0]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(a[3], b[1]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(a[3], b[2]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[3]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  r[7] = c0;
+}
+
+static inline void bigint_comba_sqr_4(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[2]);
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[3]);
+  COMBA_MULADD2(a[1], a[2]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[1], a[3]);
+  COMBA_MULADD(a[2], a[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[2], a[3]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], a[3]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  r[7] = c0;
+}
+
+static inline void bigint_comba_mont_4(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[4], t[5];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(q[0], m[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  COMBA_MULADD(a[2], b[0]);
+  q[2] = c0 * minv;
+  COMBA_MULADD(q[2], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(q[0], m[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(q[1], m[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(q[2], m[1]);
+  COMBA_MULADD(a[3], b[0]);
+  q[3] = c0 * minv;
+  COMBA_MULADD(q[3], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(q[1], m[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(q[2], m[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(q[3], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(q[2], m[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(q[3], m[2]);
+  t[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(q[3], m[3]);
+  t[2] = c0;
+  COMBA_SHIFT();
+  t[3] = c0;
+  COMBA_SHIFT();
+  t[4] = c0;
+  bigint_comba_mont_finish(r, t, m, 4);
+}
+
+static inline void bigint_comba_mul_5(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(a[2], b[0]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(a[3], b[0]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(a[4], b[0]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(a[4], b[1]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(a[4], b[2]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(a[4], b[3]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[4]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  r[9] = c0;
+}
+
+static inline void bigint_comba_sqr_5(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[2]);
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[3]);
+  COMBA_MULADD2(a[1], a[2]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[4]);
+  COMBA_MULADD2(a[1], a[3]);
+  COMBA_MULADD(a[2], a[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[1], a[4]);
+  COMBA_MULADD2(a[2], a[3]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[2], a[4]);
+  COMBA_MULADD(a[3], a[3]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[3], a[4]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], a[4]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  r[9] = c0;
+}
+
+static inline void bigint_comba_mont_5(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[5], t[6];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(q[0], m[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  COMBA_MULADD(a[2], b[0]);
+  q[2] = c0 * minv;
+  COMBA_MULADD(q[2], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(q[0], m[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(q[1], m[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(q[2], m[1]);
+  COMBA_MULADD(a[3], b[0]);
+  q[3] = c0 * minv;
+  COMBA_MULADD(q[3], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(q[0], m[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(q[1], m[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(q[2], m[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(q[3], m[1]);
+  COMBA_MULADD(a[4], b[0]);
+  q[4] = c0 * minv;
+  COMBA_MULADD(q[4], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(q[1], m[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(q[2], m[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(q[3], m[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(q[4], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(q[2], m[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(q[3], m[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(q[4], m[2]);
+  t[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(q[3], m[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(q[4], m[3]);
+  t[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(q[4], m[4]);
+  t[3] = c0;
+  COMBA_SHIFT();
+  t[4] = c0;
+  COMBA_SHIFT();
+  t[5] = c0;
+  bigint_comba_mont_finish(r, t, m, 5);
+}
+
+static inline void bigint_comba_mul_6(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(a[2], b[0]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(a[3], b[0]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(a[4], b[0]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(a[5], b[0]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(a[5], b[1]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(a[5], b[2]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(a[5], b[3]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(a[5], b[4]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[5]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  r[11] = c0;
+}
+
+static inline void bigint_comba_sqr_6(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[2]);
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[3]);
+  COMBA_MULADD2(a[1], a[2]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[4]);
+  COMBA_MULADD2(a[1], a[3]);
+  COMBA_MULADD(a[2], a[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[5]);
+  COMBA_MULADD2(a[1], a[4]);
+  COMBA_MULADD2(a[2], a[3]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[1], a[5]);
+  COMBA_MULADD2(a[2], a[4]);
+  COMBA_MULADD(a[3], a[3]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[2], a[5]);
+  COMBA_MULADD2(a[3], a[4]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[3], a[5]);
+  COMBA_MULADD(a[4], a[4]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[4], a[5]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], a[5]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  r[11] = c0;
+}
+
+static inline void bigint_comba_mont_6(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[6], t[7];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(q[0], m[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  COMBA_MULADD(a[2], b[0]);
+  q[2] = c0 * minv;
+  COMBA_MULADD(q[2], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(q[0], m[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(q[1], m[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(q[2], m[1]);
+  COMBA_MULADD(a[3], b[0]);
+  q[3] = c0 * minv;
+  COMBA_MULADD(q[3], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(q[0], m[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(q[1], m[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(q[2], m[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(q[3], m[1]);
+  COMBA_MULADD(a[4], b[0]);
+  q[4] = c0 * minv;
+  COMBA_MULADD(q[4], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(q[0], m[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(q[1], m[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(q[2], m[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(q[3], m[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(q[4], m[1]);
+  COMBA_MULADD(a[5], b[0]);
+  q[5] = c0 * minv;
+  COMBA_MULADD(q[5], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(q[1], m[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(q[2], m[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(q[3], m[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(q[4], m[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(q[5], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(q[2], m[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(q[3], m[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(q[4], m[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(q[5], m[2]);
+  t[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(q[3], m[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(q[4], m[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(q[5], m[3]);
+  t[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(q[4], m[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(q[5], m[4]);
+  t[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(q[5], m[5]);
+  t[4] = c0;
+  COMBA_SHIFT();
+  t[5] = c0;
+  COMBA_SHIFT();
+  t[6] = c0;
+  bigint_comba_mont_finish(r, t, m, 6);
+}
+
+static inline void bigint_comba_mul_7(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(a[2], b[0]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(a[3], b[0]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(a[4], b[0]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(a[5], b[0]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(a[6], b[0]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(a[6], b[1]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(a[6], b[2]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(a[6], b[3]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(a[6], b[4]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(a[6], b[5]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[6]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  r[13] = c0;
+}
+
+static inline void bigint_comba_sqr_7(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[2]);
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[3]);
+  COMBA_MULADD2(a[1], a[2]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[4]);
+  COMBA_MULADD2(a[1], a[3]);
+  COMBA_MULADD(a[2], a[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[5]);
+  COMBA_MULADD2(a[1], a[4]);
+  COMBA_MULADD2(a[2], a[3]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[6]);
+  COMBA_MULADD2(a[1], a[5]);
+  COMBA_MULADD2(a[2], a[4]);
+  COMBA_MULADD(a[3], a[3]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[1], a[6]);
+  COMBA_MULADD2(a[2], a[5]);
+  COMBA_MULADD2(a[3], a[4]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[2], a[6]);
+  COMBA_MULADD2(a[3], a[5]);
+  COMBA_MULADD(a[4], a[4]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[3], a[6]);
+  COMBA_MULADD2(a[4], a[5]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[4], a[6]);
+  COMBA_MULADD(a[5], a[5]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[5], a[6]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], a[6]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  r[13] = c0;
+}
+
+static inline void bigint_comba_mont_7(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[7], t[8];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(q[0], m[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  COMBA_MULADD(a[2], b[0]);
+  q[2] = c0 * minv;
+  COMBA_MULADD(q[2], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(q[0], m[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(q[1], m[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(q[2], m[1]);
+  COMBA_MULADD(a[3], b[0]);
+  q[3] = c0 * minv;
+  COMBA_MULADD(q[3], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(q[0], m[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(q[1], m[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(q[2], m[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(q[3], m[1]);
+  COMBA_MULADD(a[4], b[0]);
+  q[4] = c0 * minv;
+  COMBA_MULADD(q[4], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(q[0], m[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(q[1], m[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(q[2], m[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(q[3], m[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(q[4], m[1]);
+  COMBA_MULADD(a[5], b[0]);
+  q[5] = c0 * minv;
+  COMBA_MULADD(q[5], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(q[0], m[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(q[1], m[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(q[2], m[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(q[3], m[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(q[4], m[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(q[5], m[1]);
+  COMBA_MULADD(a[6], b[0]);
+  q[6] = c0 * minv;
+  COMBA_MULADD(q[6], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(q[1], m[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(q[2], m[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(q[3], m[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(q[4], m[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(q[5], m[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(q[6], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(q[2], m[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(q[3], m[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(q[4], m[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(q[5], m[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(q[6], m[2]);
+  t[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(q[3], m[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(q[4], m[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(q[5], m[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(q[6], m[3]);
+  t[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(q[4], m[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(q[5], m[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(q[6], m[4]);
+  t[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(q[5], m[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(q[6], m[5]);
+  t[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(q[6], m[6]);
+  t[5] = c0;
+  COMBA_SHIFT();
+  t[6] = c0;
+  COMBA_SHIFT();
+  t[7] = c0;
+  bigint_comba_mont_finish(r, t, m, 7);
+}
+
+static inline void bigint_comba_mul_8(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(a[2], b[0]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(a[3], b[0]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(a[4], b[0]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(a[5], b[0]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(a[6], b[0]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(a[7], b[0]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(a[7], b[1]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(a[7], b[2]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(a[7], b[3]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(a[7], b[4]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(a[7], b[5]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(a[7], b[6]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[7]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  r[15] = c0;
+}
+
+static inline void bigint_comba_sqr_8(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[2]);
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[3]);
+  COMBA_MULADD2(a[1], a[2]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[4]);
+  COMBA_MULADD2(a[1], a[3]);
+  COMBA_MULADD(a[2], a[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[5]);
+  COMBA_MULADD2(a[1], a[4]);
+  COMBA_MULADD2(a[2], a[3]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[6]);
+  COMBA_MULADD2(a[1], a[5]);
+  COMBA_MULADD2(a[2], a[4]);
+  COMBA_MULADD(a[3], a[3]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[7]);
+  COMBA_MULADD2(a[1], a[6]);
+  COMBA_MULADD2(a[2], a[5]);
+  COMBA_MULADD2(a[3], a[4]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[1], a[7]);
+  COMBA_MULADD2(a[2], a[6]);
+  COMBA_MULADD2(a[3], a[5]);
+  COMBA_MULADD(a[4], a[4]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[2], a[7]);
+  COMBA_MULADD2(a[3], a[6]);
+  COMBA_MULADD2(a[4], a[5]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[3], a[7]);
+  COMBA_MULADD2(a[4], a[6]);
+  COMBA_MULADD(a[5], a[5]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[4], a[7]);
+  COMBA_MULADD2(a[5], a[6]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[5], a[7]);
+  COMBA_MULADD(a[6], a[6]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[6], a[7]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], a[7]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  r[15] = c0;
+}
+
+static inline void bigint_comba_mont_8(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[8], t[9];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(q[0], m[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  COMBA_MULADD(a[2], b[0]);
+  q[2] = c0 * minv;
+  COMBA_MULADD(q[2], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(q[0], m[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(q[1], m[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(q[2], m[1]);
+  COMBA_MULADD(a[3], b[0]);
+  q[3] = c0 * minv;
+  COMBA_MULADD(q[3], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(q[0], m[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(q[1], m[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(q[2], m[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(q[3], m[1]);
+  COMBA_MULADD(a[4], b[0]);
+  q[4] = c0 * minv;
+  COMBA_MULADD(q[4], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(q[0], m[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(q[1], m[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(q[2], m[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(q[3], m[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(q[4], m[1]);
+  COMBA_MULADD(a[5], b[0]);
+  q[5] = c0 * minv;
+  COMBA_MULADD(q[5], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(q[0], m[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(q[1], m[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(q[2], m[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(q[3], m[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(q[4], m[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(q[5], m[1]);
+  COMBA_MULADD(a[6], b[0]);
+  q[6] = c0 * minv;
+  COMBA_MULADD(q[6], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(q[0], m[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(q[1], m[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(q[2], m[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(q[3], m[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(q[4], m[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(q[5], m[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(q[6], m[1]);
+  COMBA_MULADD(a[7], b[0]);
+  q[7] = c0 * minv;
+  COMBA_MULADD(q[7], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(q[1], m[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(q[2], m[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(q[3], m[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(q[4], m[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(q[5], m[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(q[6], m[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(q[7], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(q[2], m[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(q[3], m[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(q[4], m[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(q[5], m[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(q[6], m[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(q[7], m[2]);
+  t[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(q[3], m[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(q[4], m[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(q[5], m[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(q[6], m[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(q[7], m[3]);
+  t[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(q[4], m[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(q[5], m[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(q[6], m[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(q[7], m[4]);
+  t[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(q[5], m[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(q[6], m[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(q[7], m[5]);
+  t[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(q[6], m[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(q[7], m[6]);
+  t[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(q[7], m[7]);
+  t[6] = c0;
+  COMBA_SHIFT();
+  t[7] = c0;
+  COMBA_SHIFT();
+  t[8] = c0;
+  bigint_comba_mont_finish(r, t, m, 8);
+}
+
+static inline void bigint_comba_mul_9(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(a[2], b[0]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(a[3], b[0]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(a[4], b[0]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(a[5], b[0]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(a[6], b[0]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(a[7], b[0]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(a[8], b[0]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(a[8], b[1]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(a[8], b[2]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(a[8], b[3]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(a[8], b[4]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(a[8], b[5]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(a[8], b[6]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(a[8], b[7]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[8]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  r[17] = c0;
+}
+
+static inline void bigint_comba_sqr_9(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[2]);
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[3]);
+  COMBA_MULADD2(a[1], a[2]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[4]);
+  COMBA_MULADD2(a[1], a[3]);
+  COMBA_MULADD(a[2], a[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[5]);
+  COMBA_MULADD2(a[1], a[4]);
+  COMBA_MULADD2(a[2], a[3]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[6]);
+  COMBA_MULADD2(a[1], a[5]);
+  COMBA_MULADD2(a[2], a[4]);
+  COMBA_MULADD(a[3], a[3]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[7]);
+  COMBA_MULADD2(a[1], a[6]);
+  COMBA_MULADD2(a[2], a[5]);
+  COMBA_MULADD2(a[3], a[4]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[8]);
+  COMBA_MULADD2(a[1], a[7]);
+  COMBA_MULADD2(a[2], a[6]);
+  COMBA_MULADD2(a[3], a[5]);
+  COMBA_MULADD(a[4], a[4]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[1], a[8]);
+  COMBA_MULADD2(a[2], a[7]);
+  COMBA_MULADD2(a[3], a[6]);
+  COMBA_MULADD2(a[4], a[5]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[2], a[8]);
+  COMBA_MULADD2(a[3], a[7]);
+  COMBA_MULADD2(a[4], a[6]);
+  COMBA_MULADD(a[5], a[5]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[3], a[8]);
+  COMBA_MULADD2(a[4], a[7]);
+  COMBA_MULADD2(a[5], a[6]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[4], a[8]);
+  COMBA_MULADD2(a[5], a[7]);
+  COMBA_MULADD(a[6], a[6]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[5], a[8]);
+  COMBA_MULADD2(a[6], a[7]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[6], a[8]);
+  COMBA_MULADD(a[7], a[7]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[7], a[8]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], a[8]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  r[17] = c0;
+}
+
+static inline void bigint_comba_mont_9(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[9], t[10];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(q[0], m[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  COMBA_MULADD(a[2], b[0]);
+  q[2] = c0 * minv;
+  COMBA_MULADD(q[2], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(q[0], m[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(q[1], m[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(q[2], m[1]);
+  COMBA_MULADD(a[3], b[0]);
+  q[3] = c0 * minv;
+  COMBA_MULADD(q[3], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(q[0], m[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(q[1], m[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(q[2], m[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(q[3], m[1]);
+  COMBA_MULADD(a[4], b[0]);
+  q[4] = c0 * minv;
+  COMBA_MULADD(q[4], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(q[0], m[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(q[1], m[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(q[2], m[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(q[3], m[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(q[4], m[1]);
+  COMBA_MULADD(a[5], b[0]);
+  q[5] = c0 * minv;
+  COMBA_MULADD(q[5], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(q[0], m[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(q[1], m[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(q[2], m[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(q[3], m[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(q[4], m[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(q[5], m[1]);
+  COMBA_MULADD(a[6], b[0]);
+  q[6] = c0 * minv;
+  COMBA_MULADD(q[6], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(q[0], m[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(q[1], m[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(q[2], m[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(q[3], m[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(q[4], m[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(q[5], m[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(q[6], m[1]);
+  COMBA_MULADD(a[7], b[0]);
+  q[7] = c0 * minv;
+  COMBA_MULADD(q[7], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(q[0], m[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(q[1], m[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(q[2], m[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(q[3], m[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(q[4], m[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(q[5], m[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(q[6], m[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(q[7], m[1]);
+  COMBA_MULADD(a[8], b[0]);
+  q[8] = c0 * minv;
+  COMBA_MULADD(q[8], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(q[1], m[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(q[2], m[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(q[3], m[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(q[4], m[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(q[5], m[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(q[6], m[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(q[7], m[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(q[8], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(q[2], m[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(q[3], m[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(q[4], m[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(q[5], m[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(q[6], m[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(q[7], m[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(q[8], m[2]);
+  t[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(q[3], m[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(q[4], m[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(q[5], m[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(q[6], m[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(q[7], m[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(q[8], m[3]);
+  t[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(q[4], m[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(q[5], m[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(q[6], m[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(q[7], m[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(q[8], m[4]);
+  t[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(q[5], m[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(q[6], m[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(q[7], m[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(q[8], m[5]);
+  t[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(q[6], m[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(q[7], m[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(q[8], m[6]);
+  t[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(q[7], m[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(q[8], m[7]);
+  t[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(q[8], m[8]);
+  t[7] = c0;
+  COMBA_SHIFT();
+  t[8] = c0;
+  COMBA_SHIFT();
+  t[9] = c0;
+  bigint_comba_mont_finish(r, t, m, 9);
+}
+
+static inline void bigint_comba_mul_10(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(a[2], b[0]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(a[3], b[0]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(a[4], b[0]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(a[5], b[0]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(a[6], b[0]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(a[7], b[0]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(a[8], b[0]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[9]);
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(a[9], b[0]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[9]);
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(a[9], b[1]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[9]);
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(a[9], b[2]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[9]);
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(a[9], b[3]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[9]);
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(a[9], b[4]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[9]);
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(a[9], b[5]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[9]);
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(a[9], b[6]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[9]);
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(a[9], b[7]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[9]);
+  COMBA_MULADD(a[9], b[8]);
+  r[17] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], b[9]);
+  r[18] = c0;
+  COMBA_SHIFT();
+  r[19] = c0;
+}
+
+static inline void bigint_comba_sqr_10(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[2]);
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[3]);
+  COMBA_MULADD2(a[1], a[2]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[4]);
+  COMBA_MULADD2(a[1], a[3]);
+  COMBA_MULADD(a[2], a[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[5]);
+  COMBA_MULADD2(a[1], a[4]);
+  COMBA_MULADD2(a[2], a[3]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[6]);
+  COMBA_MULADD2(a[1], a[5]);
+  COMBA_MULADD2(a[2], a[4]);
+  COMBA_MULADD(a[3], a[3]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[7]);
+  COMBA_MULADD2(a[1], a[6]);
+  COMBA_MULADD2(a[2], a[5]);
+  COMBA_MULADD2(a[3], a[4]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[8]);
+  COMBA_MULADD2(a[1], a[7]);
+  COMBA_MULADD2(a[2], a[6]);
+  COMBA_MULADD2(a[3], a[5]);
+  COMBA_MULADD(a[4], a[4]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[9]);
+  COMBA_MULADD2(a[1], a[8]);
+  COMBA_MULADD2(a[2], a[7]);
+  COMBA_MULADD2(a[3], a[6]);
+  COMBA_MULADD2(a[4], a[5]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[1], a[9]);
+  COMBA_MULADD2(a[2], a[8]);
+  COMBA_MULADD2(a[3], a[7]);
+  COMBA_MULADD2(a[4], a[6]);
+  COMBA_MULADD(a[5], a[5]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[2], a[9]);
+  COMBA_MULADD2(a[3], a[8]);
+  COMBA_MULADD2(a[4], a[7]);
+  COMBA_MULADD2(a[5], a[6]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[3], a[9]);
+  COMBA_MULADD2(a[4], a[8]);
+  COMBA_MULADD2(a[5], a[7]);
+  COMBA_MULADD(a[6], a[6]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[4], a[9]);
+  COMBA_MULADD2(a[5], a[8]);
+  COMBA_MULADD2(a[6], a[7]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[5], a[9]);
+  COMBA_MULADD2(a[6], a[8]);
+  COMBA_MULADD(a[7], a[7]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[6], a[9]);
+  COMBA_MULADD2(a[7], a[8]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[7], a[9]);
+  COMBA_MULADD(a[8], a[8]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[8], a[9]);
+  r[17] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], a[9]);
+  r[18] = c0;
+  COMBA_SHIFT();
+  r[19] = c0;
+}
+
+static inline void bigint_comba_mont_10(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[10], t[11];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(q[0], m[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  COMBA_MULADD(a[2], b[0]);
+  q[2] = c0 * minv;
+  COMBA_MULADD(q[2], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(q[0], m[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(q[1], m[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(q[2], m[1]);
+  COMBA_MULADD(a[3], b[0]);
+  q[3] = c0 * minv;
+  COMBA_MULADD(q[3], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(q[0], m[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(q[1], m[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(q[2], m[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(q[3], m[1]);
+  COMBA_MULADD(a[4], b[0]);
+  q[4] = c0 * minv;
+  COMBA_MULADD(q[4], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(q[0], m[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(q[1], m[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(q[2], m[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(q[3], m[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(q[4], m[1]);
+  COMBA_MULADD(a[5], b[0]);
+  q[5] = c0 * minv;
+  COMBA_MULADD(q[5], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(q[0], m[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(q[1], m[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(q[2], m[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(q[3], m[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(q[4], m[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(q[5], m[1]);
+  COMBA_MULADD(a[6], b[0]);
+  q[6] = c0 * minv;
+  COMBA_MULADD(q[6], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(q[0], m[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(q[1], m[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(q[2], m[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(q[3], m[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(q[4], m[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(q[5], m[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(q[6], m[1]);
+  COMBA_MULADD(a[7], b[0]);
+  q[7] = c0 * minv;
+  COMBA_MULADD(q[7], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(q[0], m[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(q[1], m[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(q[2], m[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(q[3], m[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(q[4], m[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(q[5], m[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(q[6], m[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(q[7], m[1]);
+  COMBA_MULADD(a[8], b[0]);
+  q[8] = c0 * minv;
+  COMBA_MULADD(q[8], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[9]);
+  COMBA_MULADD(q[0], m[9]);
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(q[1], m[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(q[2], m[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(q[3], m[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(q[4], m[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(q[5], m[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(q[6], m[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(q[7], m[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(q[8], m[1]);
+  COMBA_MULADD(a[9], b[0]);
+  q[9] = c0 * minv;
+  COMBA_MULADD(q[9], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[9]);
+  COMBA_MULADD(q[1], m[9]);
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(q[2], m[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(q[3], m[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(q[4], m[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(q[5], m[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(q[6], m[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(q[7], m[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(q[8], m[2]);
+  COMBA_MULADD(a[9], b[1]);
+  COMBA_MULADD(q[9], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[9]);
+  COMBA_MULADD(q[2], m[9]);
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(q[3], m[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(q[4], m[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(q[5], m[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(q[6], m[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(q[7], m[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(q[8], m[3]);
+  COMBA_MULADD(a[9], b[2]);
+  COMBA_MULADD(q[9], m[2]);
+  t[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[9]);
+  COMBA_MULADD(q[3], m[9]);
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(q[4], m[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(q[5], m[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(q[6], m[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(q[7], m[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(q[8], m[4]);
+  COMBA_MULADD(a[9], b[3]);
+  COMBA_MULADD(q[9], m[3]);
+  t[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[9]);
+  COMBA_MULADD(q[4], m[9]);
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(q[5], m[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(q[6], m[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(q[7], m[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(q[8], m[5]);
+  COMBA_MULADD(a[9], b[4]);
+  COMBA_MULADD(q[9], m[4]);
+  t[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[9]);
+  COMBA_MULADD(q[5], m[9]);
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(q[6], m[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(q[7], m[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(q[8], m[6]);
+  COMBA_MULADD(a[9], b[5]);
+  COMBA_MULADD(q[9], m[5]);
+  t[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[9]);
+  COMBA_MULADD(q[6], m[9]);
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(q[7], m[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(q[8], m[7]);
+  COMBA_MULADD(a[9], b[6]);
+  COMBA_MULADD(q[9], m[6]);
+  t[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[9]);
+  COMBA_MULADD(q[7], m[9]);
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(q[8], m[8]);
+  COMBA_MULADD(a[9], b[7]);
+  COMBA_MULADD(q[9], m[7]);
+  t[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[9]);
+  COMBA_MULADD(q[8], m[9]);
+  COMBA_MULADD(a[9], b[8]);
+  COMBA_MULADD(q[9], m[8]);
+  t[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], b[9]);
+  COMBA_MULADD(q[9], m[9]);
+  t[8] = c0;
+  COMBA_SHIFT();
+  t[9] = c0;
+  COMBA_SHIFT();
+  t[10] = c0;
+  bigint_comba_mont_finish(r, t, m, 10);
+}
+
+static inline void bigint_comba_mul_11(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(a[2], b[0]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(a[3], b[0]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(a[4], b[0]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(a[5], b[0]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(a[6], b[0]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(a[7], b[0]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(a[8], b[0]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[9]);
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(a[9], b[0]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[10]);
+  COMBA_MULADD(a[1], b[9]);
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(a[9], b[1]);
+  COMBA_MULADD(a[10], b[0]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[10]);
+  COMBA_MULADD(a[2], b[9]);
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(a[9], b[2]);
+  COMBA_MULADD(a[10], b[1]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[10]);
+  COMBA_MULADD(a[3], b[9]);
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(a[9], b[3]);
+  COMBA_MULADD(a[10], b[2]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[10]);
+  COMBA_MULADD(a[4], b[9]);
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(a[9], b[4]);
+  COMBA_MULADD(a[10], b[3]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[10]);
+  COMBA_MULADD(a[5], b[9]);
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(a[9], b[5]);
+  COMBA_MULADD(a[10], b[4]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[10]);
+  COMBA_MULADD(a[6], b[9]);
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(a[9], b[6]);
+  COMBA_MULADD(a[10], b[5]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[10]);
+  COMBA_MULADD(a[7], b[9]);
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(a[9], b[7]);
+  COMBA_MULADD(a[10], b[6]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[10]);
+  COMBA_MULADD(a[8], b[9]);
+  COMBA_MULADD(a[9], b[8]);
+  COMBA_MULADD(a[10], b[7]);
+  r[17] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[10]);
+  COMBA_MULADD(a[9], b[9]);
+  COMBA_MULADD(a[10], b[8]);
+  r[18] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], b[10]);
+  COMBA_MULADD(a[10], b[9]);
+  r[19] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[10], b[10]);
+  r[20] = c0;
+  COMBA_SHIFT();
+  r[21] = c0;
+}
+
+static inline void bigint_comba_sqr_11(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[2]);
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[3]);
+  COMBA_MULADD2(a[1], a[2]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[4]);
+  COMBA_MULADD2(a[1], a[3]);
+  COMBA_MULADD(a[2], a[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[5]);
+  COMBA_MULADD2(a[1], a[4]);
+  COMBA_MULADD2(a[2], a[3]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[6]);
+  COMBA_MULADD2(a[1], a[5]);
+  COMBA_MULADD2(a[2], a[4]);
+  COMBA_MULADD(a[3], a[3]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[7]);
+  COMBA_MULADD2(a[1], a[6]);
+  COMBA_MULADD2(a[2], a[5]);
+  COMBA_MULADD2(a[3], a[4]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[8]);
+  COMBA_MULADD2(a[1], a[7]);
+  COMBA_MULADD2(a[2], a[6]);
+  COMBA_MULADD2(a[3], a[5]);
+  COMBA_MULADD(a[4], a[4]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[9]);
+  COMBA_MULADD2(a[1], a[8]);
+  COMBA_MULADD2(a[2], a[7]);
+  COMBA_MULADD2(a[3], a[6]);
+  COMBA_MULADD2(a[4], a[5]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[10]);
+  COMBA_MULADD2(a[1], a[9]);
+  COMBA_MULADD2(a[2], a[8]);
+  COMBA_MULADD2(a[3], a[7]);
+  COMBA_MULADD2(a[4], a[6]);
+  COMBA_MULADD(a[5], a[5]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[1], a[10]);
+  COMBA_MULADD2(a[2], a[9]);
+  COMBA_MULADD2(a[3], a[8]);
+  COMBA_MULADD2(a[4], a[7]);
+  COMBA_MULADD2(a[5], a[6]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[2], a[10]);
+  COMBA_MULADD2(a[3], a[9]);
+  COMBA_MULADD2(a[4], a[8]);
+  COMBA_MULADD2(a[5], a[7]);
+  COMBA_MULADD(a[6], a[6]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[3], a[10]);
+  COMBA_MULADD2(a[4], a[9]);
+  COMBA_MULADD2(a[5], a[8]);
+  COMBA_MULADD2(a[6], a[7]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[4], a[10]);
+  COMBA_MULADD2(a[5], a[9]);
+  COMBA_MULADD2(a[6], a[8]);
+  COMBA_MULADD(a[7], a[7]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[5], a[10]);
+  COMBA_MULADD2(a[6], a[9]);
+  COMBA_MULADD2(a[7], a[8]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[6], a[10]);
+  COMBA_MULADD2(a[7], a[9]);
+  COMBA_MULADD(a[8], a[8]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[7], a[10]);
+  COMBA_MULADD2(a[8], a[9]);
+  r[17] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[8], a[10]);
+  COMBA_MULADD(a[9], a[9]);
+  r[18] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[9], a[10]);
+  r[19] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[10], a[10]);
+  r[20] = c0;
+  COMBA_SHIFT();
+  r[21] = c0;
+}
+
+static inline void bigint_comba_mont_11(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[11], t[12];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(q[0], m[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  COMBA_MULADD(a[2], b[0]);
+  q[2] = c0 * minv;
+  COMBA_MULADD(q[2], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(q[0], m[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(q[1], m[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(q[2], m[1]);
+  COMBA_MULADD(a[3], b[0]);
+  q[3] = c0 * minv;
+  COMBA_MULADD(q[3], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(q[0], m[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(q[1], m[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(q[2], m[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(q[3], m[1]);
+  COMBA_MULADD(a[4], b[0]);
+  q[4] = c0 * minv;
+  COMBA_MULADD(q[4], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(q[0], m[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(q[1], m[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(q[2], m[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(q[3], m[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(q[4], m[1]);
+  COMBA_MULADD(a[5], b[0]);
+  q[5] = c0 * minv;
+  COMBA_MULADD(q[5], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(q[0], m[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(q[1], m[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(q[2], m[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(q[3], m[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(q[4], m[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(q[5], m[1]);
+  COMBA_MULADD(a[6], b[0]);
+  q[6] = c0 * minv;
+  COMBA_MULADD(q[6], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(q[0], m[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(q[1], m[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(q[2], m[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(q[3], m[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(q[4], m[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(q[5], m[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(q[6], m[1]);
+  COMBA_MULADD(a[7], b[0]);
+  q[7] = c0 * minv;
+  COMBA_MULADD(q[7], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(q[0], m[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(q[1], m[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(q[2], m[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(q[3], m[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(q[4], m[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(q[5], m[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(q[6], m[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(q[7], m[1]);
+  COMBA_MULADD(a[8], b[0]);
+  q[8] = c0 * minv;
+  COMBA_MULADD(q[8], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[9]);
+  COMBA_MULADD(q[0], m[9]);
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(q[1], m[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(q[2], m[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(q[3], m[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(q[4], m[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(q[5], m[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(q[6], m[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(q[7], m[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(q[8], m[1]);
+  COMBA_MULADD(a[9], b[0]);
+  q[9] = c0 * minv;
+  COMBA_MULADD(q[9], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[10]);
+  COMBA_MULADD(q[0], m[10]);
+  COMBA_MULADD(a[1], b[9]);
+  COMBA_MULADD(q[1], m[9]);
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(q[2], m[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(q[3], m[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(q[4], m[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(q[5], m[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(q[6], m[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(q[7], m[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(q[8], m[2]);
+  COMBA_MULADD(a[9], b[1]);
+  COMBA_MULADD(q[9], m[1]);
+  COMBA_MULADD(a[10], b[0]);
+  q[10] = c0 * minv;
+  COMBA_MULADD(q[10], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[10]);
+  COMBA_MULADD(q[1], m[10]);
+  COMBA_MULADD(a[2], b[9]);
+  COMBA_MULADD(q[2], m[9]);
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(q[3], m[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(q[4], m[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(q[5], m[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(q[6], m[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(q[7], m[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(q[8], m[3]);
+  COMBA_MULADD(a[9], b[2]);
+  COMBA_MULADD(q[9], m[2]);
+  COMBA_MULADD(a[10], b[1]);
+  COMBA_MULADD(q[10], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[10]);
+  COMBA_MULADD(q[2], m[10]);
+  COMBA_MULADD(a[3], b[9]);
+  COMBA_MULADD(q[3], m[9]);
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(q[4], m[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(q[5], m[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(q[6], m[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(q[7], m[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(q[8], m[4]);
+  COMBA_MULADD(a[9], b[3]);
+  COMBA_MULADD(q[9], m[3]);
+  COMBA_MULADD(a[10], b[2]);
+  COMBA_MULADD(q[10], m[2]);
+  t[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[10]);
+  COMBA_MULADD(q[3], m[10]);
+  COMBA_MULADD(a[4], b[9]);
+  COMBA_MULADD(q[4], m[9]);
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(q[5], m[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(q[6], m[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(q[7], m[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(q[8], m[5]);
+  COMBA_MULADD(a[9], b[4]);
+  COMBA_MULADD(q[9], m[4]);
+  COMBA_MULADD(a[10], b[3]);
+  COMBA_MULADD(q[10], m[3]);
+  t[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[10]);
+  COMBA_MULADD(q[4], m[10]);
+  COMBA_MULADD(a[5], b[9]);
+  COMBA_MULADD(q[5], m[9]);
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(q[6], m[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(q[7], m[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(q[8], m[6]);
+  COMBA_MULADD(a[9], b[5]);
+  COMBA_MULADD(q[9], m[5]);
+  COMBA_MULADD(a[10], b[4]);
+  COMBA_MULADD(q[10], m[4]);
+  t[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[10]);
+  COMBA_MULADD(q[5], m[10]);
+  COMBA_MULADD(a[6], b[9]);
+  COMBA_MULADD(q[6], m[9]);
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(q[7], m[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(q[8], m[7]);
+  COMBA_MULADD(a[9], b[6]);
+  COMBA_MULADD(q[9], m[6]);
+  COMBA_MULADD(a[10], b[5]);
+  COMBA_MULADD(q[10], m[5]);
+  t[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[10]);
+  COMBA_MULADD(q[6], m[10]);
+  COMBA_MULADD(a[7], b[9]);
+  COMBA_MULADD(q[7], m[9]);
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(q[8], m[8]);
+  COMBA_MULADD(a[9], b[7]);
+  COMBA_MULADD(q[9], m[7]);
+  COMBA_MULADD(a[10], b[6]);
+  COMBA_MULADD(q[10], m[6]);
+  t[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[10]);
+  COMBA_MULADD(q[7], m[10]);
+  COMBA_MULADD(a[8], b[9]);
+  COMBA_MULADD(q[8], m[9]);
+  COMBA_MULADD(a[9], b[8]);
+  COMBA_MULADD(q[9], m[8]);
+  COMBA_MULADD(a[10], b[7]);
+  COMBA_MULADD(q[10], m[7]);
+  t[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[10]);
+  COMBA_MULADD(q[8], m[10]);
+  COMBA_MULADD(a[9], b[9]);
+  COMBA_MULADD(q[9], m[9]);
+  COMBA_MULADD(a[10], b[8]);
+  COMBA_MULADD(q[10], m[8]);
+  t[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], b[10]);
+  COMBA_MULADD(q[9], m[10]);
+  COMBA_MULADD(a[10], b[9]);
+  COMBA_MULADD(q[10], m[9]);
+  t[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[10], b[10]);
+  COMBA_MULADD(q[10], m[10]);
+  t[9] = c0;
+  COMBA_SHIFT();
+  t[10] = c0;
+  COMBA_SHIFT();
+  t[11] = c0;
+  bigint_comba_mont_finish(r, t, m, 11);
+}
+
+static inline void bigint_comba_mul_12(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(a[2], b[0]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(a[3], b[0]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(a[4], b[0]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(a[5], b[0]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(a[6], b[0]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(a[7], b[0]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(a[8], b[0]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[9]);
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(a[9], b[0]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[10]);
+  COMBA_MULADD(a[1], b[9]);
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(a[9], b[1]);
+  COMBA_MULADD(a[10], b[0]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[11]);
+  COMBA_MULADD(a[1], b[10]);
+  COMBA_MULADD(a[2], b[9]);
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(a[9], b[2]);
+  COMBA_MULADD(a[10], b[1]);
+  COMBA_MULADD(a[11], b[0]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[11]);
+  COMBA_MULADD(a[2], b[10]);
+  COMBA_MULADD(a[3], b[9]);
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(a[9], b[3]);
+  COMBA_MULADD(a[10], b[2]);
+  COMBA_MULADD(a[11], b[1]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[11]);
+  COMBA_MULADD(a[3], b[10]);
+  COMBA_MULADD(a[4], b[9]);
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(a[9], b[4]);
+  COMBA_MULADD(a[10], b[3]);
+  COMBA_MULADD(a[11], b[2]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[11]);
+  COMBA_MULADD(a[4], b[10]);
+  COMBA_MULADD(a[5], b[9]);
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(a[9], b[5]);
+  COMBA_MULADD(a[10], b[4]);
+  COMBA_MULADD(a[11], b[3]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[11]);
+  COMBA_MULADD(a[5], b[10]);
+  COMBA_MULADD(a[6], b[9]);
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(a[9], b[6]);
+  COMBA_MULADD(a[10], b[5]);
+  COMBA_MULADD(a[11], b[4]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[11]);
+  COMBA_MULADD(a[6], b[10]);
+  COMBA_MULADD(a[7], b[9]);
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(a[9], b[7]);
+  COMBA_MULADD(a[10], b[6]);
+  COMBA_MULADD(a[11], b[5]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[11]);
+  COMBA_MULADD(a[7], b[10]);
+  COMBA_MULADD(a[8], b[9]);
+  COMBA_MULADD(a[9], b[8]);
+  COMBA_MULADD(a[10], b[7]);
+  COMBA_MULADD(a[11], b[6]);
+  r[17] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[11]);
+  COMBA_MULADD(a[8], b[10]);
+  COMBA_MULADD(a[9], b[9]);
+  COMBA_MULADD(a[10], b[8]);
+  COMBA_MULADD(a[11], b[7]);
+  r[18] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[11]);
+  COMBA_MULADD(a[9], b[10]);
+  COMBA_MULADD(a[10], b[9]);
+  COMBA_MULADD(a[11], b[8]);
+  r[19] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], b[11]);
+  COMBA_MULADD(a[10], b[10]);
+  COMBA_MULADD(a[11], b[9]);
+  r[20] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[10], b[11]);
+  COMBA_MULADD(a[11], b[10]);
+  r[21] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[11], b[11]);
+  r[22] = c0;
+  COMBA_SHIFT();
+  r[23] = c0;
+}
+
+static inline void bigint_comba_sqr_12(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[2]);
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[3]);
+  COMBA_MULADD2(a[1], a[2]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[4]);
+  COMBA_MULADD2(a[1], a[3]);
+  COMBA_MULADD(a[2], a[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[5]);
+  COMBA_MULADD2(a[1], a[4]);
+  COMBA_MULADD2(a[2], a[3]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[6]);
+  COMBA_MULADD2(a[1], a[5]);
+  COMBA_MULADD2(a[2], a[4]);
+  COMBA_MULADD(a[3], a[3]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[7]);
+  COMBA_MULADD2(a[1], a[6]);
+  COMBA_MULADD2(a[2], a[5]);
+  COMBA_MULADD2(a[3], a[4]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[8]);
+  COMBA_MULADD2(a[1], a[7]);
+  COMBA_MULADD2(a[2], a[6]);
+  COMBA_MULADD2(a[3], a[5]);
+  COMBA_MULADD(a[4], a[4]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[9]);
+  COMBA_MULADD2(a[1], a[8]);
+  COMBA_MULADD2(a[2], a[7]);
+  COMBA_MULADD2(a[3], a[6]);
+  COMBA_MULADD2(a[4], a[5]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[10]);
+  COMBA_MULADD2(a[1], a[9]);
+  COMBA_MULADD2(a[2], a[8]);
+  COMBA_MULADD2(a[3], a[7]);
+  COMBA_MULADD2(a[4], a[6]);
+  COMBA_MULADD(a[5], a[5]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[11]);
+  COMBA_MULADD2(a[1], a[10]);
+  COMBA_MULADD2(a[2], a[9]);
+  COMBA_MULADD2(a[3], a[8]);
+  COMBA_MULADD2(a[4], a[7]);
+  COMBA_MULADD2(a[5], a[6]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[1], a[11]);
+  COMBA_MULADD2(a[2], a[10]);
+  COMBA_MULADD2(a[3], a[9]);
+  COMBA_MULADD2(a[4], a[8]);
+  COMBA_MULADD2(a[5], a[7]);
+  COMBA_MULADD(a[6], a[6]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[2], a[11]);
+  COMBA_MULADD2(a[3], a[10]);
+  COMBA_MULADD2(a[4], a[9]);
+  COMBA_MULADD2(a[5], a[8]);
+  COMBA_MULADD2(a[6], a[7]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[3], a[11]);
+  COMBA_MULADD2(a[4], a[10]);
+  COMBA_MULADD2(a[5], a[9]);
+  COMBA_MULADD2(a[6], a[8]);
+  COMBA_MULADD(a[7], a[7]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[4], a[11]);
+  COMBA_MULADD2(a[5], a[10]);
+  COMBA_MULADD2(a[6], a[9]);
+  COMBA_MULADD2(a[7], a[8]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[5], a[11]);
+  COMBA_MULADD2(a[6], a[10]);
+  COMBA_MULADD2(a[7], a[9]);
+  COMBA_MULADD(a[8], a[8]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[6], a[11]);
+  COMBA_MULADD2(a[7], a[10]);
+  COMBA_MULADD2(a[8], a[9]);
+  r[17] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[7], a[11]);
+  COMBA_MULADD2(a[8], a[10]);
+  COMBA_MULADD(a[9], a[9]);
+  r[18] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[8], a[11]);
+  COMBA_MULADD2(a[9], a[10]);
+  r[19] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[9], a[11]);
+  COMBA_MULADD(a[10], a[10]);
+  r[20] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[10], a[11]);
+  r[21] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[11], a[11]);
+  r[22] = c0;
+  COMBA_SHIFT();
+  r[23] = c0;
+}
+
+static inline void bigint_comba_mont_12(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[12], t[13];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(q[0], m[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  COMBA_MULADD(a[2], b[0]);
+  q[2] = c0 * minv;
+  COMBA_MULADD(q[2], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(q[0], m[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(q[1], m[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(q[2], m[1]);
+  COMBA_MULADD(a[3], b[0]);
+  q[3] = c0 * minv;
+  COMBA_MULADD(q[3], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(q[0], m[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(q[1], m[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(q[2], m[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(q[3], m[1]);
+  COMBA_MULADD(a[4], b[0]);
+  q[4] = c0 * minv;
+  COMBA_MULADD(q[4], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(q[0], m[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(q[1], m[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(q[2], m[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(q[3], m[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(q[4], m[1]);
+  COMBA_MULADD(a[5], b[0]);
+  q[5] = c0 * minv;
+  COMBA_MULADD(q[5], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(q[0], m[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(q[1], m[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(q[2], m[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(q[3], m[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(q[4], m[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(q[5], m[1]);
+  COMBA_MULADD(a[6], b[0]);
+  q[6] = c0 * minv;
+  COMBA_MULADD(q[6], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(q[0], m[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(q[1], m[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(q[2], m[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(q[3], m[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(q[4], m[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(q[5], m[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(q[6], m[1]);
+  COMBA_MULADD(a[7], b[0]);
+  q[7] = c0 * minv;
+  COMBA_MULADD(q[7], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(q[0], m[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(q[1], m[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(q[2], m[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(q[3], m[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(q[4], m[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(q[5], m[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(q[6], m[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(q[7], m[1]);
+  COMBA_MULADD(a[8], b[0]);
+  q[8] = c0 * minv;
+  COMBA_MULADD(q[8], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[9]);
+  COMBA_MULADD(q[0], m[9]);
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(q[1], m[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(q[2], m[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(q[3], m[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(q[4], m[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(q[5], m[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(q[6], m[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(q[7], m[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(q[8], m[1]);
+  COMBA_MULADD(a[9], b[0]);
+  q[9] = c0 * minv;
+  COMBA_MULADD(q[9], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[10]);
+  COMBA_MULADD(q[0], m[10]);
+  COMBA_MULADD(a[1], b[9]);
+  COMBA_MULADD(q[1], m[9]);
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(q[2], m[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(q[3], m[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(q[4], m[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(q[5], m[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(q[6], m[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(q[7], m[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(q[8], m[2]);
+  COMBA_MULADD(a[9], b[1]);
+  COMBA_MULADD(q[9], m[1]);
+  COMBA_MULADD(a[10], b[0]);
+  q[10] = c0 * minv;
+  COMBA_MULADD(q[10], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[11]);
+  COMBA_MULADD(q[0], m[11]);
+  COMBA_MULADD(a[1], b[10]);
+  COMBA_MULADD(q[1], m[10]);
+  COMBA_MULADD(a[2], b[9]);
+  COMBA_MULADD(q[2], m[9]);
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(q[3], m[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(q[4], m[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(q[5], m[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(q[6], m[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(q[7], m[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(q[8], m[3]);
+  COMBA_MULADD(a[9], b[2]);
+  COMBA_MULADD(q[9], m[2]);
+  COMBA_MULADD(a[10], b[1]);
+  COMBA_MULADD(q[10], m[1]);
+  COMBA_MULADD(a[11], b[0]);
+  q[11] = c0 * minv;
+  COMBA_MULADD(q[11], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[11]);
+  COMBA_MULADD(q[1], m[11]);
+  COMBA_MULADD(a[2], b[10]);
+  COMBA_MULADD(q[2], m[10]);
+  COMBA_MULADD(a[3], b[9]);
+  COMBA_MULADD(q[3], m[9]);
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(q[4], m[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(q[5], m[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(q[6], m[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(q[7], m[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(q[8], m[4]);
+  COMBA_MULADD(a[9], b[3]);
+  COMBA_MULADD(q[9], m[3]);
+  COMBA_MULADD(a[10], b[2]);
+  COMBA_MULADD(q[10], m[2]);
+  COMBA_MULADD(a[11], b[1]);
+  COMBA_MULADD(q[11], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[11]);
+  COMBA_MULADD(q[2], m[11]);
+  COMBA_MULADD(a[3], b[10]);
+  COMBA_MULADD(q[3], m[10]);
+  COMBA_MULADD(a[4], b[9]);
+  COMBA_MULADD(q[4], m[9]);
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(q[5], m[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(q[6], m[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(q[7], m[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(q[8], m[5]);
+  COMBA_MULADD(a[9], b[4]);
+  COMBA_MULADD(q[9], m[4]);
+  COMBA_MULADD(a[10], b[3]);
+  COMBA_MULADD(q[10], m[3]);
+  COMBA_MULADD(a[11], b[2]);
+  COMBA_MULADD(q[11], m[2]);
+  t[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[11]);
+  COMBA_MULADD(q[3], m[11]);
+  COMBA_MULADD(a[4], b[10]);
+  COMBA_MULADD(q[4], m[10]);
+  COMBA_MULADD(a[5], b[9]);
+  COMBA_MULADD(q[5], m[9]);
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(q[6], m[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(q[7], m[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(q[8], m[6]);
+  COMBA_MULADD(a[9], b[5]);
+  COMBA_MULADD(q[9], m[5]);
+  COMBA_MULADD(a[10], b[4]);
+  COMBA_MULADD(q[10], m[4]);
+  COMBA_MULADD(a[11], b[3]);
+  COMBA_MULADD(q[11], m[3]);
+  t[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[11]);
+  COMBA_MULADD(q[4], m[11]);
+  COMBA_MULADD(a[5], b[10]);
+  COMBA_MULADD(q[5], m[10]);
+  COMBA_MULADD(a[6], b[9]);
+  COMBA_MULADD(q[6], m[9]);
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(q[7], m[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(q[8], m[7]);
+  COMBA_MULADD(a[9], b[6]);
+  COMBA_MULADD(q[9], m[6]);
+  COMBA_MULADD(a[10], b[5]);
+  COMBA_MULADD(q[10], m[5]);
+  COMBA_MULADD(a[11], b[4]);
+  COMBA_MULADD(q[11], m[4]);
+  t[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[11]);
+  COMBA_MULADD(q[5], m[11]);
+  COMBA_MULADD(a[6], b[10]);
+  COMBA_MULADD(q[6], m[10]);
+  COMBA_MULADD(a[7], b[9]);
+  COMBA_MULADD(q[7], m[9]);
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(q[8], m[8]);
+  COMBA_MULADD(a[9], b[7]);
+  COMBA_MULADD(q[9], m[7]);
+  COMBA_MULADD(a[10], b[6]);
+  COMBA_MULADD(q[10], m[6]);
+  COMBA_MULADD(a[11], b[5]);
+  COMBA_MULADD(q[11], m[5]);
+  t[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[11]);
+  COMBA_MULADD(q[6], m[11]);
+  COMBA_MULADD(a[7], b[10]);
+  COMBA_MULADD(q[7], m[10]);
+  COMBA_MULADD(a[8], b[9]);
+  COMBA_MULADD(q[8], m[9]);
+  COMBA_MULADD(a[9], b[8]);
+  COMBA_MULADD(q[9], m[8]);
+  COMBA_MULADD(a[10], b[7]);
+  COMBA_MULADD(q[10], m[7]);
+  COMBA_MULADD(a[11], b[6]);
+  COMBA_MULADD(q[11], m[6]);
+  t[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[11]);
+  COMBA_MULADD(q[7], m[11]);
+  COMBA_MULADD(a[8], b[10]);
+  COMBA_MULADD(q[8], m[10]);
+  COMBA_MULADD(a[9], b[9]);
+  COMBA_MULADD(q[9], m[9]);
+  COMBA_MULADD(a[10], b[8]);
+  COMBA_MULADD(q[10], m[8]);
+  COMBA_MULADD(a[11], b[7]);
+  COMBA_MULADD(q[11], m[7]);
+  t[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[11]);
+  COMBA_MULADD(q[8], m[11]);
+  COMBA_MULADD(a[9], b[10]);
+  COMBA_MULADD(q[9], m[10]);
+  COMBA_MULADD(a[10], b[9]);
+  COMBA_MULADD(q[10], m[9]);
+  COMBA_MULADD(a[11], b[8]);
+  COMBA_MULADD(q[11], m[8]);
+  t[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], b[11]);
+  COMBA_MULADD(q[9], m[11]);
+  COMBA_MULADD(a[10], b[10]);
+  COMBA_MULADD(q[10], m[10]);
+  COMBA_MULADD(a[11], b[9]);
+  COMBA_MULADD(q[11], m[9]);
+  t[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[10], b[11]);
+  COMBA_MULADD(q[10], m[11]);
+  COMBA_MULADD(a[11], b[10]);
+  COMBA_MULADD(q[11], m[10]);
+  t[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[11], b[11]);
+  COMBA_MULADD(q[11], m[11]);
+  t[10] = c0;
+  COMBA_SHIFT();
+  t[11] = c0;
+  COMBA_SHIFT();
+  t[12] = c0;
+  bigint_comba_mont_finish(r, t, m, 12);
+}
+
+static inline void bigint_comba_mul_13(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(a[2], b[0]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(a[3], b[0]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(a[4], b[0]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(a[5], b[0]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(a[6], b[0]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(a[7], b[0]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(a[8], b[0]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[9]);
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(a[9], b[0]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[10]);
+  COMBA_MULADD(a[1], b[9]);
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(a[9], b[1]);
+  COMBA_MULADD(a[10], b[0]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[11]);
+  COMBA_MULADD(a[1], b[10]);
+  COMBA_MULADD(a[2], b[9]);
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(a[9], b[2]);
+  COMBA_MULADD(a[10], b[1]);
+  COMBA_MULADD(a[11], b[0]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[12]);
+  COMBA_MULADD(a[1], b[11]);
+  COMBA_MULADD(a[2], b[10]);
+  COMBA_MULADD(a[3], b[9]);
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(a[9], b[3]);
+  COMBA_MULADD(a[10], b[2]);
+  COMBA_MULADD(a[11], b[1]);
+  COMBA_MULADD(a[12], b[0]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[12]);
+  COMBA_MULADD(a[2], b[11]);
+  COMBA_MULADD(a[3], b[10]);
+  COMBA_MULADD(a[4], b[9]);
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(a[9], b[4]);
+  COMBA_MULADD(a[10], b[3]);
+  COMBA_MULADD(a[11], b[2]);
+  COMBA_MULADD(a[12], b[1]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[12]);
+  COMBA_MULADD(a[3], b[11]);
+  COMBA_MULADD(a[4], b[10]);
+  COMBA_MULADD(a[5], b[9]);
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(a[9], b[5]);
+  COMBA_MULADD(a[10], b[4]);
+  COMBA_MULADD(a[11], b[3]);
+  COMBA_MULADD(a[12], b[2]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[12]);
+  COMBA_MULADD(a[4], b[11]);
+  COMBA_MULADD(a[5], b[10]);
+  COMBA_MULADD(a[6], b[9]);
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(a[9], b[6]);
+  COMBA_MULADD(a[10], b[5]);
+  COMBA_MULADD(a[11], b[4]);
+  COMBA_MULADD(a[12], b[3]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[12]);
+  COMBA_MULADD(a[5], b[11]);
+  COMBA_MULADD(a[6], b[10]);
+  COMBA_MULADD(a[7], b[9]);
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(a[9], b[7]);
+  COMBA_MULADD(a[10], b[6]);
+  COMBA_MULADD(a[11], b[5]);
+  COMBA_MULADD(a[12], b[4]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[12]);
+  COMBA_MULADD(a[6], b[11]);
+  COMBA_MULADD(a[7], b[10]);
+  COMBA_MULADD(a[8], b[9]);
+  COMBA_MULADD(a[9], b[8]);
+  COMBA_MULADD(a[10], b[7]);
+  COMBA_MULADD(a[11], b[6]);
+  COMBA_MULADD(a[12], b[5]);
+  r[17] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[12]);
+  COMBA_MULADD(a[7], b[11]);
+  COMBA_MULADD(a[8], b[10]);
+  COMBA_MULADD(a[9], b[9]);
+  COMBA_MULADD(a[10], b[8]);
+  COMBA_MULADD(a[11], b[7]);
+  COMBA_MULADD(a[12], b[6]);
+  r[18] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[12]);
+  COMBA_MULADD(a[8], b[11]);
+  COMBA_MULADD(a[9], b[10]);
+  COMBA_MULADD(a[10], b[9]);
+  COMBA_MULADD(a[11], b[8]);
+  COMBA_MULADD(a[12], b[7]);
+  r[19] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[12]);
+  COMBA_MULADD(a[9], b[11]);
+  COMBA_MULADD(a[10], b[10]);
+  COMBA_MULADD(a[11], b[9]);
+  COMBA_MULADD(a[12], b[8]);
+  r[20] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], b[12]);
+  COMBA_MULADD(a[10], b[11]);
+  COMBA_MULADD(a[11], b[10]);
+  COMBA_MULADD(a[12], b[9]);
+  r[21] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[10], b[12]);
+  COMBA_MULADD(a[11], b[11]);
+  COMBA_MULADD(a[12], b[10]);
+  r[22] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[11], b[12]);
+  COMBA_MULADD(a[12], b[11]);
+  r[23] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[12], b[12]);
+  r[24] = c0;
+  COMBA_SHIFT();
+  r[25] = c0;
+}
+
+static inline void bigint_comba_sqr_13(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[2]);
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[3]);
+  COMBA_MULADD2(a[1], a[2]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[4]);
+  COMBA_MULADD2(a[1], a[3]);
+  COMBA_MULADD(a[2], a[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[5]);
+  COMBA_MULADD2(a[1], a[4]);
+  COMBA_MULADD2(a[2], a[3]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[6]);
+  COMBA_MULADD2(a[1], a[5]);
+  COMBA_MULADD2(a[2], a[4]);
+  COMBA_MULADD(a[3], a[3]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[7]);
+  COMBA_MULADD2(a[1], a[6]);
+  COMBA_MULADD2(a[2], a[5]);
+  COMBA_MULADD2(a[3], a[4]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[8]);
+  COMBA_MULADD2(a[1], a[7]);
+  COMBA_MULADD2(a[2], a[6]);
+  COMBA_MULADD2(a[3], a[5]);
+  COMBA_MULADD(a[4], a[4]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[9]);
+  COMBA_MULADD2(a[1], a[8]);
+  COMBA_MULADD2(a[2], a[7]);
+  COMBA_MULADD2(a[3], a[6]);
+  COMBA_MULADD2(a[4], a[5]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[10]);
+  COMBA_MULADD2(a[1], a[9]);
+  COMBA_MULADD2(a[2], a[8]);
+  COMBA_MULADD2(a[3], a[7]);
+  COMBA_MULADD2(a[4], a[6]);
+  COMBA_MULADD(a[5], a[5]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[11]);
+  COMBA_MULADD2(a[1], a[10]);
+  COMBA_MULADD2(a[2], a[9]);
+  COMBA_MULADD2(a[3], a[8]);
+  COMBA_MULADD2(a[4], a[7]);
+  COMBA_MULADD2(a[5], a[6]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[12]);
+  COMBA_MULADD2(a[1], a[11]);
+  COMBA_MULADD2(a[2], a[10]);
+  COMBA_MULADD2(a[3], a[9]);
+  COMBA_MULADD2(a[4], a[8]);
+  COMBA_MULADD2(a[5], a[7]);
+  COMBA_MULADD(a[6], a[6]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[1], a[12]);
+  COMBA_MULADD2(a[2], a[11]);
+  COMBA_MULADD2(a[3], a[10]);
+  COMBA_MULADD2(a[4], a[9]);
+  COMBA_MULADD2(a[5], a[8]);
+  COMBA_MULADD2(a[6], a[7]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[2], a[12]);
+  COMBA_MULADD2(a[3], a[11]);
+  COMBA_MULADD2(a[4], a[10]);
+  COMBA_MULADD2(a[5], a[9]);
+  COMBA_MULADD2(a[6], a[8]);
+  COMBA_MULADD(a[7], a[7]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[3], a[12]);
+  COMBA_MULADD2(a[4], a[11]);
+  COMBA_MULADD2(a[5], a[10]);
+  COMBA_MULADD2(a[6], a[9]);
+  COMBA_MULADD2(a[7], a[8]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[4], a[12]);
+  COMBA_MULADD2(a[5], a[11]);
+  COMBA_MULADD2(a[6], a[10]);
+  COMBA_MULADD2(a[7], a[9]);
+  COMBA_MULADD(a[8], a[8]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[5], a[12]);
+  COMBA_MULADD2(a[6], a[11]);
+  COMBA_MULADD2(a[7], a[10]);
+  COMBA_MULADD2(a[8], a[9]);
+  r[17] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[6], a[12]);
+  COMBA_MULADD2(a[7], a[11]);
+  COMBA_MULADD2(a[8], a[10]);
+  COMBA_MULADD(a[9], a[9]);
+  r[18] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[7], a[12]);
+  COMBA_MULADD2(a[8], a[11]);
+  COMBA_MULADD2(a[9], a[10]);
+  r[19] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[8], a[12]);
+  COMBA_MULADD2(a[9], a[11]);
+  COMBA_MULADD(a[10], a[10]);
+  r[20] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[9], a[12]);
+  COMBA_MULADD2(a[10], a[11]);
+  r[21] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[10], a[12]);
+  COMBA_MULADD(a[11], a[11]);
+  r[22] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[11], a[12]);
+  r[23] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[12], a[12]);
+  r[24] = c0;
+  COMBA_SHIFT();
+  r[25] = c0;
+}
+
+static inline void bigint_comba_mont_13(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[13], t[14];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(q[0], m[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  COMBA_MULADD(a[2], b[0]);
+  q[2] = c0 * minv;
+  COMBA_MULADD(q[2], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(q[0], m[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(q[1], m[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(q[2], m[1]);
+  COMBA_MULADD(a[3], b[0]);
+  q[3] = c0 * minv;
+  COMBA_MULADD(q[3], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(q[0], m[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(q[1], m[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(q[2], m[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(q[3], m[1]);
+  COMBA_MULADD(a[4], b[0]);
+  q[4] = c0 * minv;
+  COMBA_MULADD(q[4], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(q[0], m[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(q[1], m[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(q[2], m[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(q[3], m[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(q[4], m[1]);
+  COMBA_MULADD(a[5], b[0]);
+  q[5] = c0 * minv;
+  COMBA_MULADD(q[5], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(q[0], m[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(q[1], m[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(q[2], m[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(q[3], m[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(q[4], m[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(q[5], m[1]);
+  COMBA_MULADD(a[6], b[0]);
+  q[6] = c0 * minv;
+  COMBA_MULADD(q[6], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(q[0], m[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(q[1], m[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(q[2], m[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(q[3], m[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(q[4], m[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(q[5], m[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(q[6], m[1]);
+  COMBA_MULADD(a[7], b[0]);
+  q[7] = c0 * minv;
+  COMBA_MULADD(q[7], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(q[0], m[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(q[1], m[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(q[2], m[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(q[3], m[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(q[4], m[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(q[5], m[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(q[6], m[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(q[7], m[1]);
+  COMBA_MULADD(a[8], b[0]);
+  q[8] = c0 * minv;
+  COMBA_MULADD(q[8], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[9]);
+  COMBA_MULADD(q[0], m[9]);
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(q[1], m[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(q[2], m[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(q[3], m[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(q[4], m[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(q[5], m[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(q[6], m[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(q[7], m[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(q[8], m[1]);
+  COMBA_MULADD(a[9], b[0]);
+  q[9] = c0 * minv;
+  COMBA_MULADD(q[9], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[10]);
+  COMBA_MULADD(q[0], m[10]);
+  COMBA_MULADD(a[1], b[9]);
+  COMBA_MULADD(q[1], m[9]);
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(q[2], m[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(q[3], m[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(q[4], m[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(q[5], m[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(q[6], m[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(q[7], m[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(q[8], m[2]);
+  COMBA_MULADD(a[9], b[1]);
+  COMBA_MULADD(q[9], m[1]);
+  COMBA_MULADD(a[10], b[0]);
+  q[10] = c0 * minv;
+  COMBA_MULADD(q[10], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[11]);
+  COMBA_MULADD(q[0], m[11]);
+  COMBA_MULADD(a[1], b[10]);
+  COMBA_MULADD(q[1], m[10]);
+  COMBA_MULADD(a[2], b[9]);
+  COMBA_MULADD(q[2], m[9]);
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(q[3], m[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(q[4], m[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(q[5], m[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(q[6], m[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(q[7], m[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(q[8], m[3]);
+  COMBA_MULADD(a[9], b[2]);
+  COMBA_MULADD(q[9], m[2]);
+  COMBA_MULADD(a[10], b[1]);
+  COMBA_MULADD(q[10], m[1]);
+  COMBA_MULADD(a[11], b[0]);
+  q[11] = c0 * minv;
+  COMBA_MULADD(q[11], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[12]);
+  COMBA_MULADD(q[0], m[12]);
+  COMBA_MULADD(a[1], b[11]);
+  COMBA_MULADD(q[1], m[11]);
+  COMBA_MULADD(a[2], b[10]);
+  COMBA_MULADD(q[2], m[10]);
+  COMBA_MULADD(a[3], b[9]);
+  COMBA_MULADD(q[3], m[9]);
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(q[4], m[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(q[5], m[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(q[6], m[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(q[7], m[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(q[8], m[4]);
+  COMBA_MULADD(a[9], b[3]);
+  COMBA_MULADD(q[9], m[3]);
+  COMBA_MULADD(a[10], b[2]);
+  COMBA_MULADD(q[10], m[2]);
+  COMBA_MULADD(a[11], b[1]);
+  COMBA_MULADD(q[11], m[1]);
+  COMBA_MULADD(a[12], b[0]);
+  q[12] = c0 * minv;
+  COMBA_MULADD(q[12], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[12]);
+  COMBA_MULADD(q[1], m[12]);
+  COMBA_MULADD(a[2], b[11]);
+  COMBA_MULADD(q[2], m[11]);
+  COMBA_MULADD(a[3], b[10]);
+  COMBA_MULADD(q[3], m[10]);
+  COMBA_MULADD(a[4], b[9]);
+  COMBA_MULADD(q[4], m[9]);
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(q[5], m[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(q[6], m[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(q[7], m[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(q[8], m[5]);
+  COMBA_MULADD(a[9], b[4]);
+  COMBA_MULADD(q[9], m[4]);
+  COMBA_MULADD(a[10], b[3]);
+  COMBA_MULADD(q[10], m[3]);
+  COMBA_MULADD(a[11], b[2]);
+  COMBA_MULADD(q[11], m[2]);
+  COMBA_MULADD(a[12], b[1]);
+  COMBA_MULADD(q[12], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[12]);
+  COMBA_MULADD(q[2], m[12]);
+  COMBA_MULADD(a[3], b[11]);
+  COMBA_MULADD(q[3], m[11]);
+  COMBA_MULADD(a[4], b[10]);
+  COMBA_MULADD(q[4], m[10]);
+  COMBA_MULADD(a[5], b[9]);
+  COMBA_MULADD(q[5], m[9]);
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(q[6], m[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(q[7], m[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(q[8], m[6]);
+  COMBA_MULADD(a[9], b[5]);
+  COMBA_MULADD(q[9], m[5]);
+  COMBA_MULADD(a[10], b[4]);
+  COMBA_MULADD(q[10], m[4]);
+  COMBA_MULADD(a[11], b[3]);
+  COMBA_MULADD(q[11], m[3]);
+  COMBA_MULADD(a[12], b[2]);
+  COMBA_MULADD(q[12], m[2]);
+  t[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[12]);
+  COMBA_MULADD(q[3], m[12]);
+  COMBA_MULADD(a[4], b[11]);
+  COMBA_MULADD(q[4], m[11]);
+  COMBA_MULADD(a[5], b[10]);
+  COMBA_MULADD(q[5], m[10]);
+  COMBA_MULADD(a[6], b[9]);
+  COMBA_MULADD(q[6], m[9]);
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(q[7], m[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(q[8], m[7]);
+  COMBA_MULADD(a[9], b[6]);
+  COMBA_MULADD(q[9], m[6]);
+  COMBA_MULADD(a[10], b[5]);
+  COMBA_MULADD(q[10], m[5]);
+  COMBA_MULADD(a[11], b[4]);
+  COMBA_MULADD(q[11], m[4]);
+  COMBA_MULADD(a[12], b[3]);
+  COMBA_MULADD(q[12], m[3]);
+  t[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[12]);
+  COMBA_MULADD(q[4], m[12]);
+  COMBA_MULADD(a[5], b[11]);
+  COMBA_MULADD(q[5], m[11]);
+  COMBA_MULADD(a[6], b[10]);
+  COMBA_MULADD(q[6], m[10]);
+  COMBA_MULADD(a[7], b[9]);
+  COMBA_MULADD(q[7], m[9]);
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(q[8], m[8]);
+  COMBA_MULADD(a[9], b[7]);
+  COMBA_MULADD(q[9], m[7]);
+  COMBA_MULADD(a[10], b[6]);
+  COMBA_MULADD(q[10], m[6]);
+  COMBA_MULADD(a[11], b[5]);
+  COMBA_MULADD(q[11], m[5]);
+  COMBA_MULADD(a[12], b[4]);
+  COMBA_MULADD(q[12], m[4]);
+  t[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[12]);
+  COMBA_MULADD(q[5], m[12]);
+  COMBA_MULADD(a[6], b[11]);
+  COMBA_MULADD(q[6], m[11]);
+  COMBA_MULADD(a[7], b[10]);
+  COMBA_MULADD(q[7], m[10]);
+  COMBA_MULADD(a[8], b[9]);
+  COMBA_MULADD(q[8], m[9]);
+  COMBA_MULADD(a[9], b[8]);
+  COMBA_MULADD(q[9], m[8]);
+  COMBA_MULADD(a[10], b[7]);
+  COMBA_MULADD(q[10], m[7]);
+  COMBA_MULADD(a[11], b[6]);
+  COMBA_MULADD(q[11], m[6]);
+  COMBA_MULADD(a[12], b[5]);
+  COMBA_MULADD(q[12], m[5]);
+  t[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[12]);
+  COMBA_MULADD(q[6], m[12]);
+  COMBA_MULADD(a[7], b[11]);
+  COMBA_MULADD(q[7], m[11]);
+  COMBA_MULADD(a[8], b[10]);
+  COMBA_MULADD(q[8], m[10]);
+  COMBA_MULADD(a[9], b[9]);
+  COMBA_MULADD(q[9], m[9]);
+  COMBA_MULADD(a[10], b[8]);
+  COMBA_MULADD(q[10], m[8]);
+  COMBA_MULADD(a[11], b[7]);
+  COMBA_MULADD(q[11], m[7]);
+  COMBA_MULADD(a[12], b[6]);
+  COMBA_MULADD(q[12], m[6]);
+  t[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[12]);
+  COMBA_MULADD(q[7], m[12]);
+  COMBA_MULADD(a[8], b[11]);
+  COMBA_MULADD(q[8], m[11]);
+  COMBA_MULADD(a[9], b[10]);
+  COMBA_MULADD(q[9], m[10]);
+  COMBA_MULADD(a[10], b[9]);
+  COMBA_MULADD(q[10], m[9]);
+  COMBA_MULADD(a[11], b[8]);
+  COMBA_MULADD(q[11], m[8]);
+  COMBA_MULADD(a[12], b[7]);
+  COMBA_MULADD(q[12], m[7]);
+  t[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[12]);
+  COMBA_MULADD(q[8], m[12]);
+  COMBA_MULADD(a[9], b[11]);
+  COMBA_MULADD(q[9], m[11]);
+  COMBA_MULADD(a[10], b[10]);
+  COMBA_MULADD(q[10], m[10]);
+  COMBA_MULADD(a[11], b[9]);
+  COMBA_MULADD(q[11], m[9]);
+  COMBA_MULADD(a[12], b[8]);
+  COMBA_MULADD(q[12], m[8]);
+  t[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], b[12]);
+  COMBA_MULADD(q[9], m[12]);
+  COMBA_MULADD(a[10], b[11]);
+  COMBA_MULADD(q[10], m[11]);
+  COMBA_MULADD(a[11], b[10]);
+  COMBA_MULADD(q[11], m[10]);
+  COMBA_MULADD(a[12], b[9]);
+  COMBA_MULADD(q[12], m[9]);
+  t[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[10], b[12]);
+  COMBA_MULADD(q[10], m[12]);
+  COMBA_MULADD(a[11], b[11]);
+  COMBA_MULADD(q[11], m[11]);
+  COMBA_MULADD(a[12], b[10]);
+  COMBA_MULADD(q[12], m[10]);
+  t[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[11], b[12]);
+  COMBA_MULADD(q[11], m[12]);
+  COMBA_MULADD(a[12], b[11]);
+  COMBA_MULADD(q[12], m[11]);
+  t[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[12], b[12]);
+  COMBA_MULADD(q[12], m[12]);
+  t[11] = c0;
+  COMBA_SHIFT();
+  t[12] = c0;
+  COMBA_SHIFT();
+  t[13] = c0;
+  bigint_comba_mont_finish(r, t, m, 13);
+}
+
+static inline void bigint_comba_mul_14(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(a[2], b[0]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(a[3], b[0]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(a[4], b[0]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(a[5], b[0]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(a[6], b[0]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(a[7], b[0]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(a[8], b[0]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[9]);
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(a[9], b[0]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[10]);
+  COMBA_MULADD(a[1], b[9]);
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(a[9], b[1]);
+  COMBA_MULADD(a[10], b[0]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[11]);
+  COMBA_MULADD(a[1], b[10]);
+  COMBA_MULADD(a[2], b[9]);
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(a[9], b[2]);
+  COMBA_MULADD(a[10], b[1]);
+  COMBA_MULADD(a[11], b[0]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[12]);
+  COMBA_MULADD(a[1], b[11]);
+  COMBA_MULADD(a[2], b[10]);
+  COMBA_MULADD(a[3], b[9]);
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(a[9], b[3]);
+  COMBA_MULADD(a[10], b[2]);
+  COMBA_MULADD(a[11], b[1]);
+  COMBA_MULADD(a[12], b[0]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[13]);
+  COMBA_MULADD(a[1], b[12]);
+  COMBA_MULADD(a[2], b[11]);
+  COMBA_MULADD(a[3], b[10]);
+  COMBA_MULADD(a[4], b[9]);
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(a[9], b[4]);
+  COMBA_MULADD(a[10], b[3]);
+  COMBA_MULADD(a[11], b[2]);
+  COMBA_MULADD(a[12], b[1]);
+  COMBA_MULADD(a[13], b[0]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[13]);
+  COMBA_MULADD(a[2], b[12]);
+  COMBA_MULADD(a[3], b[11]);
+  COMBA_MULADD(a[4], b[10]);
+  COMBA_MULADD(a[5], b[9]);
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(a[9], b[5]);
+  COMBA_MULADD(a[10], b[4]);
+  COMBA_MULADD(a[11], b[3]);
+  COMBA_MULADD(a[12], b[2]);
+  COMBA_MULADD(a[13], b[1]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[13]);
+  COMBA_MULADD(a[3], b[12]);
+  COMBA_MULADD(a[4], b[11]);
+  COMBA_MULADD(a[5], b[10]);
+  COMBA_MULADD(a[6], b[9]);
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(a[9], b[6]);
+  COMBA_MULADD(a[10], b[5]);
+  COMBA_MULADD(a[11], b[4]);
+  COMBA_MULADD(a[12], b[3]);
+  COMBA_MULADD(a[13], b[2]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[13]);
+  COMBA_MULADD(a[4], b[12]);
+  COMBA_MULADD(a[5], b[11]);
+  COMBA_MULADD(a[6], b[10]);
+  COMBA_MULADD(a[7], b[9]);
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(a[9], b[7]);
+  COMBA_MULADD(a[10], b[6]);
+  COMBA_MULADD(a[11], b[5]);
+  COMBA_MULADD(a[12], b[4]);
+  COMBA_MULADD(a[13], b[3]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[13]);
+  COMBA_MULADD(a[5], b[12]);
+  COMBA_MULADD(a[6], b[11]);
+  COMBA_MULADD(a[7], b[10]);
+  COMBA_MULADD(a[8], b[9]);
+  COMBA_MULADD(a[9], b[8]);
+  COMBA_MULADD(a[10], b[7]);
+  COMBA_MULADD(a[11], b[6]);
+  COMBA_MULADD(a[12], b[5]);
+  COMBA_MULADD(a[13], b[4]);
+  r[17] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[13]);
+  COMBA_MULADD(a[6], b[12]);
+  COMBA_MULADD(a[7], b[11]);
+  COMBA_MULADD(a[8], b[10]);
+  COMBA_MULADD(a[9], b[9]);
+  COMBA_MULADD(a[10], b[8]);
+  COMBA_MULADD(a[11], b[7]);
+  COMBA_MULADD(a[12], b[6]);
+  COMBA_MULADD(a[13], b[5]);
+  r[18] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[13]);
+  COMBA_MULADD(a[7], b[12]);
+  COMBA_MULADD(a[8], b[11]);
+  COMBA_MULADD(a[9], b[10]);
+  COMBA_MULADD(a[10], b[9]);
+  COMBA_MULADD(a[11], b[8]);
+  COMBA_MULADD(a[12], b[7]);
+  COMBA_MULADD(a[13], b[6]);
+  r[19] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[13]);
+  COMBA_MULADD(a[8], b[12]);
+  COMBA_MULADD(a[9], b[11]);
+  COMBA_MULADD(a[10], b[10]);
+  COMBA_MULADD(a[11], b[9]);
+  COMBA_MULADD(a[12], b[8]);
+  COMBA_MULADD(a[13], b[7]);
+  r[20] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[13]);
+  COMBA_MULADD(a[9], b[12]);
+  COMBA_MULADD(a[10], b[11]);
+  COMBA_MULADD(a[11], b[10]);
+  COMBA_MULADD(a[12], b[9]);
+  COMBA_MULADD(a[13], b[8]);
+  r[21] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], b[13]);
+  COMBA_MULADD(a[10], b[12]);
+  COMBA_MULADD(a[11], b[11]);
+  COMBA_MULADD(a[12], b[10]);
+  COMBA_MULADD(a[13], b[9]);
+  r[22] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[10], b[13]);
+  COMBA_MULADD(a[11], b[12]);
+  COMBA_MULADD(a[12], b[11]);
+  COMBA_MULADD(a[13], b[10]);
+  r[23] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[11], b[13]);
+  COMBA_MULADD(a[12], b[12]);
+  COMBA_MULADD(a[13], b[11]);
+  r[24] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[12], b[13]);
+  COMBA_MULADD(a[13], b[12]);
+  r[25] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[13], b[13]);
+  r[26] = c0;
+  COMBA_SHIFT();
+  r[27] = c0;
+}
+
+static inline void bigint_comba_sqr_14(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[2]);
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[3]);
+  COMBA_MULADD2(a[1], a[2]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[4]);
+  COMBA_MULADD2(a[1], a[3]);
+  COMBA_MULADD(a[2], a[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[5]);
+  COMBA_MULADD2(a[1], a[4]);
+  COMBA_MULADD2(a[2], a[3]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[6]);
+  COMBA_MULADD2(a[1], a[5]);
+  COMBA_MULADD2(a[2], a[4]);
+  COMBA_MULADD(a[3], a[3]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[7]);
+  COMBA_MULADD2(a[1], a[6]);
+  COMBA_MULADD2(a[2], a[5]);
+  COMBA_MULADD2(a[3], a[4]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[8]);
+  COMBA_MULADD2(a[1], a[7]);
+  COMBA_MULADD2(a[2], a[6]);
+  COMBA_MULADD2(a[3], a[5]);
+  COMBA_MULADD(a[4], a[4]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[9]);
+  COMBA_MULADD2(a[1], a[8]);
+  COMBA_MULADD2(a[2], a[7]);
+  COMBA_MULADD2(a[3], a[6]);
+  COMBA_MULADD2(a[4], a[5]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[10]);
+  COMBA_MULADD2(a[1], a[9]);
+  COMBA_MULADD2(a[2], a[8]);
+  COMBA_MULADD2(a[3], a[7]);
+  COMBA_MULADD2(a[4], a[6]);
+  COMBA_MULADD(a[5], a[5]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[11]);
+  COMBA_MULADD2(a[1], a[10]);
+  COMBA_MULADD2(a[2], a[9]);
+  COMBA_MULADD2(a[3], a[8]);
+  COMBA_MULADD2(a[4], a[7]);
+  COMBA_MULADD2(a[5], a[6]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[12]);
+  COMBA_MULADD2(a[1], a[11]);
+  COMBA_MULADD2(a[2], a[10]);
+  COMBA_MULADD2(a[3], a[9]);
+  COMBA_MULADD2(a[4], a[8]);
+  COMBA_MULADD2(a[5], a[7]);
+  COMBA_MULADD(a[6], a[6]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[13]);
+  COMBA_MULADD2(a[1], a[12]);
+  COMBA_MULADD2(a[2], a[11]);
+  COMBA_MULADD2(a[3], a[10]);
+  COMBA_MULADD2(a[4], a[9]);
+  COMBA_MULADD2(a[5], a[8]);
+  COMBA_MULADD2(a[6], a[7]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[1], a[13]);
+  COMBA_MULADD2(a[2], a[12]);
+  COMBA_MULADD2(a[3], a[11]);
+  COMBA_MULADD2(a[4], a[10]);
+  COMBA_MULADD2(a[5], a[9]);
+  COMBA_MULADD2(a[6], a[8]);
+  COMBA_MULADD(a[7], a[7]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[2], a[13]);
+  COMBA_MULADD2(a[3], a[12]);
+  COMBA_MULADD2(a[4], a[11]);
+  COMBA_MULADD2(a[5], a[10]);
+  COMBA_MULADD2(a[6], a[9]);
+  COMBA_MULADD2(a[7], a[8]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[3], a[13]);
+  COMBA_MULADD2(a[4], a[12]);
+  COMBA_MULADD2(a[5], a[11]);
+  COMBA_MULADD2(a[6], a[10]);
+  COMBA_MULADD2(a[7], a[9]);
+  COMBA_MULADD(a[8], a[8]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[4], a[13]);
+  COMBA_MULADD2(a[5], a[12]);
+  COMBA_MULADD2(a[6], a[11]);
+  COMBA_MULADD2(a[7], a[10]);
+  COMBA_MULADD2(a[8], a[9]);
+  r[17] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[5], a[13]);
+  COMBA_MULADD2(a[6], a[12]);
+  COMBA_MULADD2(a[7], a[11]);
+  COMBA_MULADD2(a[8], a[10]);
+  COMBA_MULADD(a[9], a[9]);
+  r[18] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[6], a[13]);
+  COMBA_MULADD2(a[7], a[12]);
+  COMBA_MULADD2(a[8], a[11]);
+  COMBA_MULADD2(a[9], a[10]);
+  r[19] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[7], a[13]);
+  COMBA_MULADD2(a[8], a[12]);
+  COMBA_MULADD2(a[9], a[11]);
+  COMBA_MULADD(a[10], a[10]);
+  r[20] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[8], a[13]);
+  COMBA_MULADD2(a[9], a[12]);
+  COMBA_MULADD2(a[10], a[11]);
+  r[21] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[9], a[13]);
+  COMBA_MULADD2(a[10], a[12]);
+  COMBA_MULADD(a[11], a[11]);
+  r[22] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[10], a[13]);
+  COMBA_MULADD2(a[11], a[12]);
+  r[23] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[11], a[13]);
+  COMBA_MULADD(a[12], a[12]);
+  r[24] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[12], a[13]);
+  r[25] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[13], a[13]);
+  r[26] = c0;
+  COMBA_SHIFT();
+  r[27] = c0;
+}
+
+static inline void bigint_comba_mont_14(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[14], t[15];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(q[0], m[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  COMBA_MULADD(a[2], b[0]);
+  q[2] = c0 * minv;
+  COMBA_MULADD(q[2], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(q[0], m[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(q[1], m[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(q[2], m[1]);
+  COMBA_MULADD(a[3], b[0]);
+  q[3] = c0 * minv;
+  COMBA_MULADD(q[3], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(q[0], m[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(q[1], m[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(q[2], m[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(q[3], m[1]);
+  COMBA_MULADD(a[4], b[0]);
+  q[4] = c0 * minv;
+  COMBA_MULADD(q[4], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(q[0], m[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(q[1], m[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(q[2], m[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(q[3], m[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(q[4], m[1]);
+  COMBA_MULADD(a[5], b[0]);
+  q[5] = c0 * minv;
+  COMBA_MULADD(q[5], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(q[0], m[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(q[1], m[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(q[2], m[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(q[3], m[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(q[4], m[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(q[5], m[1]);
+  COMBA_MULADD(a[6], b[0]);
+  q[6] = c0 * minv;
+  COMBA_MULADD(q[6], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(q[0], m[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(q[1], m[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(q[2], m[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(q[3], m[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(q[4], m[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(q[5], m[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(q[6], m[1]);
+  COMBA_MULADD(a[7], b[0]);
+  q[7] = c0 * minv;
+  COMBA_MULADD(q[7], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(q[0], m[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(q[1], m[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(q[2], m[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(q[3], m[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(q[4], m[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(q[5], m[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(q[6], m[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(q[7], m[1]);
+  COMBA_MULADD(a[8], b[0]);
+  q[8] = c0 * minv;
+  COMBA_MULADD(q[8], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[9]);
+  COMBA_MULADD(q[0], m[9]);
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(q[1], m[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(q[2], m[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(q[3], m[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(q[4], m[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(q[5], m[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(q[6], m[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(q[7], m[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(q[8], m[1]);
+  COMBA_MULADD(a[9], b[0]);
+  q[9] = c0 * minv;
+  COMBA_MULADD(q[9], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[10]);
+  COMBA_MULADD(q[0], m[10]);
+  COMBA_MULADD(a[1], b[9]);
+  COMBA_MULADD(q[1], m[9]);
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(q[2], m[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(q[3], m[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(q[4], m[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(q[5], m[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(q[6], m[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(q[7], m[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(q[8], m[2]);
+  COMBA_MULADD(a[9], b[1]);
+  COMBA_MULADD(q[9], m[1]);
+  COMBA_MULADD(a[10], b[0]);
+  q[10] = c0 * minv;
+  COMBA_MULADD(q[10], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[11]);
+  COMBA_MULADD(q[0], m[11]);
+  COMBA_MULADD(a[1], b[10]);
+  COMBA_MULADD(q[1], m[10]);
+  COMBA_MULADD(a[2], b[9]);
+  COMBA_MULADD(q[2], m[9]);
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(q[3], m[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(q[4], m[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(q[5], m[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(q[6], m[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(q[7], m[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(q[8], m[3]);
+  COMBA_MULADD(a[9], b[2]);
+  COMBA_MULADD(q[9], m[2]);
+  COMBA_MULADD(a[10], b[1]);
+  COMBA_MULADD(q[10], m[1]);
+  COMBA_MULADD(a[11], b[0]);
+  q[11] = c0 * minv;
+  COMBA_MULADD(q[11], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[12]);
+  COMBA_MULADD(q[0], m[12]);
+  COMBA_MULADD(a[1], b[11]);
+  COMBA_MULADD(q[1], m[11]);
+  COMBA_MULADD(a[2], b[10]);
+  COMBA_MULADD(q[2], m[10]);
+  COMBA_MULADD(a[3], b[9]);
+  COMBA_MULADD(q[3], m[9]);
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(q[4], m[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(q[5], m[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(q[6], m[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(q[7], m[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(q[8], m[4]);
+  COMBA_MULADD(a[9], b[3]);
+  COMBA_MULADD(q[9], m[3]);
+  COMBA_MULADD(a[10], b[2]);
+  COMBA_MULADD(q[10], m[2]);
+  COMBA_MULADD(a[11], b[1]);
+  COMBA_MULADD(q[11], m[1]);
+  COMBA_MULADD(a[12], b[0]);
+  q[12] = c0 * minv;
+  COMBA_MULADD(q[12], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[13]);
+  COMBA_MULADD(q[0], m[13]);
+  COMBA_MULADD(a[1], b[12]);
+  COMBA_MULADD(q[1], m[12]);
+  COMBA_MULADD(a[2], b[11]);
+  COMBA_MULADD(q[2], m[11]);
+  COMBA_MULADD(a[3], b[10]);
+  COMBA_MULADD(q[3], m[10]);
+  COMBA_MULADD(a[4], b[9]);
+  COMBA_MULADD(q[4], m[9]);
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(q[5], m[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(q[6], m[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(q[7], m[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(q[8], m[5]);
+  COMBA_MULADD(a[9], b[4]);
+  COMBA_MULADD(q[9], m[4]);
+  COMBA_MULADD(a[10], b[3]);
+  COMBA_MULADD(q[10], m[3]);
+  COMBA_MULADD(a[11], b[2]);
+  COMBA_MULADD(q[11], m[2]);
+  COMBA_MULADD(a[12], b[1]);
+  COMBA_MULADD(q[12], m[1]);
+  COMBA_MULADD(a[13], b[0]);
+  q[13] = c0 * minv;
+  COMBA_MULADD(q[13], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[13]);
+  COMBA_MULADD(q[1], m[13]);
+  COMBA_MULADD(a[2], b[12]);
+  COMBA_MULADD(q[2], m[12]);
+  COMBA_MULADD(a[3], b[11]);
+  COMBA_MULADD(q[3], m[11]);
+  COMBA_MULADD(a[4], b[10]);
+  COMBA_MULADD(q[4], m[10]);
+  COMBA_MULADD(a[5], b[9]);
+  COMBA_MULADD(q[5], m[9]);
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(q[6], m[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(q[7], m[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(q[8], m[6]);
+  COMBA_MULADD(a[9], b[5]);
+  COMBA_MULADD(q[9], m[5]);
+  COMBA_MULADD(a[10], b[4]);
+  COMBA_MULADD(q[10], m[4]);
+  COMBA_MULADD(a[11], b[3]);
+  COMBA_MULADD(q[11], m[3]);
+  COMBA_MULADD(a[12], b[2]);
+  COMBA_MULADD(q[12], m[2]);
+  COMBA_MULADD(a[13], b[1]);
+  COMBA_MULADD(q[13], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[13]);
+  COMBA_MULADD(q[2], m[13]);
+  COMBA_MULADD(a[3], b[12]);
+  COMBA_MULADD(q[3], m[12]);
+  COMBA_MULADD(a[4], b[11]);
+  COMBA_MULADD(q[4], m[11]);
+  COMBA_MULADD(a[5], b[10]);
+  COMBA_MULADD(q[5], m[10]);
+  COMBA_MULADD(a[6], b[9]);
+  COMBA_MULADD(q[6], m[9]);
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(q[7], m[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(q[8], m[7]);
+  COMBA_MULADD(a[9], b[6]);
+  COMBA_MULADD(q[9], m[6]);
+  COMBA_MULADD(a[10], b[5]);
+  COMBA_MULADD(q[10], m[5]);
+  COMBA_MULADD(a[11], b[4]);
+  COMBA_MULADD(q[11], m[4]);
+  COMBA_MULADD(a[12], b[3]);
+  COMBA_MULADD(q[12], m[3]);
+  COMBA_MULADD(a[13], b[2]);
+  COMBA_MULADD(q[13], m[2]);
+  t[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[13]);
+  COMBA_MULADD(q[3], m[13]);
+  COMBA_MULADD(a[4], b[12]);
+  COMBA_MULADD(q[4], m[12]);
+  COMBA_MULADD(a[5], b[11]);
+  COMBA_MULADD(q[5], m[11]);
+  COMBA_MULADD(a[6], b[10]);
+  COMBA_MULADD(q[6], m[10]);
+  COMBA_MULADD(a[7], b[9]);
+  COMBA_MULADD(q[7], m[9]);
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(q[8], m[8]);
+  COMBA_MULADD(a[9], b[7]);
+  COMBA_MULADD(q[9], m[7]);
+  COMBA_MULADD(a[10], b[6]);
+  COMBA_MULADD(q[10], m[6]);
+  COMBA_MULADD(a[11], b[5]);
+  COMBA_MULADD(q[11], m[5]);
+  COMBA_MULADD(a[12], b[4]);
+  COMBA_MULADD(q[12], m[4]);
+  COMBA_MULADD(a[13], b[3]);
+  COMBA_MULADD(q[13], m[3]);
+  t[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[13]);
+  COMBA_MULADD(q[4], m[13]);
+  COMBA_MULADD(a[5], b[12]);
+  COMBA_MULADD(q[5], m[12]);
+  COMBA_MULADD(a[6], b[11]);
+  COMBA_MULADD(q[6], m[11]);
+  COMBA_MULADD(a[7], b[10]);
+  COMBA_MULADD(q[7], m[10]);
+  COMBA_MULADD(a[8], b[9]);
+  COMBA_MULADD(q[8], m[9]);
+  COMBA_MULADD(a[9], b[8]);
+  COMBA_MULADD(q[9], m[8]);
+  COMBA_MULADD(a[10], b[7]);
+  COMBA_MULADD(q[10], m[7]);
+  COMBA_MULADD(a[11], b[6]);
+  COMBA_MULADD(q[11], m[6]);
+  COMBA_MULADD(a[12], b[5]);
+  COMBA_MULADD(q[12], m[5]);
+  COMBA_MULADD(a[13], b[4]);
+  COMBA_MULADD(q[13], m[4]);
+  t[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[13]);
+  COMBA_MULADD(q[5], m[13]);
+  COMBA_MULADD(a[6], b[12]);
+  COMBA_MULADD(q[6], m[12]);
+  COMBA_MULADD(a[7], b[11]);
+  COMBA_MULADD(q[7], m[11]);
+  COMBA_MULADD(a[8], b[10]);
+  COMBA_MULADD(q[8], m[10]);
+  COMBA_MULADD(a[9], b[9]);
+  COMBA_MULADD(q[9], m[9]);
+  COMBA_MULADD(a[10], b[8]);
+  COMBA_MULADD(q[10], m[8]);
+  COMBA_MULADD(a[11], b[7]);
+  COMBA_MULADD(q[11], m[7]);
+  COMBA_MULADD(a[12], b[6]);
+  COMBA_MULADD(q[12], m[6]);
+  COMBA_MULADD(a[13], b[5]);
+  COMBA_MULADD(q[13], m[5]);
+  t[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[13]);
+  COMBA_MULADD(q[6], m[13]);
+  COMBA_MULADD(a[7], b[12]);
+  COMBA_MULADD(q[7], m[12]);
+  COMBA_MULADD(a[8], b[11]);
+  COMBA_MULADD(q[8], m[11]);
+  COMBA_MULADD(a[9], b[10]);
+  COMBA_MULADD(q[9], m[10]);
+  COMBA_MULADD(a[10], b[9]);
+  COMBA_MULADD(q[10], m[9]);
+  COMBA_MULADD(a[11], b[8]);
+  COMBA_MULADD(q[11], m[8]);
+  COMBA_MULADD(a[12], b[7]);
+  COMBA_MULADD(q[12], m[7]);
+  COMBA_MULADD(a[13], b[6]);
+  COMBA_MULADD(q[13], m[6]);
+  t[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[13]);
+  COMBA_MULADD(q[7], m[13]);
+  COMBA_MULADD(a[8], b[12]);
+  COMBA_MULADD(q[8], m[12]);
+  COMBA_MULADD(a[9], b[11]);
+  COMBA_MULADD(q[9], m[11]);
+  COMBA_MULADD(a[10], b[10]);
+  COMBA_MULADD(q[10], m[10]);
+  COMBA_MULADD(a[11], b[9]);
+  COMBA_MULADD(q[11], m[9]);
+  COMBA_MULADD(a[12], b[8]);
+  COMBA_MULADD(q[12], m[8]);
+  COMBA_MULADD(a[13], b[7]);
+  COMBA_MULADD(q[13], m[7]);
+  t[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[13]);
+  COMBA_MULADD(q[8], m[13]);
+  COMBA_MULADD(a[9], b[12]);
+  COMBA_MULADD(q[9], m[12]);
+  COMBA_MULADD(a[10], b[11]);
+  COMBA_MULADD(q[10], m[11]);
+  COMBA_MULADD(a[11], b[10]);
+  COMBA_MULADD(q[11], m[10]);
+  COMBA_MULADD(a[12], b[9]);
+  COMBA_MULADD(q[12], m[9]);
+  COMBA_MULADD(a[13], b[8]);
+  COMBA_MULADD(q[13], m[8]);
+  t[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], b[13]);
+  COMBA_MULADD(q[9], m[13]);
+  COMBA_MULADD(a[10], b[12]);
+  COMBA_MULADD(q[10], m[12]);
+  COMBA_MULADD(a[11], b[11]);
+  COMBA_MULADD(q[11], m[11]);
+  COMBA_MULADD(a[12], b[10]);
+  COMBA_MULADD(q[12], m[10]);
+  COMBA_MULADD(a[13], b[9]);
+  COMBA_MULADD(q[13], m[9]);
+  t[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[10], b[13]);
+  COMBA_MULADD(q[10], m[13]);
+  COMBA_MULADD(a[11], b[12]);
+  COMBA_MULADD(q[11], m[12]);
+  COMBA_MULADD(a[12], b[11]);
+  COMBA_MULADD(q[12], m[11]);
+  COMBA_MULADD(a[13], b[10]);
+  COMBA_MULADD(q[13], m[10]);
+  t[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[11], b[13]);
+  COMBA_MULADD(q[11], m[13]);
+  COMBA_MULADD(a[12], b[12]);
+  COMBA_MULADD(q[12], m[12]);
+  COMBA_MULADD(a[13], b[11]);
+  COMBA_MULADD(q[13], m[11]);
+  t[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[12], b[13]);
+  COMBA_MULADD(q[12], m[13]);
+  COMBA_MULADD(a[13], b[12]);
+  COMBA_MULADD(q[13], m[12]);
+  t[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[13], b[13]);
+  COMBA_MULADD(q[13], m[13]);
+  t[12] = c0;
+  COMBA_SHIFT();
+  t[13] = c0;
+  COMBA_SHIFT();
+  t[14] = c0;
+  bigint_comba_mont_finish(r, t, m, 14);
+}
+
+static inline void bigint_comba_mul_15(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(a[2], b[0]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(a[3], b[0]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(a[4], b[0]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(a[5], b[0]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(a[6], b[0]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(a[7], b[0]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(a[8], b[0]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[9]);
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(a[9], b[0]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[10]);
+  COMBA_MULADD(a[1], b[9]);
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(a[9], b[1]);
+  COMBA_MULADD(a[10], b[0]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[11]);
+  COMBA_MULADD(a[1], b[10]);
+  COMBA_MULADD(a[2], b[9]);
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(a[9], b[2]);
+  COMBA_MULADD(a[10], b[1]);
+  COMBA_MULADD(a[11], b[0]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[12]);
+  COMBA_MULADD(a[1], b[11]);
+  COMBA_MULADD(a[2], b[10]);
+  COMBA_MULADD(a[3], b[9]);
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(a[9], b[3]);
+  COMBA_MULADD(a[10], b[2]);
+  COMBA_MULADD(a[11], b[1]);
+  COMBA_MULADD(a[12], b[0]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[13]);
+  COMBA_MULADD(a[1], b[12]);
+  COMBA_MULADD(a[2], b[11]);
+  COMBA_MULADD(a[3], b[10]);
+  COMBA_MULADD(a[4], b[9]);
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(a[9], b[4]);
+  COMBA_MULADD(a[10], b[3]);
+  COMBA_MULADD(a[11], b[2]);
+  COMBA_MULADD(a[12], b[1]);
+  COMBA_MULADD(a[13], b[0]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[14]);
+  COMBA_MULADD(a[1], b[13]);
+  COMBA_MULADD(a[2], b[12]);
+  COMBA_MULADD(a[3], b[11]);
+  COMBA_MULADD(a[4], b[10]);
+  COMBA_MULADD(a[5], b[9]);
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(a[9], b[5]);
+  COMBA_MULADD(a[10], b[4]);
+  COMBA_MULADD(a[11], b[3]);
+  COMBA_MULADD(a[12], b[2]);
+  COMBA_MULADD(a[13], b[1]);
+  COMBA_MULADD(a[14], b[0]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[14]);
+  COMBA_MULADD(a[2], b[13]);
+  COMBA_MULADD(a[3], b[12]);
+  COMBA_MULADD(a[4], b[11]);
+  COMBA_MULADD(a[5], b[10]);
+  COMBA_MULADD(a[6], b[9]);
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(a[9], b[6]);
+  COMBA_MULADD(a[10], b[5]);
+  COMBA_MULADD(a[11], b[4]);
+  COMBA_MULADD(a[12], b[3]);
+  COMBA_MULADD(a[13], b[2]);
+  COMBA_MULADD(a[14], b[1]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[14]);
+  COMBA_MULADD(a[3], b[13]);
+  COMBA_MULADD(a[4], b[12]);
+  COMBA_MULADD(a[5], b[11]);
+  COMBA_MULADD(a[6], b[10]);
+  COMBA_MULADD(a[7], b[9]);
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(a[9], b[7]);
+  COMBA_MULADD(a[10], b[6]);
+  COMBA_MULADD(a[11], b[5]);
+  COMBA_MULADD(a[12], b[4]);
+  COMBA_MULADD(a[13], b[3]);
+  COMBA_MULADD(a[14], b[2]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[14]);
+  COMBA_MULADD(a[4], b[13]);
+  COMBA_MULADD(a[5], b[12]);
+  COMBA_MULADD(a[6], b[11]);
+  COMBA_MULADD(a[7], b[10]);
+  COMBA_MULADD(a[8], b[9]);
+  COMBA_MULADD(a[9], b[8]);
+  COMBA_MULADD(a[10], b[7]);
+  COMBA_MULADD(a[11], b[6]);
+  COMBA_MULADD(a[12], b[5]);
+  COMBA_MULADD(a[13], b[4]);
+  COMBA_MULADD(a[14], b[3]);
+  r[17] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[14]);
+  COMBA_MULADD(a[5], b[13]);
+  COMBA_MULADD(a[6], b[12]);
+  COMBA_MULADD(a[7], b[11]);
+  COMBA_MULADD(a[8], b[10]);
+  COMBA_MULADD(a[9], b[9]);
+  COMBA_MULADD(a[10], b[8]);
+  COMBA_MULADD(a[11], b[7]);
+  COMBA_MULADD(a[12], b[6]);
+  COMBA_MULADD(a[13], b[5]);
+  COMBA_MULADD(a[14], b[4]);
+  r[18] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[14]);
+  COMBA_MULADD(a[6], b[13]);
+  COMBA_MULADD(a[7], b[12]);
+  COMBA_MULADD(a[8], b[11]);
+  COMBA_MULADD(a[9], b[10]);
+  COMBA_MULADD(a[10], b[9]);
+  COMBA_MULADD(a[11], b[8]);
+  COMBA_MULADD(a[12], b[7]);
+  COMBA_MULADD(a[13], b[6]);
+  COMBA_MULADD(a[14], b[5]);
+  r[19] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[14]);
+  COMBA_MULADD(a[7], b[13]);
+  COMBA_MULADD(a[8], b[12]);
+  COMBA_MULADD(a[9], b[11]);
+  COMBA_MULADD(a[10], b[10]);
+  COMBA_MULADD(a[11], b[9]);
+  COMBA_MULADD(a[12], b[8]);
+  COMBA_MULADD(a[13], b[7]);
+  COMBA_MULADD(a[14], b[6]);
+  r[20] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[14]);
+  COMBA_MULADD(a[8], b[13]);
+  COMBA_MULADD(a[9], b[12]);
+  COMBA_MULADD(a[10], b[11]);
+  COMBA_MULADD(a[11], b[10]);
+  COMBA_MULADD(a[12], b[9]);
+  COMBA_MULADD(a[13], b[8]);
+  COMBA_MULADD(a[14], b[7]);
+  r[21] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[14]);
+  COMBA_MULADD(a[9], b[13]);
+  COMBA_MULADD(a[10], b[12]);
+  COMBA_MULADD(a[11], b[11]);
+  COMBA_MULADD(a[12], b[10]);
+  COMBA_MULADD(a[13], b[9]);
+  COMBA_MULADD(a[14], b[8]);
+  r[22] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], b[14]);
+  COMBA_MULADD(a[10], b[13]);
+  COMBA_MULADD(a[11], b[12]);
+  COMBA_MULADD(a[12], b[11]);
+  COMBA_MULADD(a[13], b[10]);
+  COMBA_MULADD(a[14], b[9]);
+  r[23] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[10], b[14]);
+  COMBA_MULADD(a[11], b[13]);
+  COMBA_MULADD(a[12], b[12]);
+  COMBA_MULADD(a[13], b[11]);
+  COMBA_MULADD(a[14], b[10]);
+  r[24] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[11], b[14]);
+  COMBA_MULADD(a[12], b[13]);
+  COMBA_MULADD(a[13], b[12]);
+  COMBA_MULADD(a[14], b[11]);
+  r[25] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[12], b[14]);
+  COMBA_MULADD(a[13], b[13]);
+  COMBA_MULADD(a[14], b[12]);
+  r[26] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[13], b[14]);
+  COMBA_MULADD(a[14], b[13]);
+  r[27] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[14], b[14]);
+  r[28] = c0;
+  COMBA_SHIFT();
+  r[29] = c0;
+}
+
+static inline void bigint_comba_sqr_15(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[2]);
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[3]);
+  COMBA_MULADD2(a[1], a[2]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[4]);
+  COMBA_MULADD2(a[1], a[3]);
+  COMBA_MULADD(a[2], a[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[5]);
+  COMBA_MULADD2(a[1], a[4]);
+  COMBA_MULADD2(a[2], a[3]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[6]);
+  COMBA_MULADD2(a[1], a[5]);
+  COMBA_MULADD2(a[2], a[4]);
+  COMBA_MULADD(a[3], a[3]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[7]);
+  COMBA_MULADD2(a[1], a[6]);
+  COMBA_MULADD2(a[2], a[5]);
+  COMBA_MULADD2(a[3], a[4]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[8]);
+  COMBA_MULADD2(a[1], a[7]);
+  COMBA_MULADD2(a[2], a[6]);
+  COMBA_MULADD2(a[3], a[5]);
+  COMBA_MULADD(a[4], a[4]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[9]);
+  COMBA_MULADD2(a[1], a[8]);
+  COMBA_MULADD2(a[2], a[7]);
+  COMBA_MULADD2(a[3], a[6]);
+  COMBA_MULADD2(a[4], a[5]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[10]);
+  COMBA_MULADD2(a[1], a[9]);
+  COMBA_MULADD2(a[2], a[8]);
+  COMBA_MULADD2(a[3], a[7]);
+  COMBA_MULADD2(a[4], a[6]);
+  COMBA_MULADD(a[5], a[5]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[11]);
+  COMBA_MULADD2(a[1], a[10]);
+  COMBA_MULADD2(a[2], a[9]);
+  COMBA_MULADD2(a[3], a[8]);
+  COMBA_MULADD2(a[4], a[7]);
+  COMBA_MULADD2(a[5], a[6]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[12]);
+  COMBA_MULADD2(a[1], a[11]);
+  COMBA_MULADD2(a[2], a[10]);
+  COMBA_MULADD2(a[3], a[9]);
+  COMBA_MULADD2(a[4], a[8]);
+  COMBA_MULADD2(a[5], a[7]);
+  COMBA_MULADD(a[6], a[6]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[13]);
+  COMBA_MULADD2(a[1], a[12]);
+  COMBA_MULADD2(a[2], a[11]);
+  COMBA_MULADD2(a[3], a[10]);
+  COMBA_MULADD2(a[4], a[9]);
+  COMBA_MULADD2(a[5], a[8]);
+  COMBA_MULADD2(a[6], a[7]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[14]);
+  COMBA_MULADD2(a[1], a[13]);
+  COMBA_MULADD2(a[2], a[12]);
+  COMBA_MULADD2(a[3], a[11]);
+  COMBA_MULADD2(a[4], a[10]);
+  COMBA_MULADD2(a[5], a[9]);
+  COMBA_MULADD2(a[6], a[8]);
+  COMBA_MULADD(a[7], a[7]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[1], a[14]);
+  COMBA_MULADD2(a[2], a[13]);
+  COMBA_MULADD2(a[3], a[12]);
+  COMBA_MULADD2(a[4], a[11]);
+  COMBA_MULADD2(a[5], a[10]);
+  COMBA_MULADD2(a[6], a[9]);
+  COMBA_MULADD2(a[7], a[8]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[2], a[14]);
+  COMBA_MULADD2(a[3], a[13]);
+  COMBA_MULADD2(a[4], a[12]);
+  COMBA_MULADD2(a[5], a[11]);
+  COMBA_MULADD2(a[6], a[10]);
+  COMBA_MULADD2(a[7], a[9]);
+  COMBA_MULADD(a[8], a[8]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[3], a[14]);
+  COMBA_MULADD2(a[4], a[13]);
+  COMBA_MULADD2(a[5], a[12]);
+  COMBA_MULADD2(a[6], a[11]);
+  COMBA_MULADD2(a[7], a[10]);
+  COMBA_MULADD2(a[8], a[9]);
+  r[17] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[4], a[14]);
+  COMBA_MULADD2(a[5], a[13]);
+  COMBA_MULADD2(a[6], a[12]);
+  COMBA_MULADD2(a[7], a[11]);
+  COMBA_MULADD2(a[8], a[10]);
+  COMBA_MULADD(a[9], a[9]);
+  r[18] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[5], a[14]);
+  COMBA_MULADD2(a[6], a[13]);
+  COMBA_MULADD2(a[7], a[12]);
+  COMBA_MULADD2(a[8], a[11]);
+  COMBA_MULADD2(a[9], a[10]);
+  r[19] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[6], a[14]);
+  COMBA_MULADD2(a[7], a[13]);
+  COMBA_MULADD2(a[8], a[12]);
+  COMBA_MULADD2(a[9], a[11]);
+  COMBA_MULADD(a[10], a[10]);
+  r[20] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[7], a[14]);
+  COMBA_MULADD2(a[8], a[13]);
+  COMBA_MULADD2(a[9], a[12]);
+  COMBA_MULADD2(a[10], a[11]);
+  r[21] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[8], a[14]);
+  COMBA_MULADD2(a[9], a[13]);
+  COMBA_MULADD2(a[10], a[12]);
+  COMBA_MULADD(a[11], a[11]);
+  r[22] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[9], a[14]);
+  COMBA_MULADD2(a[10], a[13]);
+  COMBA_MULADD2(a[11], a[12]);
+  r[23] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[10], a[14]);
+  COMBA_MULADD2(a[11], a[13]);
+  COMBA_MULADD(a[12], a[12]);
+  r[24] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[11], a[14]);
+  COMBA_MULADD2(a[12], a[13]);
+  r[25] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[12], a[14]);
+  COMBA_MULADD(a[13], a[13]);
+  r[26] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[13], a[14]);
+  r[27] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[14], a[14]);
+  r[28] = c0;
+  COMBA_SHIFT();
+  r[29] = c0;
+}
+
+static inline void bigint_comba_mont_15(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[15], t[16];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(q[0], m[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  COMBA_MULADD(a[2], b[0]);
+  q[2] = c0 * minv;
+  COMBA_MULADD(q[2], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(q[0], m[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(q[1], m[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(q[2], m[1]);
+  COMBA_MULADD(a[3], b[0]);
+  q[3] = c0 * minv;
+  COMBA_MULADD(q[3], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(q[0], m[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(q[1], m[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(q[2], m[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(q[3], m[1]);
+  COMBA_MULADD(a[4], b[0]);
+  q[4] = c0 * minv;
+  COMBA_MULADD(q[4], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(q[0], m[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(q[1], m[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(q[2], m[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(q[3], m[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(q[4], m[1]);
+  COMBA_MULADD(a[5], b[0]);
+  q[5] = c0 * minv;
+  COMBA_MULADD(q[5], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(q[0], m[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(q[1], m[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(q[2], m[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(q[3], m[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(q[4], m[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(q[5], m[1]);
+  COMBA_MULADD(a[6], b[0]);
+  q[6] = c0 * minv;
+  COMBA_MULADD(q[6], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(q[0], m[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(q[1], m[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(q[2], m[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(q[3], m[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(q[4], m[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(q[5], m[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(q[6], m[1]);
+  COMBA_MULADD(a[7], b[0]);
+  q[7] = c0 * minv;
+  COMBA_MULADD(q[7], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(q[0], m[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(q[1], m[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(q[2], m[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(q[3], m[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(q[4], m[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(q[5], m[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(q[6], m[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(q[7], m[1]);
+  COMBA_MULADD(a[8], b[0]);
+  q[8] = c0 * minv;
+  COMBA_MULADD(q[8], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[9]);
+  COMBA_MULADD(q[0], m[9]);
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(q[1], m[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(q[2], m[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(q[3], m[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(q[4], m[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(q[5], m[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(q[6], m[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(q[7], m[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(q[8], m[1]);
+  COMBA_MULADD(a[9], b[0]);
+  q[9] = c0 * minv;
+  COMBA_MULADD(q[9], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[10]);
+  COMBA_MULADD(q[0], m[10]);
+  COMBA_MULADD(a[1], b[9]);
+  COMBA_MULADD(q[1], m[9]);
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(q[2], m[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(q[3], m[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(q[4], m[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(q[5], m[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(q[6], m[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(q[7], m[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(q[8], m[2]);
+  COMBA_MULADD(a[9], b[1]);
+  COMBA_MULADD(q[9], m[1]);
+  COMBA_MULADD(a[10], b[0]);
+  q[10] = c0 * minv;
+  COMBA_MULADD(q[10], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[11]);
+  COMBA_MULADD(q[0], m[11]);
+  COMBA_MULADD(a[1], b[10]);
+  COMBA_MULADD(q[1], m[10]);
+  COMBA_MULADD(a[2], b[9]);
+  COMBA_MULADD(q[2], m[9]);
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(q[3], m[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(q[4], m[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(q[5], m[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(q[6], m[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(q[7], m[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(q[8], m[3]);
+  COMBA_MULADD(a[9], b[2]);
+  COMBA_MULADD(q[9], m[2]);
+  COMBA_MULADD(a[10], b[1]);
+  COMBA_MULADD(q[10], m[1]);
+  COMBA_MULADD(a[11], b[0]);
+  q[11] = c0 * minv;
+  COMBA_MULADD(q[11], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[12]);
+  COMBA_MULADD(q[0], m[12]);
+  COMBA_MULADD(a[1], b[11]);
+  COMBA_MULADD(q[1], m[11]);
+  COMBA_MULADD(a[2], b[10]);
+  COMBA_MULADD(q[2], m[10]);
+  COMBA_MULADD(a[3], b[9]);
+  COMBA_MULADD(q[3], m[9]);
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(q[4], m[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(q[5], m[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(q[6], m[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(q[7], m[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(q[8], m[4]);
+  COMBA_MULADD(a[9], b[3]);
+  COMBA_MULADD(q[9], m[3]);
+  COMBA_MULADD(a[10], b[2]);
+  COMBA_MULADD(q[10], m[2]);
+  COMBA_MULADD(a[11], b[1]);
+  COMBA_MULADD(q[11], m[1]);
+  COMBA_MULADD(a[12], b[0]);
+  q[12] = c0 * minv;
+  COMBA_MULADD(q[12], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[13]);
+  COMBA_MULADD(q[0], m[13]);
+  COMBA_MULADD(a[1], b[12]);
+  COMBA_MULADD(q[1], m[12]);
+  COMBA_MULADD(a[2], b[11]);
+  COMBA_MULADD(q[2], m[11]);
+  COMBA_MULADD(a[3], b[10]);
+  COMBA_MULADD(q[3], m[10]);
+  COMBA_MULADD(a[4], b[9]);
+  COMBA_MULADD(q[4], m[9]);
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(q[5], m[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(q[6], m[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(q[7], m[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(q[8], m[5]);
+  COMBA_MULADD(a[9], b[4]);
+  COMBA_MULADD(q[9], m[4]);
+  COMBA_MULADD(a[10], b[3]);
+  COMBA_MULADD(q[10], m[3]);
+  COMBA_MULADD(a[11], b[2]);
+  COMBA_MULADD(q[11], m[2]);
+  COMBA_MULADD(a[12], b[1]);
+  COMBA_MULADD(q[12], m[1]);
+  COMBA_MULADD(a[13], b[0]);
+  q[13] = c0 * minv;
+  COMBA_MULADD(q[13], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[14]);
+  COMBA_MULADD(q[0], m[14]);
+  COMBA_MULADD(a[1], b[13]);
+  COMBA_MULADD(q[1], m[13]);
+  COMBA_MULADD(a[2], b[12]);
+  COMBA_MULADD(q[2], m[12]);
+  COMBA_MULADD(a[3], b[11]);
+  COMBA_MULADD(q[3], m[11]);
+  COMBA_MULADD(a[4], b[10]);
+  COMBA_MULADD(q[4], m[10]);
+  COMBA_MULADD(a[5], b[9]);
+  COMBA_MULADD(q[5], m[9]);
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(q[6], m[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(q[7], m[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(q[8], m[6]);
+  COMBA_MULADD(a[9], b[5]);
+  COMBA_MULADD(q[9], m[5]);
+  COMBA_MULADD(a[10], b[4]);
+  COMBA_MULADD(q[10], m[4]);
+  COMBA_MULADD(a[11], b[3]);
+  COMBA_MULADD(q[11], m[3]);
+  COMBA_MULADD(a[12], b[2]);
+  COMBA_MULADD(q[12], m[2]);
+  COMBA_MULADD(a[13], b[1]);
+  COMBA_MULADD(q[13], m[1]);
+  COMBA_MULADD(a[14], b[0]);
+  q[14] = c0 * minv;
+  COMBA_MULADD(q[14], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[14]);
+  COMBA_MULADD(q[1], m[14]);
+  COMBA_MULADD(a[2], b[13]);
+  COMBA_MULADD(q[2], m[13]);
+  COMBA_MULADD(a[3], b[12]);
+  COMBA_MULADD(q[3], m[12]);
+  COMBA_MULADD(a[4], b[11]);
+  COMBA_MULADD(q[4], m[11]);
+  COMBA_MULADD(a[5], b[10]);
+  COMBA_MULADD(q[5], m[10]);
+  COMBA_MULADD(a[6], b[9]);
+  COMBA_MULADD(q[6], m[9]);
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(q[7], m[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(q[8], m[7]);
+  COMBA_MULADD(a[9], b[6]);
+  COMBA_MULADD(q[9], m[6]);
+  COMBA_MULADD(a[10], b[5]);
+  COMBA_MULADD(q[10], m[5]);
+  COMBA_MULADD(a[11], b[4]);
+  COMBA_MULADD(q[11], m[4]);
+  COMBA_MULADD(a[12], b[3]);
+  COMBA_MULADD(q[12], m[3]);
+  COMBA_MULADD(a[13], b[2]);
+  COMBA_MULADD(q[13], m[2]);
+  COMBA_MULADD(a[14], b[1]);
+  COMBA_MULADD(q[14], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[14]);
+  COMBA_MULADD(q[2], m[14]);
+  COMBA_MULADD(a[3], b[13]);
+  COMBA_MULADD(q[3], m[13]);
+  COMBA_MULADD(a[4], b[12]);
+  COMBA_MULADD(q[4], m[12]);
+  COMBA_MULADD(a[5], b[11]);
+  COMBA_MULADD(q[5], m[11]);
+  COMBA_MULADD(a[6], b[10]);
+  COMBA_MULADD(q[6], m[10]);
+  COMBA_MULADD(a[7], b[9]);
+  COMBA_MULADD(q[7], m[9]);
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(q[8], m[8]);
+  COMBA_MULADD(a[9], b[7]);
+  COMBA_MULADD(q[9], m[7]);
+  COMBA_MULADD(a[10], b[6]);
+  COMBA_MULADD(q[10], m[6]);
+  COMBA_MULADD(a[11], b[5]);
+  COMBA_MULADD(q[11], m[5]);
+  COMBA_MULADD(a[12], b[4]);
+  COMBA_MULADD(q[12], m[4]);
+  COMBA_MULADD(a[13], b[3]);
+  COMBA_MULADD(q[13], m[3]);
+  COMBA_MULADD(a[14], b[2]);
+  COMBA_MULADD(q[14], m[2]);
+  t[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[14]);
+  COMBA_MULADD(q[3], m[14]);
+  COMBA_MULADD(a[4], b[13]);
+  COMBA_MULADD(q[4], m[13]);
+  COMBA_MULADD(a[5], b[12]);
+  COMBA_MULADD(q[5], m[12]);
+  COMBA_MULADD(a[6], b[11]);
+  COMBA_MULADD(q[6], m[11]);
+  COMBA_MULADD(a[7], b[10]);
+  COMBA_MULADD(q[7], m[10]);
+  COMBA_MULADD(a[8], b[9]);
+  COMBA_MULADD(q[8], m[9]);
+  COMBA_MULADD(a[9], b[8]);
+  COMBA_MULADD(q[9], m[8]);
+  COMBA_MULADD(a[10], b[7]);
+  COMBA_MULADD(q[10], m[7]);
+  COMBA_MULADD(a[11], b[6]);
+  COMBA_MULADD(q[11], m[6]);
+  COMBA_MULADD(a[12], b[5]);
+  COMBA_MULADD(q[12], m[5]);
+  COMBA_MULADD(a[13], b[4]);
+  COMBA_MULADD(q[13], m[4]);
+  COMBA_MULADD(a[14], b[3]);
+  COMBA_MULADD(q[14], m[3]);
+  t[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[14]);
+  COMBA_MULADD(q[4], m[14]);
+  COMBA_MULADD(a[5], b[13]);
+  COMBA_MULADD(q[5], m[13]);
+  COMBA_MULADD(a[6], b[12]);
+  COMBA_MULADD(q[6], m[12]);
+  COMBA_MULADD(a[7], b[11]);
+  COMBA_MULADD(q[7], m[11]);
+  COMBA_MULADD(a[8], b[10]);
+  COMBA_MULADD(q[8], m[10]);
+  COMBA_MULADD(a[9], b[9]);
+  COMBA_MULADD(q[9], m[9]);
+  COMBA_MULADD(a[10], b[8]);
+  COMBA_MULADD(q[10], m[8]);
+  COMBA_MULADD(a[11], b[7]);
+  COMBA_MULADD(q[11], m[7]);
+  COMBA_MULADD(a[12], b[6]);
+  COMBA_MULADD(q[12], m[6]);
+  COMBA_MULADD(a[13], b[5]);
+  COMBA_MULADD(q[13], m[5]);
+  COMBA_MULADD(a[14], b[4]);
+  COMBA_MULADD(q[14], m[4]);
+  t[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[14]);
+  COMBA_MULADD(q[5], m[14]);
+  COMBA_MULADD(a[6], b[13]);
+  COMBA_MULADD(q[6], m[13]);
+  COMBA_MULADD(a[7], b[12]);
+  COMBA_MULADD(q[7], m[12]);
+  COMBA_MULADD(a[8], b[11]);
+  COMBA_MULADD(q[8], m[11]);
+  COMBA_MULADD(a[9], b[10]);
+  COMBA_MULADD(q[9], m[10]);
+  COMBA_MULADD(a[10], b[9]);
+  COMBA_MULADD(q[10], m[9]);
+  COMBA_MULADD(a[11], b[8]);
+  COMBA_MULADD(q[11], m[8]);
+  COMBA_MULADD(a[12], b[7]);
+  COMBA_MULADD(q[12], m[7]);
+  COMBA_MULADD(a[13], b[6]);
+  COMBA_MULADD(q[13], m[6]);
+  COMBA_MULADD(a[14], b[5]);
+  COMBA_MULADD(q[14], m[5]);
+  t[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[14]);
+  COMBA_MULADD(q[6], m[14]);
+  COMBA_MULADD(a[7], b[13]);
+  COMBA_MULADD(q[7], m[13]);
+  COMBA_MULADD(a[8], b[12]);
+  COMBA_MULADD(q[8], m[12]);
+  COMBA_MULADD(a[9], b[11]);
+  COMBA_MULADD(q[9], m[11]);
+  COMBA_MULADD(a[10], b[10]);
+  COMBA_MULADD(q[10], m[10]);
+  COMBA_MULADD(a[11], b[9]);
+  COMBA_MULADD(q[11], m[9]);
+  COMBA_MULADD(a[12], b[8]);
+  COMBA_MULADD(q[12], m[8]);
+  COMBA_MULADD(a[13], b[7]);
+  COMBA_MULADD(q[13], m[7]);
+  COMBA_MULADD(a[14], b[6]);
+  COMBA_MULADD(q[14], m[6]);
+  t[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[14]);
+  COMBA_MULADD(q[7], m[14]);
+  COMBA_MULADD(a[8], b[13]);
+  COMBA_MULADD(q[8], m[13]);
+  COMBA_MULADD(a[9], b[12]);
+  COMBA_MULADD(q[9], m[12]);
+  COMBA_MULADD(a[10], b[11]);
+  COMBA_MULADD(q[10], m[11]);
+  COMBA_MULADD(a[11], b[10]);
+  COMBA_MULADD(q[11], m[10]);
+  COMBA_MULADD(a[12], b[9]);
+  COMBA_MULADD(q[12], m[9]);
+  COMBA_MULADD(a[13], b[8]);
+  COMBA_MULADD(q[13], m[8]);
+  COMBA_MULADD(a[14], b[7]);
+  COMBA_MULADD(q[14], m[7]);
+  t[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[14]);
+  COMBA_MULADD(q[8], m[14]);
+  COMBA_MULADD(a[9], b[13]);
+  COMBA_MULADD(q[9], m[13]);
+  COMBA_MULADD(a[10], b[12]);
+  COMBA_MULADD(q[10], m[12]);
+  COMBA_MULADD(a[11], b[11]);
+  COMBA_MULADD(q[11], m[11]);
+  COMBA_MULADD(a[12], b[10]);
+  COMBA_MULADD(q[12], m[10]);
+  COMBA_MULADD(a[13], b[9]);
+  COMBA_MULADD(q[13], m[9]);
+  COMBA_MULADD(a[14], b[8]);
+  COMBA_MULADD(q[14], m[8]);
+  t[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], b[14]);
+  COMBA_MULADD(q[9], m[14]);
+  COMBA_MULADD(a[10], b[13]);
+  COMBA_MULADD(q[10], m[13]);
+  COMBA_MULADD(a[11], b[12]);
+  COMBA_MULADD(q[11], m[12]);
+  COMBA_MULADD(a[12], b[11]);
+  COMBA_MULADD(q[12], m[11]);
+  COMBA_MULADD(a[13], b[10]);
+  COMBA_MULADD(q[13], m[10]);
+  COMBA_MULADD(a[14], b[9]);
+  COMBA_MULADD(q[14], m[9]);
+  t[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[10], b[14]);
+  COMBA_MULADD(q[10], m[14]);
+  COMBA_MULADD(a[11], b[13]);
+  COMBA_MULADD(q[11], m[13]);
+  COMBA_MULADD(a[12], b[12]);
+  COMBA_MULADD(q[12], m[12]);
+  COMBA_MULADD(a[13], b[11]);
+  COMBA_MULADD(q[13], m[11]);
+  COMBA_MULADD(a[14], b[10]);
+  COMBA_MULADD(q[14], m[10]);
+  t[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[11], b[14]);
+  COMBA_MULADD(q[11], m[14]);
+  COMBA_MULADD(a[12], b[13]);
+  COMBA_MULADD(q[12], m[13]);
+  COMBA_MULADD(a[13], b[12]);
+  COMBA_MULADD(q[13], m[12]);
+  COMBA_MULADD(a[14], b[11]);
+  COMBA_MULADD(q[14], m[11]);
+  t[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[12], b[14]);
+  COMBA_MULADD(q[12], m[14]);
+  COMBA_MULADD(a[13], b[13]);
+  COMBA_MULADD(q[13], m[13]);
+  COMBA_MULADD(a[14], b[12]);
+  COMBA_MULADD(q[14], m[12]);
+  t[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[13], b[14]);
+  COMBA_MULADD(q[13], m[14]);
+  COMBA_MULADD(a[14], b[13]);
+  COMBA_MULADD(q[14], m[13]);
+  t[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[14], b[14]);
+  COMBA_MULADD(q[14], m[14]);
+  t[13] = c0;
+  COMBA_SHIFT();
+  t[14] = c0;
+  COMBA_SHIFT();
+  t[15] = c0;
+  bigint_comba_mont_finish(r, t, m, 15);
+}
+
+static inline void bigint_comba_mul_16(Limb *r, const Limb *a,
+                                      const Limb *b) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], b[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(a[1], b[0]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(a[2], b[0]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(a[3], b[0]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(a[4], b[0]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(a[5], b[0]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(a[6], b[0]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(a[7], b[0]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(a[8], b[0]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[9]);
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(a[9], b[0]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[10]);
+  COMBA_MULADD(a[1], b[9]);
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(a[9], b[1]);
+  COMBA_MULADD(a[10], b[0]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[11]);
+  COMBA_MULADD(a[1], b[10]);
+  COMBA_MULADD(a[2], b[9]);
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(a[9], b[2]);
+  COMBA_MULADD(a[10], b[1]);
+  COMBA_MULADD(a[11], b[0]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[12]);
+  COMBA_MULADD(a[1], b[11]);
+  COMBA_MULADD(a[2], b[10]);
+  COMBA_MULADD(a[3], b[9]);
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(a[9], b[3]);
+  COMBA_MULADD(a[10], b[2]);
+  COMBA_MULADD(a[11], b[1]);
+  COMBA_MULADD(a[12], b[0]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[13]);
+  COMBA_MULADD(a[1], b[12]);
+  COMBA_MULADD(a[2], b[11]);
+  COMBA_MULADD(a[3], b[10]);
+  COMBA_MULADD(a[4], b[9]);
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(a[9], b[4]);
+  COMBA_MULADD(a[10], b[3]);
+  COMBA_MULADD(a[11], b[2]);
+  COMBA_MULADD(a[12], b[1]);
+  COMBA_MULADD(a[13], b[0]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[14]);
+  COMBA_MULADD(a[1], b[13]);
+  COMBA_MULADD(a[2], b[12]);
+  COMBA_MULADD(a[3], b[11]);
+  COMBA_MULADD(a[4], b[10]);
+  COMBA_MULADD(a[5], b[9]);
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(a[9], b[5]);
+  COMBA_MULADD(a[10], b[4]);
+  COMBA_MULADD(a[11], b[3]);
+  COMBA_MULADD(a[12], b[2]);
+  COMBA_MULADD(a[13], b[1]);
+  COMBA_MULADD(a[14], b[0]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[15]);
+  COMBA_MULADD(a[1], b[14]);
+  COMBA_MULADD(a[2], b[13]);
+  COMBA_MULADD(a[3], b[12]);
+  COMBA_MULADD(a[4], b[11]);
+  COMBA_MULADD(a[5], b[10]);
+  COMBA_MULADD(a[6], b[9]);
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(a[9], b[6]);
+  COMBA_MULADD(a[10], b[5]);
+  COMBA_MULADD(a[11], b[4]);
+  COMBA_MULADD(a[12], b[3]);
+  COMBA_MULADD(a[13], b[2]);
+  COMBA_MULADD(a[14], b[1]);
+  COMBA_MULADD(a[15], b[0]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[15]);
+  COMBA_MULADD(a[2], b[14]);
+  COMBA_MULADD(a[3], b[13]);
+  COMBA_MULADD(a[4], b[12]);
+  COMBA_MULADD(a[5], b[11]);
+  COMBA_MULADD(a[6], b[10]);
+  COMBA_MULADD(a[7], b[9]);
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(a[9], b[7]);
+  COMBA_MULADD(a[10], b[6]);
+  COMBA_MULADD(a[11], b[5]);
+  COMBA_MULADD(a[12], b[4]);
+  COMBA_MULADD(a[13], b[3]);
+  COMBA_MULADD(a[14], b[2]);
+  COMBA_MULADD(a[15], b[1]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[15]);
+  COMBA_MULADD(a[3], b[14]);
+  COMBA_MULADD(a[4], b[13]);
+  COMBA_MULADD(a[5], b[12]);
+  COMBA_MULADD(a[6], b[11]);
+  COMBA_MULADD(a[7], b[10]);
+  COMBA_MULADD(a[8], b[9]);
+  COMBA_MULADD(a[9], b[8]);
+  COMBA_MULADD(a[10], b[7]);
+  COMBA_MULADD(a[11], b[6]);
+  COMBA_MULADD(a[12], b[5]);
+  COMBA_MULADD(a[13], b[4]);
+  COMBA_MULADD(a[14], b[3]);
+  COMBA_MULADD(a[15], b[2]);
+  r[17] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[15]);
+  COMBA_MULADD(a[4], b[14]);
+  COMBA_MULADD(a[5], b[13]);
+  COMBA_MULADD(a[6], b[12]);
+  COMBA_MULADD(a[7], b[11]);
+  COMBA_MULADD(a[8], b[10]);
+  COMBA_MULADD(a[9], b[9]);
+  COMBA_MULADD(a[10], b[8]);
+  COMBA_MULADD(a[11], b[7]);
+  COMBA_MULADD(a[12], b[6]);
+  COMBA_MULADD(a[13], b[5]);
+  COMBA_MULADD(a[14], b[4]);
+  COMBA_MULADD(a[15], b[3]);
+  r[18] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[15]);
+  COMBA_MULADD(a[5], b[14]);
+  COMBA_MULADD(a[6], b[13]);
+  COMBA_MULADD(a[7], b[12]);
+  COMBA_MULADD(a[8], b[11]);
+  COMBA_MULADD(a[9], b[10]);
+  COMBA_MULADD(a[10], b[9]);
+  COMBA_MULADD(a[11], b[8]);
+  COMBA_MULADD(a[12], b[7]);
+  COMBA_MULADD(a[13], b[6]);
+  COMBA_MULADD(a[14], b[5]);
+  COMBA_MULADD(a[15], b[4]);
+  r[19] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[15]);
+  COMBA_MULADD(a[6], b[14]);
+  COMBA_MULADD(a[7], b[13]);
+  COMBA_MULADD(a[8], b[12]);
+  COMBA_MULADD(a[9], b[11]);
+  COMBA_MULADD(a[10], b[10]);
+  COMBA_MULADD(a[11], b[9]);
+  COMBA_MULADD(a[12], b[8]);
+  COMBA_MULADD(a[13], b[7]);
+  COMBA_MULADD(a[14], b[6]);
+  COMBA_MULADD(a[15], b[5]);
+  r[20] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[15]);
+  COMBA_MULADD(a[7], b[14]);
+  COMBA_MULADD(a[8], b[13]);
+  COMBA_MULADD(a[9], b[12]);
+  COMBA_MULADD(a[10], b[11]);
+  COMBA_MULADD(a[11], b[10]);
+  COMBA_MULADD(a[12], b[9]);
+  COMBA_MULADD(a[13], b[8]);
+  COMBA_MULADD(a[14], b[7]);
+  COMBA_MULADD(a[15], b[6]);
+  r[21] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[15]);
+  COMBA_MULADD(a[8], b[14]);
+  COMBA_MULADD(a[9], b[13]);
+  COMBA_MULADD(a[10], b[12]);
+  COMBA_MULADD(a[11], b[11]);
+  COMBA_MULADD(a[12], b[10]);
+  COMBA_MULADD(a[13], b[9]);
+  COMBA_MULADD(a[14], b[8]);
+  COMBA_MULADD(a[15], b[7]);
+  r[22] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[15]);
+  COMBA_MULADD(a[9], b[14]);
+  COMBA_MULADD(a[10], b[13]);
+  COMBA_MULADD(a[11], b[12]);
+  COMBA_MULADD(a[12], b[11]);
+  COMBA_MULADD(a[13], b[10]);
+  COMBA_MULADD(a[14], b[9]);
+  COMBA_MULADD(a[15], b[8]);
+  r[23] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], b[15]);
+  COMBA_MULADD(a[10], b[14]);
+  COMBA_MULADD(a[11], b[13]);
+  COMBA_MULADD(a[12], b[12]);
+  COMBA_MULADD(a[13], b[11]);
+  COMBA_MULADD(a[14], b[10]);
+  COMBA_MULADD(a[15], b[9]);
+  r[24] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[10], b[15]);
+  COMBA_MULADD(a[11], b[14]);
+  COMBA_MULADD(a[12], b[13]);
+  COMBA_MULADD(a[13], b[12]);
+  COMBA_MULADD(a[14], b[11]);
+  COMBA_MULADD(a[15], b[10]);
+  r[25] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[11], b[15]);
+  COMBA_MULADD(a[12], b[14]);
+  COMBA_MULADD(a[13], b[13]);
+  COMBA_MULADD(a[14], b[12]);
+  COMBA_MULADD(a[15], b[11]);
+  r[26] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[12], b[15]);
+  COMBA_MULADD(a[13], b[14]);
+  COMBA_MULADD(a[14], b[13]);
+  COMBA_MULADD(a[15], b[12]);
+  r[27] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[13], b[15]);
+  COMBA_MULADD(a[14], b[14]);
+  COMBA_MULADD(a[15], b[13]);
+  r[28] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[14], b[15]);
+  COMBA_MULADD(a[15], b[14]);
+  r[29] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[15], b[15]);
+  r[30] = c0;
+  COMBA_SHIFT();
+  r[31] = c0;
+}
+
+static inline void bigint_comba_sqr_16(Limb *r, const Limb *a) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  COMBA_MULADD(a[0], a[0]);
+  r[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[1]);
+  r[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[2]);
+  COMBA_MULADD(a[1], a[1]);
+  r[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[3]);
+  COMBA_MULADD2(a[1], a[2]);
+  r[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[4]);
+  COMBA_MULADD2(a[1], a[3]);
+  COMBA_MULADD(a[2], a[2]);
+  r[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[5]);
+  COMBA_MULADD2(a[1], a[4]);
+  COMBA_MULADD2(a[2], a[3]);
+  r[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[6]);
+  COMBA_MULADD2(a[1], a[5]);
+  COMBA_MULADD2(a[2], a[4]);
+  COMBA_MULADD(a[3], a[3]);
+  r[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[7]);
+  COMBA_MULADD2(a[1], a[6]);
+  COMBA_MULADD2(a[2], a[5]);
+  COMBA_MULADD2(a[3], a[4]);
+  r[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[8]);
+  COMBA_MULADD2(a[1], a[7]);
+  COMBA_MULADD2(a[2], a[6]);
+  COMBA_MULADD2(a[3], a[5]);
+  COMBA_MULADD(a[4], a[4]);
+  r[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[9]);
+  COMBA_MULADD2(a[1], a[8]);
+  COMBA_MULADD2(a[2], a[7]);
+  COMBA_MULADD2(a[3], a[6]);
+  COMBA_MULADD2(a[4], a[5]);
+  r[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[10]);
+  COMBA_MULADD2(a[1], a[9]);
+  COMBA_MULADD2(a[2], a[8]);
+  COMBA_MULADD2(a[3], a[7]);
+  COMBA_MULADD2(a[4], a[6]);
+  COMBA_MULADD(a[5], a[5]);
+  r[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[11]);
+  COMBA_MULADD2(a[1], a[10]);
+  COMBA_MULADD2(a[2], a[9]);
+  COMBA_MULADD2(a[3], a[8]);
+  COMBA_MULADD2(a[4], a[7]);
+  COMBA_MULADD2(a[5], a[6]);
+  r[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[12]);
+  COMBA_MULADD2(a[1], a[11]);
+  COMBA_MULADD2(a[2], a[10]);
+  COMBA_MULADD2(a[3], a[9]);
+  COMBA_MULADD2(a[4], a[8]);
+  COMBA_MULADD2(a[5], a[7]);
+  COMBA_MULADD(a[6], a[6]);
+  r[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[13]);
+  COMBA_MULADD2(a[1], a[12]);
+  COMBA_MULADD2(a[2], a[11]);
+  COMBA_MULADD2(a[3], a[10]);
+  COMBA_MULADD2(a[4], a[9]);
+  COMBA_MULADD2(a[5], a[8]);
+  COMBA_MULADD2(a[6], a[7]);
+  r[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[14]);
+  COMBA_MULADD2(a[1], a[13]);
+  COMBA_MULADD2(a[2], a[12]);
+  COMBA_MULADD2(a[3], a[11]);
+  COMBA_MULADD2(a[4], a[10]);
+  COMBA_MULADD2(a[5], a[9]);
+  COMBA_MULADD2(a[6], a[8]);
+  COMBA_MULADD(a[7], a[7]);
+  r[14] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[0], a[15]);
+  COMBA_MULADD2(a[1], a[14]);
+  COMBA_MULADD2(a[2], a[13]);
+  COMBA_MULADD2(a[3], a[12]);
+  COMBA_MULADD2(a[4], a[11]);
+  COMBA_MULADD2(a[5], a[10]);
+  COMBA_MULADD2(a[6], a[9]);
+  COMBA_MULADD2(a[7], a[8]);
+  r[15] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[1], a[15]);
+  COMBA_MULADD2(a[2], a[14]);
+  COMBA_MULADD2(a[3], a[13]);
+  COMBA_MULADD2(a[4], a[12]);
+  COMBA_MULADD2(a[5], a[11]);
+  COMBA_MULADD2(a[6], a[10]);
+  COMBA_MULADD2(a[7], a[9]);
+  COMBA_MULADD(a[8], a[8]);
+  r[16] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[2], a[15]);
+  COMBA_MULADD2(a[3], a[14]);
+  COMBA_MULADD2(a[4], a[13]);
+  COMBA_MULADD2(a[5], a[12]);
+  COMBA_MULADD2(a[6], a[11]);
+  COMBA_MULADD2(a[7], a[10]);
+  COMBA_MULADD2(a[8], a[9]);
+  r[17] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[3], a[15]);
+  COMBA_MULADD2(a[4], a[14]);
+  COMBA_MULADD2(a[5], a[13]);
+  COMBA_MULADD2(a[6], a[12]);
+  COMBA_MULADD2(a[7], a[11]);
+  COMBA_MULADD2(a[8], a[10]);
+  COMBA_MULADD(a[9], a[9]);
+  r[18] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[4], a[15]);
+  COMBA_MULADD2(a[5], a[14]);
+  COMBA_MULADD2(a[6], a[13]);
+  COMBA_MULADD2(a[7], a[12]);
+  COMBA_MULADD2(a[8], a[11]);
+  COMBA_MULADD2(a[9], a[10]);
+  r[19] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[5], a[15]);
+  COMBA_MULADD2(a[6], a[14]);
+  COMBA_MULADD2(a[7], a[13]);
+  COMBA_MULADD2(a[8], a[12]);
+  COMBA_MULADD2(a[9], a[11]);
+  COMBA_MULADD(a[10], a[10]);
+  r[20] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[6], a[15]);
+  COMBA_MULADD2(a[7], a[14]);
+  COMBA_MULADD2(a[8], a[13]);
+  COMBA_MULADD2(a[9], a[12]);
+  COMBA_MULADD2(a[10], a[11]);
+  r[21] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[7], a[15]);
+  COMBA_MULADD2(a[8], a[14]);
+  COMBA_MULADD2(a[9], a[13]);
+  COMBA_MULADD2(a[10], a[12]);
+  COMBA_MULADD(a[11], a[11]);
+  r[22] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[8], a[15]);
+  COMBA_MULADD2(a[9], a[14]);
+  COMBA_MULADD2(a[10], a[13]);
+  COMBA_MULADD2(a[11], a[12]);
+  r[23] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[9], a[15]);
+  COMBA_MULADD2(a[10], a[14]);
+  COMBA_MULADD2(a[11], a[13]);
+  COMBA_MULADD(a[12], a[12]);
+  r[24] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[10], a[15]);
+  COMBA_MULADD2(a[11], a[14]);
+  COMBA_MULADD2(a[12], a[13]);
+  r[25] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[11], a[15]);
+  COMBA_MULADD2(a[12], a[14]);
+  COMBA_MULADD(a[13], a[13]);
+  r[26] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[12], a[15]);
+  COMBA_MULADD2(a[13], a[14]);
+  r[27] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[13], a[15]);
+  COMBA_MULADD(a[14], a[14]);
+  r[28] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD2(a[14], a[15]);
+  r[29] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[15], a[15]);
+  r[30] = c0;
+  COMBA_SHIFT();
+  r[31] = c0;
+}
+
+static inline void bigint_comba_mont_16(Limb *r, const Limb *a,
+                                       const Limb *b, const Limb *m,
+                                       Limb minv) {
+  Limb c0 = 0, c1 = 0, c2 = 0;
+  Limb q[16], t[17];
+  COMBA_MULADD(a[0], b[0]);
+  q[0] = c0 * minv;
+  COMBA_MULADD(q[0], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[1]);
+  COMBA_MULADD(q[0], m[1]);
+  COMBA_MULADD(a[1], b[0]);
+  q[1] = c0 * minv;
+  COMBA_MULADD(q[1], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[2]);
+  COMBA_MULADD(q[0], m[2]);
+  COMBA_MULADD(a[1], b[1]);
+  COMBA_MULADD(q[1], m[1]);
+  COMBA_MULADD(a[2], b[0]);
+  q[2] = c0 * minv;
+  COMBA_MULADD(q[2], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[3]);
+  COMBA_MULADD(q[0], m[3]);
+  COMBA_MULADD(a[1], b[2]);
+  COMBA_MULADD(q[1], m[2]);
+  COMBA_MULADD(a[2], b[1]);
+  COMBA_MULADD(q[2], m[1]);
+  COMBA_MULADD(a[3], b[0]);
+  q[3] = c0 * minv;
+  COMBA_MULADD(q[3], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[4]);
+  COMBA_MULADD(q[0], m[4]);
+  COMBA_MULADD(a[1], b[3]);
+  COMBA_MULADD(q[1], m[3]);
+  COMBA_MULADD(a[2], b[2]);
+  COMBA_MULADD(q[2], m[2]);
+  COMBA_MULADD(a[3], b[1]);
+  COMBA_MULADD(q[3], m[1]);
+  COMBA_MULADD(a[4], b[0]);
+  q[4] = c0 * minv;
+  COMBA_MULADD(q[4], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[5]);
+  COMBA_MULADD(q[0], m[5]);
+  COMBA_MULADD(a[1], b[4]);
+  COMBA_MULADD(q[1], m[4]);
+  COMBA_MULADD(a[2], b[3]);
+  COMBA_MULADD(q[2], m[3]);
+  COMBA_MULADD(a[3], b[2]);
+  COMBA_MULADD(q[3], m[2]);
+  COMBA_MULADD(a[4], b[1]);
+  COMBA_MULADD(q[4], m[1]);
+  COMBA_MULADD(a[5], b[0]);
+  q[5] = c0 * minv;
+  COMBA_MULADD(q[5], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[6]);
+  COMBA_MULADD(q[0], m[6]);
+  COMBA_MULADD(a[1], b[5]);
+  COMBA_MULADD(q[1], m[5]);
+  COMBA_MULADD(a[2], b[4]);
+  COMBA_MULADD(q[2], m[4]);
+  COMBA_MULADD(a[3], b[3]);
+  COMBA_MULADD(q[3], m[3]);
+  COMBA_MULADD(a[4], b[2]);
+  COMBA_MULADD(q[4], m[2]);
+  COMBA_MULADD(a[5], b[1]);
+  COMBA_MULADD(q[5], m[1]);
+  COMBA_MULADD(a[6], b[0]);
+  q[6] = c0 * minv;
+  COMBA_MULADD(q[6], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[7]);
+  COMBA_MULADD(q[0], m[7]);
+  COMBA_MULADD(a[1], b[6]);
+  COMBA_MULADD(q[1], m[6]);
+  COMBA_MULADD(a[2], b[5]);
+  COMBA_MULADD(q[2], m[5]);
+  COMBA_MULADD(a[3], b[4]);
+  COMBA_MULADD(q[3], m[4]);
+  COMBA_MULADD(a[4], b[3]);
+  COMBA_MULADD(q[4], m[3]);
+  COMBA_MULADD(a[5], b[2]);
+  COMBA_MULADD(q[5], m[2]);
+  COMBA_MULADD(a[6], b[1]);
+  COMBA_MULADD(q[6], m[1]);
+  COMBA_MULADD(a[7], b[0]);
+  q[7] = c0 * minv;
+  COMBA_MULADD(q[7], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[8]);
+  COMBA_MULADD(q[0], m[8]);
+  COMBA_MULADD(a[1], b[7]);
+  COMBA_MULADD(q[1], m[7]);
+  COMBA_MULADD(a[2], b[6]);
+  COMBA_MULADD(q[2], m[6]);
+  COMBA_MULADD(a[3], b[5]);
+  COMBA_MULADD(q[3], m[5]);
+  COMBA_MULADD(a[4], b[4]);
+  COMBA_MULADD(q[4], m[4]);
+  COMBA_MULADD(a[5], b[3]);
+  COMBA_MULADD(q[5], m[3]);
+  COMBA_MULADD(a[6], b[2]);
+  COMBA_MULADD(q[6], m[2]);
+  COMBA_MULADD(a[7], b[1]);
+  COMBA_MULADD(q[7], m[1]);
+  COMBA_MULADD(a[8], b[0]);
+  q[8] = c0 * minv;
+  COMBA_MULADD(q[8], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[9]);
+  COMBA_MULADD(q[0], m[9]);
+  COMBA_MULADD(a[1], b[8]);
+  COMBA_MULADD(q[1], m[8]);
+  COMBA_MULADD(a[2], b[7]);
+  COMBA_MULADD(q[2], m[7]);
+  COMBA_MULADD(a[3], b[6]);
+  COMBA_MULADD(q[3], m[6]);
+  COMBA_MULADD(a[4], b[5]);
+  COMBA_MULADD(q[4], m[5]);
+  COMBA_MULADD(a[5], b[4]);
+  COMBA_MULADD(q[5], m[4]);
+  COMBA_MULADD(a[6], b[3]);
+  COMBA_MULADD(q[6], m[3]);
+  COMBA_MULADD(a[7], b[2]);
+  COMBA_MULADD(q[7], m[2]);
+  COMBA_MULADD(a[8], b[1]);
+  COMBA_MULADD(q[8], m[1]);
+  COMBA_MULADD(a[9], b[0]);
+  q[9] = c0 * minv;
+  COMBA_MULADD(q[9], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[10]);
+  COMBA_MULADD(q[0], m[10]);
+  COMBA_MULADD(a[1], b[9]);
+  COMBA_MULADD(q[1], m[9]);
+  COMBA_MULADD(a[2], b[8]);
+  COMBA_MULADD(q[2], m[8]);
+  COMBA_MULADD(a[3], b[7]);
+  COMBA_MULADD(q[3], m[7]);
+  COMBA_MULADD(a[4], b[6]);
+  COMBA_MULADD(q[4], m[6]);
+  COMBA_MULADD(a[5], b[5]);
+  COMBA_MULADD(q[5], m[5]);
+  COMBA_MULADD(a[6], b[4]);
+  COMBA_MULADD(q[6], m[4]);
+  COMBA_MULADD(a[7], b[3]);
+  COMBA_MULADD(q[7], m[3]);
+  COMBA_MULADD(a[8], b[2]);
+  COMBA_MULADD(q[8], m[2]);
+  COMBA_MULADD(a[9], b[1]);
+  COMBA_MULADD(q[9], m[1]);
+  COMBA_MULADD(a[10], b[0]);
+  q[10] = c0 * minv;
+  COMBA_MULADD(q[10], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[11]);
+  COMBA_MULADD(q[0], m[11]);
+  COMBA_MULADD(a[1], b[10]);
+  COMBA_MULADD(q[1], m[10]);
+  COMBA_MULADD(a[2], b[9]);
+  COMBA_MULADD(q[2], m[9]);
+  COMBA_MULADD(a[3], b[8]);
+  COMBA_MULADD(q[3], m[8]);
+  COMBA_MULADD(a[4], b[7]);
+  COMBA_MULADD(q[4], m[7]);
+  COMBA_MULADD(a[5], b[6]);
+  COMBA_MULADD(q[5], m[6]);
+  COMBA_MULADD(a[6], b[5]);
+  COMBA_MULADD(q[6], m[5]);
+  COMBA_MULADD(a[7], b[4]);
+  COMBA_MULADD(q[7], m[4]);
+  COMBA_MULADD(a[8], b[3]);
+  COMBA_MULADD(q[8], m[3]);
+  COMBA_MULADD(a[9], b[2]);
+  COMBA_MULADD(q[9], m[2]);
+  COMBA_MULADD(a[10], b[1]);
+  COMBA_MULADD(q[10], m[1]);
+  COMBA_MULADD(a[11], b[0]);
+  q[11] = c0 * minv;
+  COMBA_MULADD(q[11], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[12]);
+  COMBA_MULADD(q[0], m[12]);
+  COMBA_MULADD(a[1], b[11]);
+  COMBA_MULADD(q[1], m[11]);
+  COMBA_MULADD(a[2], b[10]);
+  COMBA_MULADD(q[2], m[10]);
+  COMBA_MULADD(a[3], b[9]);
+  COMBA_MULADD(q[3], m[9]);
+  COMBA_MULADD(a[4], b[8]);
+  COMBA_MULADD(q[4], m[8]);
+  COMBA_MULADD(a[5], b[7]);
+  COMBA_MULADD(q[5], m[7]);
+  COMBA_MULADD(a[6], b[6]);
+  COMBA_MULADD(q[6], m[6]);
+  COMBA_MULADD(a[7], b[5]);
+  COMBA_MULADD(q[7], m[5]);
+  COMBA_MULADD(a[8], b[4]);
+  COMBA_MULADD(q[8], m[4]);
+  COMBA_MULADD(a[9], b[3]);
+  COMBA_MULADD(q[9], m[3]);
+  COMBA_MULADD(a[10], b[2]);
+  COMBA_MULADD(q[10], m[2]);
+  COMBA_MULADD(a[11], b[1]);
+  COMBA_MULADD(q[11], m[1]);
+  COMBA_MULADD(a[12], b[0]);
+  q[12] = c0 * minv;
+  COMBA_MULADD(q[12], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[13]);
+  COMBA_MULADD(q[0], m[13]);
+  COMBA_MULADD(a[1], b[12]);
+  COMBA_MULADD(q[1], m[12]);
+  COMBA_MULADD(a[2], b[11]);
+  COMBA_MULADD(q[2], m[11]);
+  COMBA_MULADD(a[3], b[10]);
+  COMBA_MULADD(q[3], m[10]);
+  COMBA_MULADD(a[4], b[9]);
+  COMBA_MULADD(q[4], m[9]);
+  COMBA_MULADD(a[5], b[8]);
+  COMBA_MULADD(q[5], m[8]);
+  COMBA_MULADD(a[6], b[7]);
+  COMBA_MULADD(q[6], m[7]);
+  COMBA_MULADD(a[7], b[6]);
+  COMBA_MULADD(q[7], m[6]);
+  COMBA_MULADD(a[8], b[5]);
+  COMBA_MULADD(q[8], m[5]);
+  COMBA_MULADD(a[9], b[4]);
+  COMBA_MULADD(q[9], m[4]);
+  COMBA_MULADD(a[10], b[3]);
+  COMBA_MULADD(q[10], m[3]);
+  COMBA_MULADD(a[11], b[2]);
+  COMBA_MULADD(q[11], m[2]);
+  COMBA_MULADD(a[12], b[1]);
+  COMBA_MULADD(q[12], m[1]);
+  COMBA_MULADD(a[13], b[0]);
+  q[13] = c0 * minv;
+  COMBA_MULADD(q[13], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[14]);
+  COMBA_MULADD(q[0], m[14]);
+  COMBA_MULADD(a[1], b[13]);
+  COMBA_MULADD(q[1], m[13]);
+  COMBA_MULADD(a[2], b[12]);
+  COMBA_MULADD(q[2], m[12]);
+  COMBA_MULADD(a[3], b[11]);
+  COMBA_MULADD(q[3], m[11]);
+  COMBA_MULADD(a[4], b[10]);
+  COMBA_MULADD(q[4], m[10]);
+  COMBA_MULADD(a[5], b[9]);
+  COMBA_MULADD(q[5], m[9]);
+  COMBA_MULADD(a[6], b[8]);
+  COMBA_MULADD(q[6], m[8]);
+  COMBA_MULADD(a[7], b[7]);
+  COMBA_MULADD(q[7], m[7]);
+  COMBA_MULADD(a[8], b[6]);
+  COMBA_MULADD(q[8], m[6]);
+  COMBA_MULADD(a[9], b[5]);
+  COMBA_MULADD(q[9], m[5]);
+  COMBA_MULADD(a[10], b[4]);
+  COMBA_MULADD(q[10], m[4]);
+  COMBA_MULADD(a[11], b[3]);
+  COMBA_MULADD(q[11], m[3]);
+  COMBA_MULADD(a[12], b[2]);
+  COMBA_MULADD(q[12], m[2]);
+  COMBA_MULADD(a[13], b[1]);
+  COMBA_MULADD(q[13], m[1]);
+  COMBA_MULADD(a[14], b[0]);
+  q[14] = c0 * minv;
+  COMBA_MULADD(q[14], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[0], b[15]);
+  COMBA_MULADD(q[0], m[15]);
+  COMBA_MULADD(a[1], b[14]);
+  COMBA_MULADD(q[1], m[14]);
+  COMBA_MULADD(a[2], b[13]);
+  COMBA_MULADD(q[2], m[13]);
+  COMBA_MULADD(a[3], b[12]);
+  COMBA_MULADD(q[3], m[12]);
+  COMBA_MULADD(a[4], b[11]);
+  COMBA_MULADD(q[4], m[11]);
+  COMBA_MULADD(a[5], b[10]);
+  COMBA_MULADD(q[5], m[10]);
+  COMBA_MULADD(a[6], b[9]);
+  COMBA_MULADD(q[6], m[9]);
+  COMBA_MULADD(a[7], b[8]);
+  COMBA_MULADD(q[7], m[8]);
+  COMBA_MULADD(a[8], b[7]);
+  COMBA_MULADD(q[8], m[7]);
+  COMBA_MULADD(a[9], b[6]);
+  COMBA_MULADD(q[9], m[6]);
+  COMBA_MULADD(a[10], b[5]);
+  COMBA_MULADD(q[10], m[5]);
+  COMBA_MULADD(a[11], b[4]);
+  COMBA_MULADD(q[11], m[4]);
+  COMBA_MULADD(a[12], b[3]);
+  COMBA_MULADD(q[12], m[3]);
+  COMBA_MULADD(a[13], b[2]);
+  COMBA_MULADD(q[13], m[2]);
+  COMBA_MULADD(a[14], b[1]);
+  COMBA_MULADD(q[14], m[1]);
+  COMBA_MULADD(a[15], b[0]);
+  q[15] = c0 * minv;
+  COMBA_MULADD(q[15], m[0]);
+  COMBA_SHIFT();
+  COMBA_MULADD(a[1], b[15]);
+  COMBA_MULADD(q[1], m[15]);
+  COMBA_MULADD(a[2], b[14]);
+  COMBA_MULADD(q[2], m[14]);
+  COMBA_MULADD(a[3], b[13]);
+  COMBA_MULADD(q[3], m[13]);
+  COMBA_MULADD(a[4], b[12]);
+  COMBA_MULADD(q[4], m[12]);
+  COMBA_MULADD(a[5], b[11]);
+  COMBA_MULADD(q[5], m[11]);
+  COMBA_MULADD(a[6], b[10]);
+  COMBA_MULADD(q[6], m[10]);
+  COMBA_MULADD(a[7], b[9]);
+  COMBA_MULADD(q[7], m[9]);
+  COMBA_MULADD(a[8], b[8]);
+  COMBA_MULADD(q[8], m[8]);
+  COMBA_MULADD(a[9], b[7]);
+  COMBA_MULADD(q[9], m[7]);
+  COMBA_MULADD(a[10], b[6]);
+  COMBA_MULADD(q[10], m[6]);
+  COMBA_MULADD(a[11], b[5]);
+  COMBA_MULADD(q[11], m[5]);
+  COMBA_MULADD(a[12], b[4]);
+  COMBA_MULADD(q[12], m[4]);
+  COMBA_MULADD(a[13], b[3]);
+  COMBA_MULADD(q[13], m[3]);
+  COMBA_MULADD(a[14], b[2]);
+  COMBA_MULADD(q[14], m[2]);
+  COMBA_MULADD(a[15], b[1]);
+  COMBA_MULADD(q[15], m[1]);
+  t[0] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[2], b[15]);
+  COMBA_MULADD(q[2], m[15]);
+  COMBA_MULADD(a[3], b[14]);
+  COMBA_MULADD(q[3], m[14]);
+  COMBA_MULADD(a[4], b[13]);
+  COMBA_MULADD(q[4], m[13]);
+  COMBA_MULADD(a[5], b[12]);
+  COMBA_MULADD(q[5], m[12]);
+  COMBA_MULADD(a[6], b[11]);
+  COMBA_MULADD(q[6], m[11]);
+  COMBA_MULADD(a[7], b[10]);
+  COMBA_MULADD(q[7], m[10]);
+  COMBA_MULADD(a[8], b[9]);
+  COMBA_MULADD(q[8], m[9]);
+  COMBA_MULADD(a[9], b[8]);
+  COMBA_MULADD(q[9], m[8]);
+  COMBA_MULADD(a[10], b[7]);
+  COMBA_MULADD(q[10], m[7]);
+  COMBA_MULADD(a[11], b[6]);
+  COMBA_MULADD(q[11], m[6]);
+  COMBA_MULADD(a[12], b[5]);
+  COMBA_MULADD(q[12], m[5]);
+  COMBA_MULADD(a[13], b[4]);
+  COMBA_MULADD(q[13], m[4]);
+  COMBA_MULADD(a[14], b[3]);
+  COMBA_MULADD(q[14], m[3]);
+  COMBA_MULADD(a[15], b[2]);
+  COMBA_MULADD(q[15], m[2]);
+  t[1] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[3], b[15]);
+  COMBA_MULADD(q[3], m[15]);
+  COMBA_MULADD(a[4], b[14]);
+  COMBA_MULADD(q[4], m[14]);
+  COMBA_MULADD(a[5], b[13]);
+  COMBA_MULADD(q[5], m[13]);
+  COMBA_MULADD(a[6], b[12]);
+  COMBA_MULADD(q[6], m[12]);
+  COMBA_MULADD(a[7], b[11]);
+  COMBA_MULADD(q[7], m[11]);
+  COMBA_MULADD(a[8], b[10]);
+  COMBA_MULADD(q[8], m[10]);
+  COMBA_MULADD(a[9], b[9]);
+  COMBA_MULADD(q[9], m[9]);
+  COMBA_MULADD(a[10], b[8]);
+  COMBA_MULADD(q[10], m[8]);
+  COMBA_MULADD(a[11], b[7]);
+  COMBA_MULADD(q[11], m[7]);
+  COMBA_MULADD(a[12], b[6]);
+  COMBA_MULADD(q[12], m[6]);
+  COMBA_MULADD(a[13], b[5]);
+  COMBA_MULADD(q[13], m[5]);
+  COMBA_MULADD(a[14], b[4]);
+  COMBA_MULADD(q[14], m[4]);
+  COMBA_MULADD(a[15], b[3]);
+  COMBA_MULADD(q[15], m[3]);
+  t[2] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[4], b[15]);
+  COMBA_MULADD(q[4], m[15]);
+  COMBA_MULADD(a[5], b[14]);
+  COMBA_MULADD(q[5], m[14]);
+  COMBA_MULADD(a[6], b[13]);
+  COMBA_MULADD(q[6], m[13]);
+  COMBA_MULADD(a[7], b[12]);
+  COMBA_MULADD(q[7], m[12]);
+  COMBA_MULADD(a[8], b[11]);
+  COMBA_MULADD(q[8], m[11]);
+  COMBA_MULADD(a[9], b[10]);
+  COMBA_MULADD(q[9], m[10]);
+  COMBA_MULADD(a[10], b[9]);
+  COMBA_MULADD(q[10], m[9]);
+  COMBA_MULADD(a[11], b[8]);
+  COMBA_MULADD(q[11], m[8]);
+  COMBA_MULADD(a[12], b[7]);
+  COMBA_MULADD(q[12], m[7]);
+  COMBA_MULADD(a[13], b[6]);
+  COMBA_MULADD(q[13], m[6]);
+  COMBA_MULADD(a[14], b[5]);
+  COMBA_MULADD(q[14], m[5]);
+  COMBA_MULADD(a[15], b[4]);
+  COMBA_MULADD(q[15], m[4]);
+  t[3] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[5], b[15]);
+  COMBA_MULADD(q[5], m[15]);
+  COMBA_MULADD(a[6], b[14]);
+  COMBA_MULADD(q[6], m[14]);
+  COMBA_MULADD(a[7], b[13]);
+  COMBA_MULADD(q[7], m[13]);
+  COMBA_MULADD(a[8], b[12]);
+  COMBA_MULADD(q[8], m[12]);
+  COMBA_MULADD(a[9], b[11]);
+  COMBA_MULADD(q[9], m[11]);
+  COMBA_MULADD(a[10], b[10]);
+  COMBA_MULADD(q[10], m[10]);
+  COMBA_MULADD(a[11], b[9]);
+  COMBA_MULADD(q[11], m[9]);
+  COMBA_MULADD(a[12], b[8]);
+  COMBA_MULADD(q[12], m[8]);
+  COMBA_MULADD(a[13], b[7]);
+  COMBA_MULADD(q[13], m[7]);
+  COMBA_MULADD(a[14], b[6]);
+  COMBA_MULADD(q[14], m[6]);
+  COMBA_MULADD(a[15], b[5]);
+  COMBA_MULADD(q[15], m[5]);
+  t[4] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[6], b[15]);
+  COMBA_MULADD(q[6], m[15]);
+  COMBA_MULADD(a[7], b[14]);
+  COMBA_MULADD(q[7], m[14]);
+  COMBA_MULADD(a[8], b[13]);
+  COMBA_MULADD(q[8], m[13]);
+  COMBA_MULADD(a[9], b[12]);
+  COMBA_MULADD(q[9], m[12]);
+  COMBA_MULADD(a[10], b[11]);
+  COMBA_MULADD(q[10], m[11]);
+  COMBA_MULADD(a[11], b[10]);
+  COMBA_MULADD(q[11], m[10]);
+  COMBA_MULADD(a[12], b[9]);
+  COMBA_MULADD(q[12], m[9]);
+  COMBA_MULADD(a[13], b[8]);
+  COMBA_MULADD(q[13], m[8]);
+  COMBA_MULADD(a[14], b[7]);
+  COMBA_MULADD(q[14], m[7]);
+  COMBA_MULADD(a[15], b[6]);
+  COMBA_MULADD(q[15], m[6]);
+  t[5] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[7], b[15]);
+  COMBA_MULADD(q[7], m[15]);
+  COMBA_MULADD(a[8], b[14]);
+  COMBA_MULADD(q[8], m[14]);
+  COMBA_MULADD(a[9], b[13]);
+  COMBA_MULADD(q[9], m[13]);
+  COMBA_MULADD(a[10], b[12]);
+  COMBA_MULADD(q[10], m[12]);
+  COMBA_MULADD(a[11], b[11]);
+  COMBA_MULADD(q[11], m[11]);
+  COMBA_MULADD(a[12], b[10]);
+  COMBA_MULADD(q[12], m[10]);
+  COMBA_MULADD(a[13], b[9]);
+  COMBA_MULADD(q[13], m[9]);
+  COMBA_MULADD(a[14], b[8]);
+  COMBA_MULADD(q[14], m[8]);
+  COMBA_MULADD(a[15], b[7]);
+  COMBA_MULADD(q[15], m[7]);
+  t[6] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[8], b[15]);
+  COMBA_MULADD(q[8], m[15]);
+  COMBA_MULADD(a[9], b[14]);
+  COMBA_MULADD(q[9], m[14]);
+  COMBA_MULADD(a[10], b[13]);
+  COMBA_MULADD(q[10], m[13]);
+  COMBA_MULADD(a[11], b[12]);
+  COMBA_MULADD(q[11], m[12]);
+  COMBA_MULADD(a[12], b[11]);
+  COMBA_MULADD(q[12], m[11]);
+  COMBA_MULADD(a[13], b[10]);
+  COMBA_MULADD(q[13], m[10]);
+  COMBA_MULADD(a[14], b[9]);
+  COMBA_MULADD(q[14], m[9]);
+  COMBA_MULADD(a[15], b[8]);
+  COMBA_MULADD(q[15], m[8]);
+  t[7] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[9], b[15]);
+  COMBA_MULADD(q[9], m[15]);
+  COMBA_MULADD(a[10], b[14]);
+  COMBA_MULADD(q[10], m[14]);
+  COMBA_MULADD(a[11], b[13]);
+  COMBA_MULADD(q[11], m[13]);
+  COMBA_MULADD(a[12], b[12]);
+  COMBA_MULADD(q[12], m[12]);
+  COMBA_MULADD(a[13], b[11]);
+  COMBA_MULADD(q[13], m[11]);
+  COMBA_MULADD(a[14], b[10]);
+  COMBA_MULADD(q[14], m[10]);
+  COMBA_MULADD(a[15], b[9]);
+  COMBA_MULADD(q[15], m[9]);
+  t[8] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[10], b[15]);
+  COMBA_MULADD(q[10], m[15]);
+  COMBA_MULADD(a[11], b[14]);
+  COMBA_MULADD(q[11], m[14]);
+  COMBA_MULADD(a[12], b[13]);
+  COMBA_MULADD(q[12], m[13]);
+  COMBA_MULADD(a[13], b[12]);
+  COMBA_MULADD(q[13], m[12]);
+  COMBA_MULADD(a[14], b[11]);
+  COMBA_MULADD(q[14], m[11]);
+  COMBA_MULADD(a[15], b[10]);
+  COMBA_MULADD(q[15], m[10]);
+  t[9] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[11], b[15]);
+  COMBA_MULADD(q[11], m[15]);
+  COMBA_MULADD(a[12], b[14]);
+  COMBA_MULADD(q[12], m[14]);
+  COMBA_MULADD(a[13], b[13]);
+  COMBA_MULADD(q[13], m[13]);
+  COMBA_MULADD(a[14], b[12]);
+  COMBA_MULADD(q[14], m[12]);
+  COMBA_MULADD(a[15], b[11]);
+  COMBA_MULADD(q[15], m[11]);
+  t[10] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[12], b[15]);
+  COMBA_MULADD(q[12], m[15]);
+  COMBA_MULADD(a[13], b[14]);
+  COMBA_MULADD(q[13], m[14]);
+  COMBA_MULADD(a[14], b[13]);
+  COMBA_MULADD(q[14], m[13]);
+  COMBA_MULADD(a[15], b[12]);
+  COMBA_MULADD(q[15], m[12]);
+  t[11] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[13], b[15]);
+  COMBA_MULADD(q[13], m[15]);
+  COMBA_MULADD(a[14], b[14]);
+  COMBA_MULADD(q[14], m[14]);
+  COMBA_MULADD(a[15], b[13]);
+  COMBA_MULADD(q[15], m[13]);
+  t[12] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[14], b[15]);
+  COMBA_MULADD(q[14], m[15]);
+  COMBA_MULADD(a[15], b[14]);
+  COMBA_MULADD(q[15], m[14]);
+  t[13] = c0;
+  COMBA_SHIFT();
+  COMBA_MULADD(a[15], b[15]);
+  COMBA_MULADD(q[15], m[15]);
+  t[14] = c0;
+  COMBA_SHIFT();
+  t[15] = c0;
+  COMBA_SHIFT();
+  t[16] = c0;
+  bigint_comba_mont_finish(r, t, m, 16);
+}
+
+static inline void bigint_comba_mul_n(Limb *r, const Limb *a,
+                                      const Limb *b, size_t n) {
+  switch (n) {
+  case 1:
+    bigint_comba_mul_1(r, a, b);
+    return;
+  case 2:
+    bigint_comba_mul_2(r, a, b);
+    return;
+  case 3:
+    bigint_comba_mul_3(r, a, b);
+    return;
+  case 4:
+    bigint_comba_mul_4(r, a, b);
+    return;
+  case 5:
+    bigint_comba_mul_5(r, a, b);
+    return;
+  case 6:
+    bigint_comba_mul_6(r, a, b);
+    return;
+  case 7:
+    bigint_comba_mul_7(r, a, b);
+    return;
+  case 8:
+    bigint_comba_mul_8(r, a, b);
+    return;
+  case 9:
+    bigint_comba_mul_9(r, a, b);
+    return;
+  case 10:
+    bigint_comba_mul_10(r, a, b);
+    return;
+  case 11:
+    bigint_comba_mul_11(r, a, b);
+    return;
+  case 12:
+    bigint_comba_mul_12(r, a, b);
+    return;
+  case 13:
+    bigint_comba_mul_13(r, a, b);
+    return;
+  case 14:
+    bigint_comba_mul_14(r, a, b);
+    return;
+  case 15:
+    bigint_comba_mul_15(r, a, b);
+    return;
+  case 16:
+    bigint_comba_mul_16(r, a, b);
+    return;
+  }
+}
+
+static inline void bigint_comba_sqr_n(Limb *r, const Limb *a, size_t n) {
+  switch (n) {
+  case 1:
+    bigint_comba_sqr_1(r, a);
+    return;
+  case 2:
+    bigint_comba_sqr_2(r, a);
+    return;
+  case 3:
+    bigint_comba_sqr_3(r, a);
+    return;
+  case 4:
+    bigint_comba_sqr_4(r, a);
+    return;
+  case 5:
+    bigint_comba_sqr_5(r, a);
+    return;
+  case 6:
+    bigint_comba_sqr_6(r, a);
+    return;
+  case 7:
+    bigint_comba_sqr_7(r, a);
+    return;
+  case 8:
+    bigint_comba_sqr_8(r, a);
+    return;
+  case 9:
+    bigint_comba_sqr_9(r, a);
+    return;
+  case 10:
+    bigint_comba_sqr_10(r, a);
+    return;
+  case 11:
+    bigint_comba_sqr_11(r, a);
+    return;
+  case 12:
+    bigint_comba_sqr_12(r, a);
+    return;
+  case 13:
+    bigint_comba_sqr_13(r, a);
+    return;
+  case 14:
+    bigint_comba_sqr_14(r, a);
+    return;
+  case 15:
+    bigint_comba_sqr_15(r, a);
+    return;
+  case 16:
+    bigint_comba_sqr_16(r, a);
+    return;
+  }
+}
+
+static inline void bigint_comba_mont_n(Limb *r, const Limb *a, const Limb *b,
+                                       const Limb *m, Limb minv, size_t n) {
+  switch (n) {
+  case 1:
+    bigint_comba_mont_1(r, a, b, m, minv);
+    return;
+  case 2:
+    bigint_comba_mont_2(r, a, b, m, minv);
+    return;
+  case 3:
+    bigint_comba_mont_3(r, a, b, m, minv);
+    return;
+  case 4:
+    bigint_comba_mont_4(r, a, b, m, minv);
+    return;
+  case 5:
+    bigint_comba_mont_5(r, a, b, m, minv);
+    return;
+  case 6:
+    bigint_comba_mont_6(r, a, b, m, minv);
+    return;
+  case 7:
+    bigint_comba_mont_7(r, a, b, m, minv);
+    return;
+  case 8:
+    bigint_comba_mont_8(r, a, b, m, minv);
+    return;
+  case 9:
+    bigint_comba_mont_9(r, a, b, m, minv);
+    return;
+  case 10:
+    bigint_comba_mont_10(r, a, b, m, minv);
+    return;
+  case 11:
+    bigint_comba_mont_11(r, a, b, m, minv);
+    return;
+  case 12:
+    bigint_comba_mont_12(r, a, b, m, minv);
+    return;
+  case 13:
+    bigint_comba_mont_13(r, a, b, m, minv);
+    return;
+  case 14:
+    bigint_comba_mont_14(r, a, b, m, minv);
+    return;
+  case 15:
+    bigint_comba_mont_15(r, a, b, m, minv);
+    return;
+  case 16:
+    bigint_comba_mont_16(r, a, b, m, minv);
+    return;
+  }
+}
+#endif
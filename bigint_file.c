@@ -0,0 +1,320 @@
+#define _POSIX_C_SOURCE 200809L
+#include "bigint.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define FILE_MAGIC 0x46494742u
+#define FILE_VERSION 1u
+#define FILE_INDEX_ALIGN 8
+#define FILE_SIGN_BIT ((uint64_t)1 << 63)
+#define FILE_SWAP_CHUNK 64
+
+// index_offset stays 0 until the writer is closed, a reader rejects such a
+// file as incomplete
+typedef struct file_header {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t limb_size;
+  uint32_t reserved;
+  uint64_t count;
+  uint64_t index_offset;
+} file_header;
+
+static uint32_t swap32(uint32_t x) {
+  return (x >> 24) | ((x >> 8) & 0xff00u) | ((x << 8) & 0xff0000u) | (x << 24);
+}
+
+static uint64_t swap64(uint64_t x) {
+  return ((uint64_t)swap32((uint32_t)x) << 32) | swap32((uint32_t)(x >> 32));
+}
+
+static Limb swap_limb(Limb x) {
+#if LIMB_SIZE_BYTES == 8
+  return swap64(x);
+#elif LIMB_SIZE_BYTES == 4
+  return swap32(x);
+#elif LIMB_SIZE_BYTES == 2
+  return (Limb)((x >> 8) | (x << 8));
+#else
+  return x;
+#endif
+}
+
+static bool host_big_endian(void) {
+  const uint16_t one = 1;
+  uint8_t low;
+  memcpy(&low, &one, 1);
+  return low == 0;
+}
+
+static file_header writer_header(const bigint_file_writer *w, uint64_t count,
+                                 uint64_t index_offset) {
+  file_header header = {FILE_MAGIC, FILE_VERSION, LIMB_SIZE_BYTES, 0, count,
+                        index_offset};
+  if (w->swap) {
+    header.magic = swap32(header.magic);
+    header.version = swap32(header.version);
+    header.limb_size = swap32(header.limb_size);
+    header.count = swap64(header.count);
+    header.index_offset = swap64(header.index_offset);
+  }
+  return header;
+}
+
+// limbs in the file's byte order, swapped through a small buffer
+static bool writer_limbs(const bigint_file_writer *w, const Limb *limbs,
+                         size_t len) {
+  if (!w->swap) {
+    return fwrite(limbs, LIMB_SIZE_BYTES, len, w->fp) == len;
+  }
+  Limb chunk[FILE_SWAP_CHUNK];
+  for (size_t i = 0; i < len; i += FILE_SWAP_CHUNK) {
+    const size_t n = len - i < FILE_SWAP_CHUNK ? len - i : FILE_SWAP_CHUNK;
+    for (size_t j = 0; j < n; j++) {
+      chunk[j] = swap_limb(limbs[i + j]);
+    }
+    if (fwrite(chunk, LIMB_SIZE_BYTES, n, w->fp) != n) {
+      return false;
+    }
+  }
+  return true;
+}
+
+BigIntError bigint_file_writer_open(const char *path, BigIntByteOrder order,
+                                    bigint_file_writer *w) {
+  w->swap = order != ByteOrderNative &&
+            (order == ByteOrderBig) != host_big_endian();
+  const file_header header = writer_header(w, 0, 0);
+  w->fp = fopen(path, "wb");
+  if (w->fp == NULL) {
+    return IOError;
+  }
+  w->offset = sizeof(header);
+  w->count = 0;
+  w->capacity = 0;
+  w->index = NULL;
+  w->failed = false;
+  if (fwrite(&header, sizeof(header), 1, w->fp) != 1) {
+    fclose(w->fp);
+    w->fp = NULL;
+    return IOError;
+  }
+  return Ok;
+}
+
+BigIntError bigint_file_writer_append(bigint_file_writer *w, const bigint *a) {
+  if (w->failed) {
+    return IOError;
+  }
+  size_t len = a->len;
+  while (len > 0 && a->limbs[len - 1] == 0) {
+    len--;
+  }
+  if (w->count == w->capacity) {
+    const size_t capacity = w->capacity ? 2 * w->capacity : 64;
+    uint64_t *index = realloc(w->index, capacity * 2 * sizeof(uint64_t));
+    if (index == NULL) {
+      return MemoryError;
+    }
+    w->index = index;
+    w->capacity = capacity;
+  }
+  if (len > 0 && !writer_limbs(w, a->limbs, len)) {
+    // part of the limbs may be in the file, the offsets can't be trusted
+    w->failed = true;
+    return IOError;
+  }
+  w->index[2 * w->count] = w->offset;
+  w->index[2 * w->count + 1] =
+      (uint64_t)len | (len > 0 && a->negative ? FILE_SIGN_BIT : 0);
+  w->count++;
+  w->offset += (uint64_t)len * LIMB_SIZE_BYTES;
+  return Ok;
+}
+
+BigIntError bigint_file_writer_close(bigint_file_writer *w) {
+  static const uint8_t padding[FILE_INDEX_ALIGN] = {0};
+  const size_t pad = (size_t)(-w->offset % FILE_INDEX_ALIGN);
+  const file_header header = writer_header(w, w->count, w->offset + pad);
+  for (size_t i = 0; w->swap && i < 2 * w->count; i++) {
+    w->index[i] = swap64(w->index[i]);
+  }
+  // after a failed append the header is left unpatched, readers reject it
+  bool ok = !w->failed &&
+            (pad == 0 || fwrite(padding, 1, pad, w->fp) == pad) &&
+            (w->count == 0 || fwrite(w->index, 2 * sizeof(uint64_t), w->count,
+                                     w->fp) == w->count) &&
+            fseeko(w->fp, 0, SEEK_SET) == 0 &&
+            fwrite(&header, sizeof(header), 1, w->fp) == 1;
+  ok = (fclose(w->fp) == 0) && ok;
+  free(w->index);
+  w->fp = NULL;
+  w->index = NULL;
+  return ok ? Ok : IOError;
+}
+
+static uint64_t file_u64(const bigint_file *f, const uint8_t *p) {
+  uint64_t x;
+  memcpy(&x, p, sizeof(x));
+  return f->swap ? swap64(x) : x;
+}
+
+static BigIntError file_validate(bigint_file *f) {
+  file_header header;
+  if (f->size < sizeof(header)) {
+    return InvalidFormat;
+  }
+  memcpy(&header, f->data, sizeof(header));
+  if (header.magic == swap32(FILE_MAGIC)) {
+    f->swap = true;
+    header.version = swap32(header.version);
+    header.limb_size = swap32(header.limb_size);
+    header.count = swap64(header.count);
+    header.index_offset = swap64(header.index_offset);
+  } else if (header.magic != FILE_MAGIC) {
+    return InvalidFormat;
+  }
+  const uint32_t limb_size = header.limb_size;
+  if (header.version != FILE_VERSION ||
+      (limb_size != 1 && limb_size != 2 && limb_size != 4 && limb_size != 8) ||
+      header.index_offset < sizeof(header) || header.index_offset > f->size ||
+      (f->size - header.index_offset) / (2 * sizeof(uint64_t)) !=
+          header.count ||
+      (f->size - header.index_offset) % (2 * sizeof(uint64_t)) != 0) {
+    return InvalidFormat;
+  }
+  f->count = header.count;
+  f->limb_size = limb_size;
+  f->index = f->data + header.index_offset;
+  return Ok;
+}
+
+BigIntError bigint_file_open(const char *path, bigint_file *f) {
+  f->data = NULL;
+  f->size = 0;
+  f->count = 0;
+  f->swap = false;
+  const int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return IOError;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    return IOError;
+  }
+  if ((size_t)st.st_size < sizeof(file_header)) {
+    close(fd);
+    return InvalidFormat;
+  }
+  void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return IOError;
+  }
+  f->data = data;
+  f->size = st.st_size;
+  const BigIntError result = file_validate(f);
+  if (result != Ok) {
+    bigint_file_close(f);
+  }
+  return result;
+}
+
+// the i-th value's limb count and sign, InvalidFormat when i is out of range
+// or the entry does not lie between the header and the index
+static BigIntError file_entry(const bigint_file *f, size_t i,
+                              const uint8_t **limbs, size_t *len,
+                              bool *negative) {
+  if (i >= f->count) {
+    return InvalidFormat;
+  }
+  const uint8_t *entry = f->index + i * 2 * sizeof(uint64_t);
+  const uint64_t offset = file_u64(f, entry);
+  const uint64_t packed = file_u64(f, entry + sizeof(uint64_t));
+  const uint64_t n = packed & ~FILE_SIGN_BIT;
+  const uint64_t end = (uint64_t)(f->index - f->data);
+  if (offset < sizeof(file_header) || offset > end ||
+      offset % f->limb_size != 0 || n > (end - offset) / f->limb_size) {
+    return InvalidFormat;
+  }
+  // views are handed out as stored, so only normalized entries are accepted
+  const uint8_t *top = f->data + offset + (n ? n - 1 : 0) * f->limb_size;
+  bool top_zero = true;
+  for (size_t j = 0; j < f->limb_size && n > 0; j++) {
+    top_zero &= top[j] == 0;
+  }
+  if (top_zero && (n > 0 || (packed & FILE_SIGN_BIT) != 0)) {
+    return InvalidFormat;
+  }
+  *limbs = f->data + offset;
+  *len = n;
+  *negative = (packed & FILE_SIGN_BIT) != 0;
+  return Ok;
+}
+
+BigIntError bigint_file_view(const bigint_file *f, size_t i, bigint *view) {
+  if (f->limb_size != LIMB_SIZE_BYTES || f->swap) {
+    return NotImplemented;
+  }
+  const uint8_t *limbs;
+  size_t len;
+  bool negative;
+  const BigIntError result = file_entry(f, i, &limbs, &len, &negative);
+  if (result != Ok) {
+    return result;
+  }
+  view->limbs = (Limb *)limbs;
+  view->capacity = 0;
+  view->len = len;
+  view->negative = negative;
+  return Ok;
+}
+
+// A foreign layout is converted byte by byte in order of significance, byte
+// j of a file limb sits at j or limb_size - 1 - j by the file's byte order.
+BigIntError bigint_file_get(const bigint_file *f, size_t i, bigint *out) {
+  const uint8_t *limbs;
+  size_t len;
+  bool negative;
+  BigIntError result = file_entry(f, i, &limbs, &len, &negative);
+  if (result != Ok) {
+    return result;
+  }
+  const size_t bytes = len * f->limb_size;
+  result = bigint_resize(out, 0);
+  if (result == Ok) {
+    result = bigint_resize(out, (bytes + LIMB_SIZE_BYTES - 1) / LIMB_SIZE_BYTES);
+  }
+  if (result != Ok) {
+    return result;
+  }
+  if (f->limb_size == LIMB_SIZE_BYTES && !f->swap) {
+    memcpy(out->limbs, limbs, bytes);
+  } else {
+    const bool reversed = host_big_endian() != f->swap;
+    for (size_t k = 0; k < bytes; k++) {
+      const size_t j = k % f->limb_size;
+      const size_t at = k - j + (reversed ? f->limb_size - 1 - j : j);
+      out->limbs[k / LIMB_SIZE_BYTES] |= (Limb)limbs[at]
+                                         << (8 * (k % LIMB_SIZE_BYTES));
+    }
+  }
+  bigint_fit(out);
+  out->negative = negative && out->len > 0;
+  return Ok;
+}
+
+void bigint_file_close(bigint_file *f) {
+  if (f->data != NULL) {
+    munmap((void *)f->data, f->size);
+  }
+  f->data = NULL;
+  f->index = NULL;
+  f->size = 0;
+  f->count = 0;
+}
@@ -0,0 +1,48 @@
+#include "bigint_fixed.h"
+
+// r = 2^(LIMB_SIZE_BITS limbs) mod modulus, padded to n limbs
+static BigIntError power_mod(const bigint *modulus, size_t limbs, Limb *r,
+                             size_t n) {
+  bigint dividend = BIGINT_ZERO;
+  bigint q = BIGINT_ZERO;
+  bigint rem = BIGINT_ZERO;
+  BigIntError result = bigint_resize(&dividend, limbs + 1);
+  if (result == Ok) {
+    dividend.limbs[limbs] = 1;
+    result = bigint_div(&dividend, modulus, &q, &rem);
+  }
+  if (result == Ok) {
+    result = bigint_fixed_from_bigint_n(&rem, r, n);
+  }
+  bigint_free_limbs(&dividend);
+  bigint_free_limbs(&q);
+  bigint_free_limbs(&rem);
+  return result;
+}
+
+BigIntError bigint_fixed_mont_setup(const Limb *modulus, size_t n, Limb *one,
+                                    Limb *rr, Limb *minv) {
+  if ((modulus[0] & 1) == 0) {
+    size_t i = 0;
+    while (i < n && modulus[i] == 0) {
+      i++;
+    }
+    return i == n ? DivisionByZeroError : NotImplemented;
+  }
+  bigint m = BIGINT_ZERO;
+  BigIntError result = bigint_fixed_to_bigint_n(modulus, &m, n);
+  if (result == Ok) {
+    result = power_mod(&m, n, one, n);
+  }
+  if (result == Ok) {
+    result = power_mod(&m, 2 * n, rr, n);
+  }
+  bigint_free_limbs(&m);
+
+  Limb inverse = modulus[0];
+  for (size_t bits = 3; bits < LIMB_SIZE_BITS; bits *= 2) {
+    inverse *= 2 - modulus[0] * inverse;
+  }
+  *minv = -inverse;
+  return result;
+}
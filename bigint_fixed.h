@@ -0,0 +1,385 @@
+#ifndef BIGINT_FIXED_H
+#define BIGINT_FIXED_H
+#include "bigint.h"
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bigint_comba_kernels.h"
+
+// Fixed width unsigned integers with inline limbs. The _n helpers take the
+// limb count as an argument and are only called with a constant, so after
+// inlining every loop has a known trip count. Only widths up to
+// COMBA_MAX_LIMBS (1024 bits with 64-bit limbs) multiply, square and reduce
+// through the straight-line comba kernels, called directly so that with a
+// constant width the dispatch folds away. Wider widths such as 2048 and 4096
+// bits use the schoolbook loops below, with a separate squaring loop. Nothing
+// allocates except the Montgomery setup.
+//
+// Fixed Montgomery contexts use R = 2^(LIMB_SIZE_BITS n) for an n limb
+// width, unlike struct Montgomery which uses R = 2^bit_length(modulus).
+
+#define BIGINT_FIXED_MAX_LIMBS (4096 / LIMB_SIZE_BITS)
+
+static inline Limb bigint_fixed_add_n(const Limb *a, const Limb *b, Limb *r,
+                                      size_t n) {
+  Limb carry = 0;
+  for (size_t i = 0; i < n; i++) {
+    const DoubleLimb sum = (DoubleLimb)a[i] + b[i] + carry;
+    r[i] = (Limb)sum;
+    carry = (Limb)(sum >> LIMB_SIZE_BITS);
+  }
+  return carry;
+}
+
+static inline Limb bigint_fixed_sub_n(const Limb *a, const Limb *b, Limb *r,
+                                      size_t n) {
+  Limb borrow = 0;
+  for (size_t i = 0; i < n; i++) {
+    const Limb x = a[i] - b[i];
+    const Limb y = x - borrow;
+    borrow = (a[i] < b[i]) | (x < borrow);
+    r[i] = y;
+  }
+  return borrow;
+}
+
+static inline int bigint_fixed_cmp_n(const Limb *a, const Limb *b, size_t n) {
+  for (size_t i = n; i-- > 0;) {
+    if (a[i] != b[i]) {
+      return a[i] < b[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+// r has 2 n limbs and may overlap a or b
+static inline void bigint_fixed_mul_n(const Limb *a, const Limb *b, Limb *r,
+                                      size_t n) {
+  Limb t[2 * BIGINT_FIXED_MAX_LIMBS];
+  if (n <= COMBA_MAX_LIMBS) {
+    bigint_comba_mul_n(t, a, b, n);
+  } else {
+    for (size_t i = 0; i < n; i++) {
+      t[i] = 0;
+    }
+    for (size_t i = 0; i < n; i++) {
+      Limb carry = 0;
+      for (size_t j = 0; j < n; j++) {
+        const DoubleLimb p = (DoubleLimb)a[i] * b[j] + t[i + j] + carry;
+        t[i + j] = (Limb)p;
+        carry = (Limb)(p >> LIMB_SIZE_BITS);
+      }
+      t[i + n] = carry;
+    }
+  }
+  memcpy(r, t, 2 * n * sizeof(Limb));
+}
+
+// r has 2 n limbs and may overlap a. Above COMBA_MAX_LIMBS the cross products
+// are formed once, doubled and the squares of the limbs added in.
+static inline void bigint_fixed_sqr_n(const Limb *a, Limb *r, size_t n) {
+  Limb t[2 * BIGINT_FIXED_MAX_LIMBS];
+  if (n <= COMBA_MAX_LIMBS) {
+    bigint_comba_sqr_n(t, a, n);
+  } else {
+    for (size_t i = 0; i < n; i++) {
+      t[i] = 0;
+    }
+    for (size_t i = 0; i < n; i++) {
+      Limb carry = 0;
+      for (size_t j = i + 1; j < n; j++) {
+        const DoubleLimb p = (DoubleLimb)a[i] * a[j] + t[i + j] + carry;
+        t[i + j] = (Limb)p;
+        carry = (Limb)(p >> LIMB_SIZE_BITS);
+      }
+      t[i + n] = carry;
+    }
+    Limb top = 0;
+    for (size_t i = 0; i < 2 * n; i++) {
+      const Limb limb = t[i];
+      t[i] = (limb << 1) | top;
+      top = limb >> (LIMB_SIZE_BITS - 1);
+    }
+    Limb carry = 0;
+    for (size_t i = 0; i < n; i++) {
+      const DoubleLimb s = (DoubleLimb)a[i] * a[i];
+      const DoubleLimb lo = (DoubleLimb)t[2 * i] + (Limb)s + carry;
+      t[2 * i] = (Limb)lo;
+      const DoubleLimb hi = (DoubleLimb)t[2 * i + 1] +
+                            (Limb)(s >> LIMB_SIZE_BITS) +
+                            (Limb)(lo >> LIMB_SIZE_BITS);
+      t[2 * i + 1] = (Limb)hi;
+      carry = (Limb)(hi >> LIMB_SIZE_BITS);
+    }
+  }
+  memcpy(r, t, 2 * n * sizeof(Limb));
+}
+
+// shifts drop the bits that leave the width, r may be a
+static inline void bigint_fixed_shl_n(const Limb *a, size_t shift, Limb *r,
+                                      size_t n) {
+  const size_t limbs = shift / LIMB_SIZE_BITS;
+  const size_t bits = shift % LIMB_SIZE_BITS;
+  for (size_t i = n; i-- > 0;) {
+    Limb limb = 0;
+    if (i >= limbs) {
+      limb = a[i - limbs] << bits;
+      if (bits != 0 && i > limbs) {
+        limb |= a[i - limbs - 1] >> (LIMB_SIZE_BITS - bits);
+      }
+    }
+    r[i] = limb;
+  }
+}
+
+static inline void bigint_fixed_shr_n(const Limb *a, size_t shift, Limb *r,
+                                      size_t n) {
+  const size_t limbs = shift / LIMB_SIZE_BITS;
+  const size_t bits = shift % LIMB_SIZE_BITS;
+  for (size_t i = 0; i < n; i++) {
+    Limb limb = 0;
+    if (limbs < n - i) {
+      limb = a[i + limbs] >> bits;
+      if (bits != 0 && limbs + 1 < n - i) {
+        limb |= a[i + limbs + 1] << (LIMB_SIZE_BITS - bits);
+      }
+    }
+    r[i] = limb;
+  }
+}
+
+// NotImplemented for negative x, ResultMemoryTooSmall when it does not fit
+static inline BigIntError bigint_fixed_from_bigint_n(const bigint *x, Limb *r,
+                                                     size_t n) {
+  if (x->negative && x->len > 0) {
+    return NotImplemented;
+  }
+  if (x->len > n) {
+    return ResultMemoryTooSmall;
+  }
+  for (size_t i = 0; i < n; i++) {
+    r[i] = i < x->len ? x->limbs[i] : 0;
+  }
+  return Ok;
+}
+
+static inline BigIntError bigint_fixed_to_bigint_n(const Limb *a, bigint *r,
+                                                   size_t n) {
+  const BigIntError result = bigint_resize(r, n);
+  if (result != Ok) {
+    return result;
+  }
+  memcpy(r->limbs, a, n * sizeof(Limb));
+  bigint_fit(r);
+  return Ok;
+}
+
+// Computes one = R mod m, rr = R^2 mod m and minv = -m^-1 mod 2^LIMB_SIZE_BITS
+// for an odd n limb modulus
+BigIntError bigint_fixed_mont_setup(const Limb *modulus, size_t n, Limb *one,
+                                    Limb *rr, Limb *minv);
+
+// r = a b / R mod m for a, b < m, r may overlap a or b
+static inline void bigint_fixed_mont_mul_n(const Limb *a, const Limb *b,
+                                           const Limb *m, Limb minv, Limb *r,
+                                           size_t n) {
+  if (n <= COMBA_MAX_LIMBS) {
+    bigint_comba_mont_n(r, a, b, m, minv, n);
+    return;
+  }
+  // coarsely integrated operand scanning, t < 2 m at the end
+  Limb t[BIGINT_FIXED_MAX_LIMBS + 2];
+  for (size_t i = 0; i < n + 2; i++) {
+    t[i] = 0;
+  }
+  for (size_t i = 0; i < n; i++) {
+    Limb carry = 0;
+    for (size_t j = 0; j < n; j++) {
+      const DoubleLimb p = (DoubleLimb)a[j] * b[i] + t[j] + carry;
+      t[j] = (Limb)p;
+      carry = (Limb)(p >> LIMB_SIZE_BITS);
+    }
+    DoubleLimb sum = (DoubleLimb)t[n] + carry;
+    t[n] = (Limb)sum;
+    t[n + 1] = (Limb)(sum >> LIMB_SIZE_BITS);
+
+    const Limb q = t[0] * minv;
+    DoubleLimb p = (DoubleLimb)q * m[0] + t[0];
+    carry = (Limb)(p >> LIMB_SIZE_BITS);
+    for (size_t j = 1; j < n; j++) {
+      p = (DoubleLimb)q * m[j] + t[j] + carry;
+      t[j - 1] = (Limb)p;
+      carry = (Limb)(p >> LIMB_SIZE_BITS);
+    }
+    sum = (DoubleLimb)t[n] + carry;
+    t[n - 1] = (Limb)sum;
+    t[n] = t[n + 1] + (Limb)(sum >> LIMB_SIZE_BITS);
+  }
+  Limb d[BIGINT_FIXED_MAX_LIMBS];
+  const Limb borrow = bigint_fixed_sub_n(t, m, d, n);
+  memcpy(r, t[n] >= borrow ? d : t, n * sizeof(Limb));
+}
+
+// r = a^2 / R mod m for a < m, r may be a. Above COMBA_MAX_LIMBS this squares
+// first and then reduces, saving about a quarter of the limb products.
+static inline void bigint_fixed_mont_sqr_n(const Limb *a, const Limb *m,
+                                           Limb minv, Limb *r, size_t n) {
+  if (n <= COMBA_MAX_LIMBS) {
+    bigint_comba_mont_n(r, a, a, m, minv, n);
+    return;
+  }
+  Limb t[2 * BIGINT_FIXED_MAX_LIMBS];
+  bigint_fixed_sqr_n(a, t, n);
+  // each row clears t[i], its carry out of t[i + n] is picked up by the next
+  Limb top = 0;
+  for (size_t i = 0; i < n; i++) {
+    const Limb q = t[i] * minv;
+    Limb carry = 0;
+    for (size_t j = 0; j < n; j++) {
+      const DoubleLimb p = (DoubleLimb)q * m[j] + t[i + j] + carry;
+      t[i + j] = (Limb)p;
+      carry = (Limb)(p >> LIMB_SIZE_BITS);
+    }
+    const DoubleLimb sum = (DoubleLimb)t[i + n] + carry + top;
+    t[i + n] = (Limb)sum;
+    top = (Limb)(sum >> LIMB_SIZE_BITS);
+  }
+  Limb d[BIGINT_FIXED_MAX_LIMBS];
+  const Limb borrow = bigint_fixed_sub_n(t + n, m, d, n);
+  memcpy(r, top >= borrow ? d : t + n, n * sizeof(Limb));
+}
+
+// r = base^exp R^(1 - e) mod m, so Montgomery form in gives Montgomery form
+// out. one is R mod m. Fixed 4-bit windows, exp has n limbs. table has room
+// for 17 n limbs, the window powers and the accumulator, so callers size it
+// for their own width.
+static inline void bigint_fixed_mont_exp_n(const Limb *base, const Limb *exp,
+                                           const Limb *m, Limb minv,
+                                           const Limb *one, Limb *r,
+                                           Limb *table, size_t n) {
+  memcpy(table, one, n * sizeof(Limb));
+  memcpy(table + n, base, n * sizeof(Limb));
+  for (size_t i = 2; i < 16; i++) {
+    bigint_fixed_mont_mul_n(table + (i - 1) * n, base, m, minv, table + i * n,
+                            n);
+  }
+  Limb *acc = table + 16 * n;
+  memcpy(acc, one, n * sizeof(Limb));
+  for (size_t i = n * LIMB_SIZE_BITS; i >= 4;) {
+    i -= 4;
+    for (size_t j = 0; j < 4; j++) {
+      bigint_fixed_mont_sqr_n(acc, m, minv, acc, n);
+    }
+    const size_t window =
+        (exp[i / LIMB_SIZE_BITS] >> (i % LIMB_SIZE_BITS)) & 15;
+    bigint_fixed_mont_mul_n(acc, table + window * n, m, minv, acc, n);
+  }
+  memcpy(r, acc, n * sizeof(Limb));
+}
+
+#define BIGINT_FIXED_DEFINE(BITS)                                              \
+  typedef struct bigint_fixed##BITS {                                          \
+    Limb limbs[BITS / LIMB_SIZE_BITS];                                         \
+  } bigint_fixed##BITS;                                                        \
+  typedef struct bigint_fixed##BITS##_mont {                                   \
+    bigint_fixed##BITS modulus;                                                \
+    bigint_fixed##BITS one;                                                    \
+    bigint_fixed##BITS rr;                                                     \
+    Limb minv;                                                                 \
+  } bigint_fixed##BITS##_mont;                                                 \
+                                                                               \
+  static inline Limb bigint_fixed##BITS##_add(const bigint_fixed##BITS *a,     \
+                                              const bigint_fixed##BITS *b,     \
+                                              bigint_fixed##BITS *r) {         \
+    return bigint_fixed_add_n(a->limbs, b->limbs, r->limbs,                    \
+                              BITS / LIMB_SIZE_BITS);                          \
+  }                                                                            \
+  static inline Limb bigint_fixed##BITS##_sub(const bigint_fixed##BITS *a,     \
+                                              const bigint_fixed##BITS *b,     \
+                                              bigint_fixed##BITS *r) {         \
+    return bigint_fixed_sub_n(a->limbs, b->limbs, r->limbs,                    \
+                              BITS / LIMB_SIZE_BITS);                          \
+  }                                                                            \
+  static inline int bigint_fixed##BITS##_cmp(const bigint_fixed##BITS *a,      \
+                                             const bigint_fixed##BITS *b) {    \
+    return bigint_fixed_cmp_n(a->limbs, b->limbs, BITS / LIMB_SIZE_BITS);      \
+  }                                                                            \
+  static inline void bigint_fixed##BITS##_mul(                                 \
+      const bigint_fixed##BITS *a, const bigint_fixed##BITS *b,                \
+      bigint_fixed##BITS *lo, bigint_fixed##BITS *hi) {                        \
+    Limb t[2 * (BITS / LIMB_SIZE_BITS)];                                       \
+    bigint_fixed_mul_n(a->limbs, b->limbs, t, BITS / LIMB_SIZE_BITS);          \
+    memcpy(lo->limbs, t, sizeof(lo->limbs));                                   \
+    memcpy(hi->limbs, t + BITS / LIMB_SIZE_BITS, sizeof(hi->limbs));           \
+  }                                                                            \
+  static inline void bigint_fixed##BITS##_sqr(const bigint_fixed##BITS *a,     \
+                                              bigint_fixed##BITS *lo,          \
+                                              bigint_fixed##BITS *hi) {        \
+    Limb t[2 * (BITS / LIMB_SIZE_BITS)];                                       \
+    bigint_fixed_sqr_n(a->limbs, t, BITS / LIMB_SIZE_BITS);                    \
+    memcpy(lo->limbs, t, sizeof(lo->limbs));                                   \
+    memcpy(hi->limbs, t + BITS / LIMB_SIZE_BITS, sizeof(hi->limbs));           \
+  }                                                                            \
+  static inline void bigint_fixed##BITS##_shl(                                 \
+      const bigint_fixed##BITS *a, size_t shift, bigint_fixed##BITS *r) {      \
+    bigint_fixed_shl_n(a->limbs, shift, r->limbs, BITS / LIMB_SIZE_BITS);      \
+  }                                                                            \
+  static inline void bigint_fixed##BITS##_shr(                                 \
+      const bigint_fixed##BITS *a, size_t shift, bigint_fixed##BITS *r) {      \
+    bigint_fixed_shr_n(a->limbs, shift, r->limbs, BITS / LIMB_SIZE_BITS);      \
+  }                                                                            \
+  static inline BigIntError bigint_fixed##BITS##_from_bigint(                  \
+      const bigint *x, bigint_fixed##BITS *r) {                                \
+    return bigint_fixed_from_bigint_n(x, r->limbs, BITS / LIMB_SIZE_BITS);     \
+  }                                                                            \
+  static inline BigIntError bigint_fixed##BITS##_to_bigint(                    \
+      const bigint_fixed##BITS *a, bigint *r) {                                \
+    return bigint_fixed_to_bigint_n(a->limbs, r, BITS / LIMB_SIZE_BITS);       \
+  }                                                                            \
+  static inline BigIntError bigint_fixed##BITS##_mont_init(                    \
+      const bigint_fixed##BITS *modulus, bigint_fixed##BITS##_mont *m) {       \
+    m->modulus = *modulus;                                                     \
+    return bigint_fixed_mont_setup(modulus->limbs, BITS / LIMB_SIZE_BITS,      \
+                                   m->one.limbs, m->rr.limbs, &m->minv);       \
+  }                                                                            \
+  static inline void bigint_fixed##BITS##_mont_mul(                            \
+      const bigint_fixed##BITS##_mont *m, const bigint_fixed##BITS *a,         \
+      const bigint_fixed##BITS *b, bigint_fixed##BITS *r) {                    \
+    bigint_fixed_mont_mul_n(a->limbs, b->limbs, m->modulus.limbs, m->minv,     \
+                            r->limbs, BITS / LIMB_SIZE_BITS);                  \
+  }                                                                            \
+  /* a must be < m */                                                          \
+  static inline void bigint_fixed##BITS##_mont_to(                             \
+      const bigint_fixed##BITS##_mont *m, const bigint_fixed##BITS *a,         \
+      bigint_fixed##BITS *r) {                                                 \
+    bigint_fixed##BITS##_mont_mul(m, a, &m->rr, r);                            \
+  }                                                                            \
+  static inline void bigint_fixed##BITS##_mont_from(                           \
+      const bigint_fixed##BITS##_mont *m, const bigint_fixed##BITS *a,         \
+      bigint_fixed##BITS *r) {                                                 \
+    bigint_fixed##BITS unit = {{1}};                                           \
+    bigint_fixed##BITS##_mont_mul(m, a, &unit, r);                             \
+  }                                                                            \
+  /* base and result in Montgomery form */                                     \
+  static inline void bigint_fixed##BITS##_mont_exp(                            \
+      const bigint_fixed##BITS##_mont *m, const bigint_fixed##BITS *base,      \
+      const bigint_fixed##BITS *exp, bigint_fixed##BITS *r) {                  \
+    Limb table[17 * (BITS / LIMB_SIZE_BITS)];                                  \
+    bigint_fixed_mont_exp_n(base->limbs, exp->limbs, m->modulus.limbs,         \
+                            m->minv, m->one.limbs, r->limbs, table,            \
+                            BITS / LIMB_SIZE_BITS);                            \
+  }
+
+BIGINT_FIXED_DEFINE(256)
+BIGINT_FIXED_DEFINE(512)
+BIGINT_FIXED_DEFINE(1024)
+BIGINT_FIXED_DEFINE(2048)
+BIGINT_FIXED_DEFINE(4096)
+
+#ifdef __cplusplus
+}
+#endif
+#endif
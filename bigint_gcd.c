@@ -0,0 +1,547 @@
+#include "bigint.h"
+#include <string.h>
+
+// Lehmer's algorithm works on the top LEHMER_BITS of the operands, two bits
+// less than a limb so the cofactors and their products with limbs fit in a
+// SignedDoubleLimb.
+#define LEHMER_BITS (LIMB_SIZE_BITS - 2)
+
+// The half-gcd recursion bottoms out in guarded Lehmer steps below
+// HGCD_THRESHOLD limbs, and gcd and gcdext cut operands of GCD_HGCD_THRESHOLD
+// limbs in half with it, O(M(n) log n) against Lehmer's O(n^2).
+#define HGCD_THRESHOLD 150
+#define GCD_HGCD_THRESHOLD 1000
+
+static Limb limb_gcd(Limb a, Limb b) {
+  if (a == 0) {
+    return b;
+  }
+  if (b == 0) {
+    return a;
+  }
+  size_t shift = 0;
+  while (((a | b) & 1) == 0) {
+    a >>= 1;
+    b >>= 1;
+    shift++;
+  }
+  while ((a & 1) == 0) {
+    a >>= 1;
+  }
+  do {
+    while ((b & 1) == 0) {
+      b >>= 1;
+    }
+    if (a > b) {
+      Limb t = a;
+      a = b;
+      b = t;
+    }
+    b -= a;
+  } while (b != 0);
+  return a << shift;
+}
+
+static Limb bigint_extract(const bigint *x, size_t shift) {
+  const size_t i = shift / LIMB_SIZE_BITS;
+  const size_t offset = shift % LIMB_SIZE_BITS;
+  if (i >= x->len) {
+    return 0;
+  }
+  Limb bits = x->limbs[i] >> offset;
+  if (offset != 0 && i + 1 < x->len) {
+    bits |= x->limbs[i + 1] << (LIMB_SIZE_BITS - offset);
+  }
+  return bits;
+}
+
+// Runs Euclid on the leading bits of u >= v (Knuth, Algorithm L) and returns
+// the cofactor matrix {A, B, C, D} so that (A u + B v, C u + D v) is a later
+// pair of the remainder sequence. Returns false when no step could be
+// simulated and a full division step is needed.
+static bool lehmer_matrix(const bigint *u, const bigint *v,
+                          SignedDoubleLimb matrix[4]) {
+  const size_t bits = bigint_bit_length(u);
+  if (bits <= LEHMER_BITS) {
+    return false;
+  }
+  const size_t shift = bits - LEHMER_BITS;
+  SignedDoubleLimb x = bigint_extract(u, shift);
+  SignedDoubleLimb y = bigint_extract(v, shift);
+  SignedDoubleLimb A = 1, B = 0, C = 0, D = 1;
+
+  while (y + C > 0 && y + D > 0) {
+    SignedDoubleLimb q = (x + A) / (y + C);
+    if (q != (x + B) / (y + D)) {
+      break;
+    }
+    SignedDoubleLimb t = A - q * C;
+    A = C;
+    C = t;
+    t = B - q * D;
+    B = D;
+    D = t;
+    t = x - q * y;
+    x = y;
+    y = t;
+  }
+
+  matrix[0] = A;
+  matrix[1] = B;
+  matrix[2] = C;
+  matrix[3] = D;
+  return B != 0;
+}
+
+// (u, v) = (A u + B v, C u + D v), both results are non-negative.
+static void lehmer_apply(bigint *u, bigint *v, const SignedDoubleLimb m[4],
+                         bigint *scratch_u, bigint *scratch_v) {
+  const size_t len = u->len;
+  bigint_resize(scratch_u, len);
+  bigint_resize(scratch_v, len);
+
+  SignedDoubleLimb carry_u = 0;
+  SignedDoubleLimb carry_v = 0;
+  for (size_t i = 0; i < len; i++) {
+    SignedDoubleLimb u_ = u->limbs[i];
+    SignedDoubleLimb v_ = i < v->len ? v->limbs[i] : 0;
+    carry_u += m[0] * u_ + m[1] * v_;
+    carry_v += m[2] * u_ + m[3] * v_;
+    scratch_u->limbs[i] = (Limb)carry_u;
+    scratch_v->limbs[i] = (Limb)carry_v;
+    carry_u >>= LIMB_SIZE_BITS;
+    carry_v >>= LIMB_SIZE_BITS;
+  }
+  // carry_u == carry_v == 0
+
+  bigint_fit(scratch_u);
+  bigint_fit(scratch_v);
+  bigint t = *u;
+  *u = *scratch_u;
+  *scratch_u = t;
+  t = *v;
+  *v = *scratch_v;
+  *scratch_v = t;
+}
+
+// out = A x + B y for signed x, y
+static void lehmer_combine(SignedDoubleLimb A, const bigint *x,
+                           SignedDoubleLimb B, const bigint *y, bigint *out,
+                           bigint *scratch) {
+  out->len = 0;
+  bigint_addmul_limb(out, x, (Limb)(A < 0 ? -A : A));
+  out->negative = out->len > 0 && (x->negative != (A < 0));
+  scratch->len = 0;
+  bigint_addmul_limb(scratch, y, (Limb)(B < 0 ? -B : B));
+  scratch->negative = scratch->len > 0 && (y->negative != (B < 0));
+  bigint_sadd(out, scratch, out);
+}
+
+static void bigint_swap(bigint *a, bigint *b) {
+  bigint t = *a;
+  *a = *b;
+  *b = t;
+}
+
+// Cofactor matrix of the half-gcd, (a, b) = M (alpha, beta) with
+// non-negative entries and determinant det = +-1. m[0] m[1] is the first
+// row.
+typedef struct hgcd_matrix {
+  bigint m[4];
+  int det;
+} hgcd_matrix;
+
+static void hgcd_matrix_identity(hgcd_matrix *M) {
+  for (size_t i = 0; i < 4; i++) {
+    M->m[i].len = 0;
+    M->m[i].negative = false;
+  }
+  bigint_set_from_limb(1, &M->m[0]);
+  bigint_set_from_limb(1, &M->m[3]);
+  M->det = 1;
+}
+
+static void hgcd_matrix_free(hgcd_matrix *M) {
+  for (size_t i = 0; i < 4; i++) {
+    bigint_free_limbs(&M->m[i]);
+  }
+}
+
+static bool hgcd_matrix_is_identity(const hgcd_matrix *M) {
+  return M->m[1].len == 0 && M->m[2].len == 0;
+}
+
+// M = M [[l[0], l[1]], [l[2], l[3]]] for a non-negative Lehmer inverse
+// with determinant det
+static void hgcd_matrix_mul_limbs(hgcd_matrix *M, const SignedDoubleLimb l[4],
+                                  int det, bigint scratch[3]) {
+  M->det *= det;
+  for (size_t row = 0; row < 4; row += 2) {
+    lehmer_combine(l[0], &M->m[row], l[2], &M->m[row + 1], &scratch[0],
+                   &scratch[2]);
+    lehmer_combine(l[1], &M->m[row], l[3], &M->m[row + 1], &scratch[1],
+                   &scratch[2]);
+    bigint_swap(&M->m[row], &scratch[0]);
+    bigint_swap(&M->m[row + 1], &scratch[1]);
+  }
+}
+
+// M = M N
+static BigIntError hgcd_matrix_mul(hgcd_matrix *M, const hgcd_matrix *N) {
+  bigint t0 = BIGINT_ZERO, t1 = BIGINT_ZERO;
+  BigIntError result = Ok;
+  M->det *= N->det;
+  for (size_t row = 0; result == Ok && row < 4; row += 2) {
+    result = bigint_mul(&M->m[row], &N->m[0], &t0);
+    if (result == Ok) {
+      result = bigint_addmul(&t0, &M->m[row + 1], &N->m[2]);
+    }
+    if (result == Ok) {
+      result = bigint_mul(&M->m[row], &N->m[1], &t1);
+    }
+    if (result == Ok) {
+      result = bigint_addmul(&t1, &M->m[row + 1], &N->m[3]);
+    }
+    bigint_swap(&M->m[row], &t0);
+    bigint_swap(&M->m[row + 1], &t1);
+  }
+  bigint_free_limbs(&t0);
+  bigint_free_limbs(&t1);
+  return result;
+}
+
+// (x, y) = det(M) M^-1 (a, b); x and y must not alias a or b
+static BigIntError hgcd_matrix_solve(const hgcd_matrix *M, const bigint *a,
+                                     const bigint *b, bigint *x, bigint *y) {
+  bigint tmp = BIGINT_ZERO;
+  BigIntError result = bigint_smul(&M->m[3], a, x);
+  if (result == Ok) {
+    result = bigint_smul(&M->m[1], b, &tmp);
+  }
+  if (result == Ok) {
+    result = bigint_ssub(x, &tmp, x);
+  }
+  if (result == Ok) {
+    result = bigint_smul(&M->m[0], b, y);
+  }
+  if (result == Ok) {
+    result = bigint_smul(&M->m[2], a, &tmp);
+  }
+  if (result == Ok) {
+    result = bigint_ssub(y, &tmp, y);
+  }
+  bigint_free_limbs(&tmp);
+  return result;
+}
+
+// Reduces the larger of alpha, beta by one Lehmer matrix or one division
+// while both stay at least 2^t. Returns false when no such step exists.
+static bool hgcd_step(bigint *alpha, bigint *beta, hgcd_matrix *M, size_t t,
+                      bigint scratch[3]) {
+  const bool swapped = bigint_less_than(alpha, beta);
+  bigint *x = swapped ? beta : alpha;
+  bigint *y = swapped ? alpha : beta;
+  if (bigint_bit_length(y) <= t) {
+    return false;
+  }
+
+  SignedDoubleLimb matrix[4];
+  if (y->len >= 2 && lehmer_matrix(x, y, matrix)) {
+    lehmer_apply(x, y, matrix, &scratch[0], &scratch[1]);
+    if (bigint_bit_length(y) > t) {
+      // (x, y) = L^-1 (x', y') = [[|D|, |B|], [|C|, |A|]] (x', y'),
+      // conjugated by the swap when x is beta
+      SignedDoubleLimb inverse[4] = {matrix[3], matrix[1], matrix[2],
+                                     matrix[0]};
+      if (swapped) {
+        inverse[0] = matrix[0];
+        inverse[1] = matrix[2];
+        inverse[2] = matrix[1];
+        inverse[3] = matrix[3];
+      }
+      for (size_t i = 0; i < 4; i++) {
+        inverse[i] = inverse[i] < 0 ? -inverse[i] : inverse[i];
+      }
+      // D alternates in sign with the number of steps, like det(L)
+      hgcd_matrix_mul_limbs(M, inverse, matrix[3] < 0 ? -1 : 1, scratch);
+      return true;
+    }
+    bigint_swap(x, &scratch[0]);
+    bigint_swap(y, &scratch[1]);
+  }
+
+  // the largest q with x - q y >= 2^t
+  bigint *q = &scratch[0], *r = &scratch[1], *bound = &scratch[2];
+  bigint_set_from_limb(1, bound);
+  bigint_bit_shiftl(bound, t, bound);
+  bigint_sub(x, bound, x);
+  bigint_div(x, y, q, r);
+  bigint_add(r, bound, x);
+  if (q->len == 0) {
+    return false;
+  }
+  // alpha -= q beta adds q times the first column to the second, and the
+  // other way round
+  const size_t column = swapped ? 0 : 1;
+  bigint_addmul(&M->m[column], q, &M->m[1 - column]);
+  bigint_addmul(&M->m[2 + column], q, &M->m[3 - column]);
+  return true;
+}
+
+// Half-gcd (Moller, "On Schonhage's algorithm and subquadratic integer gcd
+// computation"): for a, b of at most n bits finds M with (alpha, beta) =
+// M^-1 (a, b) and alpha, beta >= 2^t, t = n / 2 + 2, reducing them to about
+// t bits. The bound is what keeps a matrix found on the top bits valid for
+// the whole numbers: its entries are below 2^(n - t) <= 2^(t - 3), so
+// applying it to the low bits cannot turn alpha or beta negative.
+static BigIntError hgcd(const bigint *a, const bigint *b, hgcd_matrix *M,
+                        bigint *alpha, bigint *beta) {
+  const size_t bits_a = bigint_bit_length(a), bits_b = bigint_bit_length(b);
+  const size_t n = bits_a > bits_b ? bits_a : bits_b;
+  const size_t t = n / 2 + 2;
+  hgcd_matrix_identity(M);
+  BigIntError result = bigint_copy(a, alpha);
+  if (result == Ok) {
+    result = bigint_copy(b, beta);
+  }
+  if (result != Ok || bits_a <= t || bits_b <= t) {
+    return result;
+  }
+
+  bigint scratch[3] = {BIGINT_ZERO, BIGINT_ZERO, BIGINT_ZERO};
+  if (n < HGCD_THRESHOLD * LIMB_SIZE_BITS) {
+    while (hgcd_step(alpha, beta, M, t, scratch)) {
+    }
+    for (size_t i = 0; i < 3; i++) {
+      bigint_free_limbs(&scratch[i]);
+    }
+    return Ok;
+  }
+
+  hgcd_matrix sub = {{BIGINT_ZERO, BIGINT_ZERO, BIGINT_ZERO, BIGINT_ZERO}, 1};
+  bigint top_a = BIGINT_ZERO, top_b = BIGINT_ZERO;
+  size_t p = n / 2;
+  for (size_t pass = 0; result == Ok && pass < 2; pass++) {
+    if (pass == 1) {
+      // single steps down to 3n/4 bits, then the top 2(n' - t) bits of the
+      // n' bit remainders bring them down to t
+      bool reducible = true;
+      while (reducible && (bigint_bit_length(alpha) > n / 4 * 3 + 1 ||
+                           bigint_bit_length(beta) > n / 4 * 3 + 1)) {
+        reducible = hgcd_step(alpha, beta, M, t, scratch);
+      }
+      if (!reducible) {
+        // alpha and beta are within 2^t of each other
+        break;
+      }
+      const size_t bits_alpha = bigint_bit_length(alpha);
+      const size_t bits_beta = bigint_bit_length(beta);
+      p = 2 * t - (bits_alpha > bits_beta ? bits_alpha : bits_beta);
+    }
+    bigint_bit_shiftr(alpha, p, &top_a);
+    bigint_bit_shiftr(beta, p, &top_b);
+    result = hgcd(&top_a, &top_b, &sub, &scratch[0], &scratch[1]);
+    if (result != Ok || hgcd_matrix_is_identity(&sub)) {
+      continue;
+    }
+    result = hgcd_matrix_solve(&sub, alpha, beta, &top_a, &top_b);
+    if (result == Ok) {
+      result = hgcd_matrix_mul(M, &sub);
+    }
+    top_a.negative = top_b.negative = false;
+    bigint_swap(alpha, &top_a);
+    bigint_swap(beta, &top_b);
+  }
+
+  hgcd_matrix_free(&sub);
+  bigint_free_limbs(&top_a);
+  bigint_free_limbs(&top_b);
+  for (size_t i = 0; i < 3; i++) {
+    bigint_free_limbs(&scratch[i]);
+  }
+  return result;
+}
+
+BigIntError bigint_gcd(const bigint *a, const bigint *b, bigint *g) {
+  bigint u = BIGINT_ZERO, v = BIGINT_ZERO;
+  bigint q = BIGINT_ZERO, r = BIGINT_ZERO;
+  bigint_copy(a, &u);
+  bigint_copy(b, &v);
+  u.negative = v.negative = false;
+  if (bigint_less_than(&u, &v)) {
+    bigint_swap(&u, &v);
+  }
+
+  hgcd_matrix M = {{BIGINT_ZERO, BIGINT_ZERO, BIGINT_ZERO, BIGINT_ZERO}, 1};
+  while (v.len >= GCD_HGCD_THRESHOLD) {
+    hgcd(&u, &v, &M, &q, &r);
+    if (!hgcd_matrix_is_identity(&M)) {
+      bigint_swap(&u, &q);
+      bigint_swap(&v, &r);
+      if (bigint_less_than(&u, &v)) {
+        bigint_swap(&u, &v);
+      }
+    }
+    // the half-gcd stops short of the quotient that crosses its bound
+    bigint_div(&u, &v, &q, &r);
+    bigint_swap(&u, &v);
+    bigint_swap(&v, &r);
+  }
+  hgcd_matrix_free(&M);
+
+  SignedDoubleLimb matrix[4];
+  while (v.len >= 2) {
+    if (lehmer_matrix(&u, &v, matrix)) {
+      lehmer_apply(&u, &v, matrix, &q, &r);
+    } else {
+      bigint_div(&u, &v, &q, &r);
+      bigint_swap(&u, &v);
+      bigint_swap(&v, &r);
+    }
+  }
+
+  if (v.len == 1) {
+    bigint_div(&u, &v, &q, &r);
+    Limb x = limb_gcd(v.limbs[0], r.len ? r.limbs[0] : 0);
+    bigint_set_from_limb(x, &u);
+  }
+
+  BigIntError result = bigint_copy(&u, g);
+  bigint_free_limbs(&u);
+  bigint_free_limbs(&v);
+  bigint_free_limbs(&q);
+  bigint_free_limbs(&r);
+  return result;
+}
+
+BigIntError bigint_gcdext(const bigint *a, const bigint *b, bigint *g,
+                          bigint *s, bigint *t) {
+  bigint u = BIGINT_ZERO, v = BIGINT_ZERO;
+  bigint s0 = BIGINT_ZERO, s1 = BIGINT_ZERO;
+  bigint q = BIGINT_ZERO, r = BIGINT_ZERO, tmp = BIGINT_ZERO;
+  bigint abs_a = BIGINT_ZERO, abs_b = BIGINT_ZERO;
+  const bool a_negative = a->negative;
+  const bool b_negative = b->negative;
+
+  bigint_copy(a, &abs_a);
+  bigint_copy(b, &abs_b);
+  abs_a.negative = abs_b.negative = false;
+
+  // u = s0 |a| (mod |b|), v = s1 |a| (mod |b|)
+  if (bigint_less_than(&abs_a, &abs_b)) {
+    bigint_copy(&abs_b, &u);
+    bigint_copy(&abs_a, &v);
+    bigint_set_from_limb(1, &s1);
+  } else {
+    bigint_copy(&abs_a, &u);
+    bigint_copy(&abs_b, &v);
+    bigint_set_from_limb(1, &s0);
+  }
+
+  // (u, v) = M (u', v') gives (s0', s1') = det(M) M^-1 (s0, s1)
+  hgcd_matrix M = {{BIGINT_ZERO, BIGINT_ZERO, BIGINT_ZERO, BIGINT_ZERO}, 1};
+  while (v.len >= GCD_HGCD_THRESHOLD) {
+    hgcd(&u, &v, &M, &q, &r);
+    if (!hgcd_matrix_is_identity(&M)) {
+      bigint_swap(&u, &q);
+      bigint_swap(&v, &r);
+      hgcd_matrix_solve(&M, &s0, &s1, &q, &r);
+      if (M.det < 0) {
+        bigint_neg(&q, &q);
+        bigint_neg(&r, &r);
+      }
+      bigint_swap(&s0, &q);
+      bigint_swap(&s1, &r);
+      if (bigint_less_than(&u, &v)) {
+        bigint_swap(&u, &v);
+        bigint_swap(&s0, &s1);
+      }
+    }
+    bigint_div(&u, &v, &q, &r);
+    bigint_swap(&u, &v);
+    bigint_swap(&v, &r);
+    bigint_smul(&q, &s1, &tmp);
+    bigint_ssub(&s0, &tmp, &s0);
+    bigint_swap(&s0, &s1);
+  }
+  hgcd_matrix_free(&M);
+
+  SignedDoubleLimb matrix[4];
+  while (v.len > 0) {
+    if (v.len >= 2 && lehmer_matrix(&u, &v, matrix)) {
+      lehmer_apply(&u, &v, matrix, &q, &r);
+      lehmer_combine(matrix[2], &s0, matrix[3], &s1, &r, &tmp);
+      lehmer_combine(matrix[0], &s0, matrix[1], &s1, &q, &tmp);
+      bigint_swap(&s0, &q);
+      bigint_swap(&s1, &r);
+    } else {
+      bigint_div(&u, &v, &q, &r);
+      bigint_swap(&u, &v);
+      bigint_swap(&v, &r);
+      bigint_smul(&q, &s1, &tmp);
+      bigint_ssub(&s0, &tmp, &s0);
+      bigint_swap(&s0, &s1);
+    }
+  }
+
+  // t = (g - s |a|) / |b|
+  if (abs_b.len > 0) {
+    bigint_smul(&s0, &abs_a, &tmp);
+    bigint_ssub(&u, &tmp, &tmp);
+    bigint_sdiv(&tmp, &abs_b, &q, &r, RoundTrunc);
+  } else {
+    q.len = 0;
+    bigint_fit(&q);
+  }
+  if (a_negative) {
+    bigint_neg(&s0, &s0);
+  }
+  if (b_negative) {
+    bigint_neg(&q, &q);
+  }
+
+  BigIntError result = bigint_copy(&u, g);
+  if (result == Ok) {
+    result = bigint_copy(&s0, s);
+  }
+  if (result == Ok) {
+    result = bigint_copy(&q, t);
+  }
+  bigint_free_limbs(&u);
+  bigint_free_limbs(&v);
+  bigint_free_limbs(&s0);
+  bigint_free_limbs(&s1);
+  bigint_free_limbs(&q);
+  bigint_free_limbs(&r);
+  bigint_free_limbs(&tmp);
+  bigint_free_limbs(&abs_a);
+  bigint_free_limbs(&abs_b);
+  return result;
+}
+
+BigIntError bigint_invert(const bigint *a, const bigint *m, bigint *result) {
+  if (m->len == 0) {
+    return DivisionByZeroError;
+  }
+
+  bigint modulus = BIGINT_ZERO, g = BIGINT_ZERO;
+  bigint s = BIGINT_ZERO, t = BIGINT_ZERO;
+  bigint_copy(m, &modulus);
+  modulus.negative = false;
+
+  bigint_sdiv(a, &modulus, &t, &s, RoundFloor);
+  bigint_gcdext(&s, &modulus, &g, &s, &t);
+
+  BigIntError error = Ok;
+  if (g.len != 1 || g.limbs[0] != 1) {
+    error = NotInvertible;
+  } else {
+    bigint_sdiv(&s, &modulus, &t, result, RoundFloor);
+  }
+
+  bigint_free_limbs(&modulus);
+  bigint_free_limbs(&g);
+  bigint_free_limbs(&s);
+  bigint_free_limbs(&t);
+  return error;
+}
@@ -0,0 +1,475 @@
+#include "bigint.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Independent Montgomery multiplications run side by side, one per lane.
+// Values are split into 32-bit digits held in 64-bit lanes so a digit
+// product plus two digits still fits a lane, and stored interleaved:
+// digit k of lane l lives at [k * LANES + l]. The CIOS kernel is written
+// once against the LANE_* operations, which map to AVX-512 or AVX2 when the
+// library is compiled for them (-mavx512f, -mavx2, -march=native) and to
+// plain lane loops otherwise.
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#define LANES 8
+typedef __m512i lane_vec;
+#define LANE_LOAD(p) _mm512_loadu_si512((const void *)(p))
+#define LANE_STORE(p, x) _mm512_storeu_si512((void *)(p), x)
+#define LANE_SET1(x) _mm512_set1_epi64((long long)(x))
+#define LANE_ADD(x, y) _mm512_add_epi64(x, y)
+#define LANE_SUB(x, y) _mm512_sub_epi64(x, y)
+#define LANE_MUL(x, y) _mm512_mul_epu32(x, y)
+#define LANE_AND(x, y) _mm512_and_si512(x, y)
+#define LANE_XOR(x, y) _mm512_xor_si512(x, y)
+#define LANE_SHR(x, k) _mm512_srli_epi64(x, k)
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define LANES 4
+typedef __m256i lane_vec;
+#define LANE_LOAD(p) _mm256_loadu_si256((const __m256i *)(p))
+#define LANE_STORE(p, x) _mm256_storeu_si256((__m256i *)(p), x)
+#define LANE_SET1(x) _mm256_set1_epi64x((long long)(x))
+#define LANE_ADD(x, y) _mm256_add_epi64(x, y)
+#define LANE_SUB(x, y) _mm256_sub_epi64(x, y)
+#define LANE_MUL(x, y) _mm256_mul_epu32(x, y)
+#define LANE_AND(x, y) _mm256_and_si256(x, y)
+#define LANE_XOR(x, y) _mm256_xor_si256(x, y)
+#define LANE_SHR(x, k) _mm256_srli_epi64(x, k)
+#else
+#define LANES 4
+typedef struct lane_vec {
+  uint64_t v[LANES];
+} lane_vec;
+
+#define LANE_BINARY(NAME, EXPR)                                                \
+  static lane_vec NAME(lane_vec x, lane_vec y) {                               \
+    lane_vec r;                                                                \
+    for (size_t l = 0; l < LANES; l++) {                                       \
+      r.v[l] = EXPR;                                                           \
+    }                                                                          \
+    return r;                                                                  \
+  }
+LANE_BINARY(lane_add, x.v[l] + y.v[l])
+LANE_BINARY(lane_sub, x.v[l] - y.v[l])
+LANE_BINARY(lane_mul, (x.v[l] & 0xffffffffu) * (y.v[l] & 0xffffffffu))
+LANE_BINARY(lane_and, x.v[l] & y.v[l])
+LANE_BINARY(lane_xor, x.v[l] ^ y.v[l])
+
+static lane_vec lane_load(const uint64_t *p) {
+  lane_vec r;
+  memcpy(r.v, p, sizeof(r.v));
+  return r;
+}
+
+static lane_vec lane_set1(uint64_t x) {
+  lane_vec r;
+  for (size_t l = 0; l < LANES; l++) {
+    r.v[l] = x;
+  }
+  return r;
+}
+
+static lane_vec lane_shr(lane_vec x, unsigned k) {
+  for (size_t l = 0; l < LANES; l++) {
+    x.v[l] >>= k;
+  }
+  return x;
+}
+
+#define LANE_LOAD(p) lane_load(p)
+#define LANE_STORE(p, x) memcpy(p, (x).v, sizeof((x).v))
+#define LANE_SET1(x) lane_set1(x)
+#define LANE_ADD(x, y) lane_add(x, y)
+#define LANE_SUB(x, y) lane_sub(x, y)
+#define LANE_MUL(x, y) lane_mul(x, y)
+#define LANE_AND(x, y) lane_and(x, y)
+#define LANE_XOR(x, y) lane_xor(x, y)
+#define LANE_SHR(x, k) lane_shr(x, k)
+#endif
+
+#define DIGIT_BITS 32
+#define DIGIT_MASK 0xffffffffu
+#define LANES_WINDOW 4
+
+// A group of up to LANES contexts sharing the digit count of the largest
+// modulus. Every buffer is digits * LANES words, t and the shifted operand
+// are scratch for lanes_mul.
+typedef struct lanes_group {
+  size_t lanes;
+  size_t digits;
+  const Montgomery *m[LANES];
+  size_t shift[LANES];
+  uint64_t minv[LANES];
+  uint64_t *modulus;
+  uint64_t *t;
+  uint64_t *shifted;
+} lanes_group;
+
+static uint64_t bigint_digit(const bigint *a, size_t k) {
+#if LIMB_SIZE_BITS >= DIGIT_BITS
+  const size_t bit = k * DIGIT_BITS;
+  if (bit / LIMB_SIZE_BITS >= a->len) {
+    return 0;
+  }
+  return (a->limbs[bit / LIMB_SIZE_BITS] >> (bit % LIMB_SIZE_BITS)) &
+         DIGIT_MASK;
+#else
+  uint64_t digit = 0;
+  for (size_t j = 0; j < DIGIT_BITS / LIMB_SIZE_BITS; j++) {
+    const size_t i = k * (DIGIT_BITS / LIMB_SIZE_BITS) + j;
+    if (i < a->len) {
+      digit |= (uint64_t)a->limbs[i] << (j * LIMB_SIZE_BITS);
+    }
+  }
+  return digit;
+#endif
+}
+
+static void lanes_pack(const lanes_group *g, uint64_t *dst, size_t lane,
+                       const bigint *a) {
+  for (size_t k = 0; k < g->digits; k++) {
+    dst[k * LANES + lane] = bigint_digit(a, k);
+  }
+}
+
+static BigIntError lanes_unpack(const lanes_group *g, const uint64_t *src,
+                                size_t lane, bigint *a) {
+  const size_t limbs =
+      (g->digits * DIGIT_BITS + LIMB_SIZE_BITS - 1) / LIMB_SIZE_BITS;
+  a->len = 0;
+  BigIntError result = bigint_resize(a, limbs);
+  if (result != Ok) {
+    return result;
+  }
+  for (size_t k = 0; k < g->digits; k++) {
+    const uint64_t digit = src[k * LANES + lane];
+#if LIMB_SIZE_BITS >= DIGIT_BITS
+    const size_t bit = k * DIGIT_BITS;
+    a->limbs[bit / LIMB_SIZE_BITS] |= (Limb)digit << (bit % LIMB_SIZE_BITS);
+#else
+    for (size_t j = 0; j < DIGIT_BITS / LIMB_SIZE_BITS; j++) {
+      a->limbs[k * (DIGIT_BITS / LIMB_SIZE_BITS) + j] =
+          (Limb)(digit >> (j * LIMB_SIZE_BITS));
+    }
+#endif
+  }
+  bigint_fit(a);
+  return Ok;
+}
+
+static void lanes_group_free(lanes_group *g) {
+  free(g->modulus);
+  g->modulus = NULL;
+}
+
+// Lanes past g->lanes repeat lane 0 so every lane holds a valid modulus.
+static BigIntError lanes_group_init(lanes_group *g, const Montgomery *m[],
+                                    size_t lanes) {
+  g->lanes = lanes;
+  g->digits = 0;
+  for (size_t l = 0; l < LANES; l++) {
+    g->m[l] = m[l < lanes ? l : 0];
+    const size_t digits = (g->m[l]->n + DIGIT_BITS - 1) / DIGIT_BITS;
+    g->digits = digits > g->digits ? digits : g->digits;
+  }
+  const size_t words = g->digits * LANES;
+  g->modulus = calloc(3 * words + 2 * LANES, sizeof(uint64_t));
+  if (g->modulus == NULL) {
+    return MemoryError;
+  }
+  g->shifted = g->modulus + words;
+  g->t = g->shifted + words;
+  for (size_t l = 0; l < LANES; l++) {
+    const Montgomery *ml = g->m[l];
+    lanes_pack(g, g->modulus, l, &ml->modulus);
+    // the kernel divides by 2^(32 digits), R = 2^n is recovered by shifting
+    // the first operand up by the difference
+    g->shift[l] = g->digits * DIGIT_BITS - ml->n;
+    const uint32_t m0 = (uint32_t)g->modulus[l];
+    uint32_t inverse = m0;
+    for (size_t bits = 3; bits < DIGIT_BITS; bits *= 2) {
+      inverse *= 2 - m0 * inverse;
+    }
+    g->minv[l] = (uint32_t)-inverse;
+  }
+  return Ok;
+}
+
+static void lanes_shift(const lanes_group *g, const uint64_t *a,
+                        uint64_t *dst) {
+  for (size_t l = 0; l < LANES; l++) {
+    const size_t digits = g->shift[l] / DIGIT_BITS;
+    const unsigned bits = g->shift[l] % DIGIT_BITS;
+    for (size_t k = 0; k < g->digits; k++) {
+      const uint64_t lo = k >= digits ? a[(k - digits) * LANES + l] : 0;
+      const uint64_t below =
+          k >= digits + 1 ? a[(k - digits - 1) * LANES + l] : 0;
+      dst[k * LANES + l] =
+          ((lo << bits) | (below >> (DIGIT_BITS - bits))) & DIGIT_MASK;
+    }
+  }
+}
+
+// r = a b 2^-n mod m in every lane for a, b < m, CIOS over 32-bit digits
+// finished by a masked subtraction. r may alias a or b.
+static void lanes_mul(lanes_group *g, const uint64_t *a, const uint64_t *b,
+                      uint64_t *r) {
+  const size_t d = g->digits;
+  const uint64_t *m = g->modulus;
+  uint64_t *t = g->t;
+  const lane_vec mask = LANE_SET1(DIGIT_MASK);
+  const lane_vec one = LANE_SET1(1);
+  const lane_vec minv = LANE_LOAD(g->minv);
+  lanes_shift(g, a, g->shifted);
+  a = g->shifted;
+  memset(t, 0, (d + 2) * LANES * sizeof(uint64_t));
+
+  for (size_t i = 0; i < d; i++) {
+    const lane_vec bi = LANE_LOAD(b + i * LANES);
+    lane_vec c = LANE_SET1(0);
+    lane_vec s;
+    for (size_t j = 0; j < d; j++) {
+      s = LANE_ADD(LANE_ADD(LANE_LOAD(t + j * LANES),
+                            LANE_MUL(LANE_LOAD(a + j * LANES), bi)),
+                   c);
+      LANE_STORE(t + j * LANES, LANE_AND(s, mask));
+      c = LANE_SHR(s, DIGIT_BITS);
+    }
+    s = LANE_ADD(LANE_LOAD(t + d * LANES), c);
+    LANE_STORE(t + d * LANES, LANE_AND(s, mask));
+    LANE_STORE(t + (d + 1) * LANES, LANE_SHR(s, DIGIT_BITS));
+
+    const lane_vec q = LANE_AND(LANE_MUL(LANE_LOAD(t), minv), mask);
+    s = LANE_ADD(LANE_LOAD(t), LANE_MUL(q, LANE_LOAD(m)));
+    c = LANE_SHR(s, DIGIT_BITS);
+    for (size_t j = 1; j < d; j++) {
+      s = LANE_ADD(LANE_ADD(LANE_LOAD(t + j * LANES),
+                            LANE_MUL(q, LANE_LOAD(m + j * LANES))),
+                   c);
+      LANE_STORE(t + (j - 1) * LANES, LANE_AND(s, mask));
+      c = LANE_SHR(s, DIGIT_BITS);
+    }
+    s = LANE_ADD(LANE_LOAD(t + d * LANES), c);
+    LANE_STORE(t + (d - 1) * LANES, LANE_AND(s, mask));
+    LANE_STORE(t + d * LANES, LANE_ADD(LANE_LOAD(t + (d + 1) * LANES),
+                                       LANE_SHR(s, DIGIT_BITS)));
+  }
+
+  // t < 2m, r = t - m in the lanes where that does not borrow
+  lane_vec borrow = LANE_SET1(0);
+  for (size_t j = 0; j < d; j++) {
+    const lane_vec diff = LANE_SUB(
+        LANE_SUB(LANE_LOAD(t + j * LANES), LANE_LOAD(m + j * LANES)), borrow);
+    borrow = LANE_SHR(diff, 63);
+    LANE_STORE(r + j * LANES, LANE_AND(diff, mask));
+  }
+  borrow = LANE_SHR(LANE_SUB(LANE_LOAD(t + d * LANES), borrow), 63);
+  const lane_vec keep = LANE_SUB(borrow, one);
+  for (size_t j = 0; j < d; j++) {
+    const lane_vec tj = LANE_LOAD(t + j * LANES);
+    LANE_STORE(r + j * LANES,
+               LANE_XOR(tj, LANE_AND(LANE_XOR(tj, LANE_LOAD(r + j * LANES)),
+                                     keep)));
+  }
+}
+
+static BigIntError lanes_pack_reduced(const lanes_group *g, uint64_t *dst,
+                                      size_t lane, const bigint *a) {
+  const bigint *modulus = &g->m[lane]->modulus;
+  if (bigint_less_than(a, modulus)) {
+    lanes_pack(g, dst, lane, a);
+    return Ok;
+  }
+  bigint q = BIGINT_ZERO, r = BIGINT_ZERO;
+  BigIntError result = bigint_div(a, modulus, &q, &r);
+  if (result == Ok) {
+    lanes_pack(g, dst, lane, &r);
+  }
+  bigint_free_limbs(&q);
+  bigint_free_limbs(&r);
+  return result;
+}
+
+typedef struct lanes_item {
+  size_t n;
+  size_t index;
+} lanes_item;
+
+static int lanes_item_cmp(const void *x, const void *y) {
+  const lanes_item *a = x, *b = y;
+  return a->n < b->n ? -1 : a->n > b->n;
+}
+
+// Item indices sorted by modulus size so each group of LANES wastes little
+// work on lanes narrower than its widest modulus.
+static size_t *lanes_order(const Montgomery *m[], size_t n) {
+  lanes_item *items = malloc((n ? n : 1) * sizeof(*items));
+  size_t *order = malloc((n ? n : 1) * sizeof(*order));
+  if (items == NULL || order == NULL) {
+    free(items);
+    free(order);
+    return NULL;
+  }
+  for (size_t i = 0; i < n; i++) {
+    items[i].n = m[i]->n;
+    items[i].index = i;
+  }
+  qsort(items, n, sizeof(*items), lanes_item_cmp);
+  for (size_t i = 0; i < n; i++) {
+    order[i] = items[i].index;
+  }
+  free(items);
+  return order;
+}
+
+BigIntError bigint_montgomery_mul_lanes(const Montgomery *m[],
+                                        const bigint *r1[], const bigint *r2[],
+                                        bigint *result[], size_t n) {
+  size_t *order = lanes_order(m, n);
+  if (order == NULL) {
+    return MemoryError;
+  }
+  BigIntError error = Ok;
+  for (size_t start = 0; error == Ok && start < n; start += LANES) {
+    const size_t lanes = n - start < LANES ? n - start : LANES;
+    const Montgomery *group_m[LANES];
+    for (size_t l = 0; l < lanes; l++) {
+      group_m[l] = m[order[start + l]];
+    }
+    lanes_group g;
+    error = lanes_group_init(&g, group_m, lanes);
+    if (error != Ok) {
+      break;
+    }
+    const size_t words = g.digits * LANES;
+    uint64_t *a = calloc(2 * words, sizeof(uint64_t));
+    uint64_t *b = a + words;
+    if (a == NULL) {
+      error = MemoryError;
+    }
+    for (size_t l = 0; error == Ok && l < lanes; l++) {
+      error = lanes_pack_reduced(&g, a, l, r1[order[start + l]]);
+      if (error == Ok) {
+        error = lanes_pack_reduced(&g, b, l, r2[order[start + l]]);
+      }
+    }
+    if (error == Ok) {
+      lanes_mul(&g, a, b, a);
+    }
+    for (size_t l = 0; error == Ok && l < lanes; l++) {
+      error = lanes_unpack(&g, a, l, result[order[start + l]]);
+    }
+    free(a);
+    lanes_group_free(&g);
+  }
+  free(order);
+  return error;
+}
+
+static size_t lanes_window(const bigint *e, size_t bit) {
+  size_t digit = 0;
+  for (size_t j = 0; j < LANES_WINDOW; j++, bit++) {
+    if (bit / LIMB_SIZE_BITS < e->len &&
+        (e->limbs[bit / LIMB_SIZE_BITS] >> (bit % LIMB_SIZE_BITS)) & 1) {
+      digit |= (size_t)1 << j;
+    }
+  }
+  return digit;
+}
+
+// Fixed 4-bit windows over the longest exponent of the group, each lane
+// picks its own table entry, so shorter exponents multiply by R mod m.
+static BigIntError lanes_exp_group(lanes_group *g, const bigint *bases[],
+                                   const bigint *exps[], uint64_t *buffer) {
+  const size_t words = g->digits * LANES;
+  const size_t entries = (size_t)1 << LANES_WINDOW;
+  uint64_t *table = buffer;
+  uint64_t *acc = table + entries * words;
+  uint64_t *rr = acc + words;
+  uint64_t *one = rr + words;
+  size_t bits = 0;
+  for (size_t l = 0; l < g->lanes; l++) {
+    const size_t e_bits = bigint_bit_length(exps[l]);
+    bits = e_bits > bits ? e_bits : bits;
+  }
+  for (size_t l = 0; l < LANES; l++) {
+    lanes_pack(g, rr, l, &g->m[l]->rrm);
+    one[l] = 1;
+    if (l < g->lanes) {
+      const BigIntError error = lanes_pack_reduced(g, table + words, l, bases[l]);
+      if (error != Ok) {
+        return error;
+      }
+    }
+  }
+
+  lanes_mul(g, one, rr, table);
+  lanes_mul(g, table + words, rr, table + words);
+  for (size_t d = 2; d < entries; d++) {
+    lanes_mul(g, table + (d - 1) * words, table + words, table + d * words);
+  }
+
+  memcpy(acc, table, words * sizeof(uint64_t));
+  for (size_t bit = (bits + LANES_WINDOW - 1) / LANES_WINDOW * LANES_WINDOW;
+       bit > 0;) {
+    bit -= LANES_WINDOW;
+    for (size_t j = 0; j < LANES_WINDOW; j++) {
+      lanes_mul(g, acc, acc, acc);
+    }
+    for (size_t l = 0; l < LANES; l++) {
+      const size_t digit = l < g->lanes ? lanes_window(exps[l], bit) : 0;
+      for (size_t k = 0; k < g->digits; k++) {
+        rr[k * LANES + l] = table[digit * words + k * LANES + l];
+      }
+    }
+    lanes_mul(g, acc, rr, acc);
+  }
+  lanes_mul(g, acc, one, acc);
+  return Ok;
+}
+
+BigIntError bigint_montgomery_exp_lanes(const Montgomery *m[],
+                                        const bigint *bases[],
+                                        const bigint *exps[], bigint *result[],
+                                        size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    if (exps[i]->negative) {
+      return NotImplemented;
+    }
+  }
+  size_t *order = lanes_order(m, n);
+  if (order == NULL) {
+    return MemoryError;
+  }
+  BigIntError error = Ok;
+  for (size_t start = 0; error == Ok && start < n; start += LANES) {
+    const size_t lanes = n - start < LANES ? n - start : LANES;
+    const Montgomery *group_m[LANES];
+    const bigint *group_bases[LANES], *group_exps[LANES];
+    for (size_t l = 0; l < lanes; l++) {
+      group_m[l] = m[order[start + l]];
+      group_bases[l] = bases[order[start + l]];
+      group_exps[l] = exps[order[start + l]];
+    }
+    lanes_group g;
+    error = lanes_group_init(&g, group_m, lanes);
+    if (error != Ok) {
+      break;
+    }
+    // table, acc, rr (reused for the selected entry) and one
+    const size_t words = g.digits * LANES;
+    uint64_t *buffer =
+        calloc((((size_t)1 << LANES_WINDOW) + 3) * words, sizeof(uint64_t));
+    error = buffer == NULL
+                ? MemoryError
+                : lanes_exp_group(&g, group_bases, group_exps, buffer);
+    for (size_t l = 0; error == Ok && l < lanes; l++) {
+      error = lanes_unpack(&g, buffer + ((size_t)1 << LANES_WINDOW) * words, l,
+                           result[order[start + l]]);
+    }
+    free(buffer);
+    lanes_group_free(&g);
+  }
+  free(order);
+  return error;
+}
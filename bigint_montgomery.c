@@ -0,0 +1,622 @@
+#include "bigint.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef BIGINT_THREADS
+#include <pthread.h>
+#endif
+
+BigIntError bigint_montgomery_to(const Montgomery *m, const bigint *a,
+                                 bigint *result) {
+  return bigint_montgomery_mul(m, a, &m->rrm, result);
+}
+
+// Prefix product x_0 ... x_i of batch_invert_range; past x_0 they live in
+// one buffer of modulus-sized slots
+static bigint batch_invert_prefix(const Montgomery *m, const bigint *in[],
+                                  Limb *limbs, size_t i) {
+  if (i == 0) {
+    return *in[0];
+  }
+  const size_t k = m->modulus.len;
+  bigint prefix = {limbs + (i - 1) * k, 0, k, false};
+  bigint_fit(&prefix);
+  return prefix;
+}
+
+static void batch_invert_store(const Montgomery *m, Limb *limbs, size_t i,
+                               const bigint *x) {
+  const size_t k = m->modulus.len;
+  Limb *slot = limbs + (i - 1) * k;
+  memset(slot, 0, k * LIMB_SIZE_BYTES);
+  memcpy(slot, x->limbs, x->len * LIMB_SIZE_BYTES);
+}
+
+// Montgomery's trick: the prefix products x_0 ... x_i are kept in scratch on
+// the way up, so out[i] may alias in[i], and a single inversion of the full
+// product is then unwound on the way down.
+static BigIntError batch_invert_range(const Montgomery *m, const bigint *in[],
+                                      bigint *out[], size_t n) {
+  if (n == 0) {
+    return Ok;
+  }
+
+  // products are reduced below the modulus, so each fits k limbs
+  const size_t k = m->modulus.len;
+  Limb *limbs = NULL;
+  if (n > 1) {
+    if (n - 1 > SIZE_MAX / LIMB_SIZE_BYTES / k) {
+      return MemoryError;
+    }
+    limbs = malloc((n - 1) * k * LIMB_SIZE_BYTES);
+    if (limbs == NULL) {
+      return MemoryError;
+    }
+  }
+
+  BigIntError result = Ok;
+  bigint x = BIGINT_ZERO, inv = BIGINT_ZERO;
+  for (size_t i = 1; result == Ok && i < n; i++) {
+    const bigint prefix = batch_invert_prefix(m, in, limbs, i - 1);
+    result = bigint_montgomery_mul(m, &prefix, in[i], &x);
+    if (result == Ok) {
+      batch_invert_store(m, limbs, i, &x);
+    }
+  }
+
+  // (X R)^-1 = X^-1 R^-1, two multiplications by R^2 bring it to X^-1 R
+  if (result == Ok) {
+    const bigint product = batch_invert_prefix(m, in, limbs, n - 1);
+    result = bigint_invert(&product, &m->modulus, &inv);
+  }
+  if (result == Ok) {
+    result = bigint_montgomery_mul(m, &inv, &m->rrm, &inv);
+  }
+  if (result == Ok) {
+    result = bigint_montgomery_mul(m, &inv, &m->rrm, &inv);
+  }
+  // in[i] is read before out[i] is written
+  for (size_t i = n - 1; result == Ok && i > 0; i--) {
+    const bigint prefix = batch_invert_prefix(m, in, limbs, i - 1);
+    result = bigint_montgomery_mul(m, &inv, &prefix, &x);
+    if (result == Ok) {
+      result = bigint_montgomery_mul(m, &inv, in[i], &inv);
+    }
+    if (result == Ok) {
+      result = bigint_copy(&x, out[i]);
+    }
+  }
+  if (result == Ok) {
+    result = bigint_copy(&inv, out[0]);
+  }
+  free(limbs);
+  bigint_free_limbs(&x);
+  bigint_free_limbs(&inv);
+  return result;
+}
+
+BigIntError bigint_batch_invert(const Montgomery *m, const bigint *in[],
+                                bigint *out[], size_t n) {
+  return batch_invert_range(m, in, out, n);
+}
+
+#ifdef BIGINT_THREADS
+typedef struct batch_invert_job {
+  const Montgomery *m;
+  const bigint **in;
+  bigint **out;
+  size_t n;
+  BigIntError result;
+  bool threaded;
+} batch_invert_job;
+
+static void *batch_invert_worker(void *arg) {
+  batch_invert_job *job = arg;
+  job->result = batch_invert_range(job->m, job->in, job->out, job->n);
+  return NULL;
+}
+#endif
+
+BigIntError bigint_batch_invert_parallel(const Montgomery *m,
+                                         const bigint *in[], bigint *out[],
+                                         size_t n, size_t threads) {
+#ifdef BIGINT_THREADS
+  if (threads > n) {
+    threads = n;
+  }
+  if (threads < 2) {
+    return batch_invert_range(m, in, out, n);
+  }
+
+  // every chunk pays for its own inversion
+  pthread_t *ids = malloc(threads * sizeof(*ids));
+  batch_invert_job *jobs = malloc(threads * sizeof(*jobs));
+  if (ids == NULL || jobs == NULL) {
+    free(ids);
+    free(jobs);
+    return MemoryError;
+  }
+
+  for (size_t t = 0; t < threads; t++) {
+    const size_t begin = n * t / threads;
+    const size_t end = n * (t + 1) / threads;
+    jobs[t] = (batch_invert_job){m, in + begin, out + begin, end - begin, Ok,
+                                 false};
+    // the last chunk runs on the calling thread
+    jobs[t].threaded =
+        t + 1 < threads &&
+        pthread_create(&ids[t], NULL, batch_invert_worker, &jobs[t]) == 0;
+    if (!jobs[t].threaded) {
+      batch_invert_worker(&jobs[t]);
+    }
+  }
+
+  BigIntError result = Ok;
+  for (size_t t = 0; t < threads; t++) {
+    if (jobs[t].threaded) {
+      pthread_join(ids[t], NULL);
+    }
+    if (result == Ok) {
+      result = jobs[t].result;
+    }
+  }
+  free(ids);
+  free(jobs);
+  return result;
+#else
+  (void)threads;
+  return batch_invert_range(m, in, out, n);
+#endif
+}
+
+#define FIXED_BASE_MAGIC 0x42464246u
+#define FIXED_BASE_VERSION 1u
+#define FIXED_BASE_MAX_TEETH 16
+
+typedef struct fixed_base_header {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t limb_size;
+  uint32_t teeth;
+  uint64_t spacing;
+  uint64_t max_bits;
+  uint64_t entry_limbs;
+} fixed_base_header;
+
+static Limb *fixed_base_slot(const bigint_fixed_base *fb, size_t table,
+                             size_t index) {
+  return fb->table +
+         ((table << fb->teeth) + index) * fb->entry_limbs;
+}
+
+static bigint fixed_base_entry(const bigint_fixed_base *fb, size_t table,
+                               size_t index) {
+  bigint entry = {fixed_base_slot(fb, table, index), 0, fb->entry_limbs,
+                  false};
+  bigint_fit(&entry);
+  return entry;
+}
+
+static void fixed_base_store(bigint_fixed_base *fb, size_t table, size_t index,
+                             const bigint *x) {
+  Limb *slot = fixed_base_slot(fb, table, index);
+  memset(slot, 0, fb->entry_limbs * LIMB_SIZE_BYTES);
+  memcpy(slot, x->limbs, x->len * LIMB_SIZE_BYTES);
+}
+
+static size_t fixed_base_spacing(size_t max_bits, size_t teeth) {
+  return max_bits / teeth + (max_bits % teeth != 0);
+}
+
+// Serialized header, modulus and tables in bytes, or 0 when that does not
+// fit a size_t.
+static size_t fixed_base_serialized_bytes(size_t spacing, size_t teeth,
+                                          size_t entry_limbs) {
+  const size_t fixed = sizeof(fixed_base_header);
+  if (spacing > SIZE_MAX >> teeth) {
+    return 0;
+  }
+  const size_t entries = (spacing << teeth) + 1;
+  if (entries == 0 || entry_limbs > SIZE_MAX / LIMB_SIZE_BYTES / entries) {
+    return 0;
+  }
+  const size_t bytes = entries * entry_limbs * LIMB_SIZE_BYTES;
+  return bytes > SIZE_MAX - fixed ? 0 : bytes + fixed;
+}
+
+static BigIntError fixed_base_alloc(const Montgomery *m, size_t max_bits,
+                                    size_t teeth, bigint_fixed_base *fb) {
+  fb->table = NULL;
+  if (teeth == 0 || teeth > FIXED_BASE_MAX_TEETH || max_bits == 0) {
+    return NotImplemented;
+  }
+  fb->m = m;
+  fb->teeth = teeth;
+  fb->spacing = fixed_base_spacing(max_bits, teeth);
+  fb->max_bits = max_bits;
+  fb->entry_limbs = m->modulus.len;
+  if (fixed_base_serialized_bytes(fb->spacing, teeth, fb->entry_limbs) == 0) {
+    return MemoryError;
+  }
+  fb->table = malloc((fb->spacing << teeth) * fb->entry_limbs * LIMB_SIZE_BYTES);
+  return fb->table == NULL ? MemoryError : Ok;
+}
+
+// Lim-Lee comb with one table per comb column: table k holds every product of
+// g^(2^(j spacing + k)), j < teeth, so an exponentiation is one lookup and at
+// most one multiplication per column and no squarings.
+BigIntError bigint_fixed_base_init(const Montgomery *m, const bigint *base,
+                                   size_t max_bits, size_t teeth,
+                                   bigint_fixed_base *fb) {
+  BigIntError result = fixed_base_alloc(m, max_bits, teeth, fb);
+  if (result != Ok) {
+    return result;
+  }
+
+  const size_t powers_len = fb->spacing * teeth;
+  bigint *powers = calloc(powers_len, sizeof(*powers));
+  bigint q = BIGINT_ZERO, x = BIGINT_ZERO, one = BIGINT_ZERO;
+  if (powers == NULL) {
+    bigint_fixed_base_free(fb);
+    return MemoryError;
+  }
+
+  bigint_div(base, &m->modulus, &q, &x);
+  bigint_montgomery_to(m, &x, &x);
+  bigint_montgomery_reduce(m, &m->rrm, &one);
+  for (size_t i = 0; i < powers_len; i++) {
+    bigint_copy(&x, &powers[i]);
+    bigint_montgomery_mul(m, &x, &x, &x);
+  }
+
+  for (size_t k = 0; k < fb->spacing; k++) {
+    fixed_base_store(fb, k, 0, &one);
+    for (size_t index = 1; index < ((size_t)1 << teeth); index++) {
+      size_t top = 0;
+      while (index >> (top + 1)) {
+        top++;
+      }
+      bigint rest = fixed_base_entry(fb, k, index ^ ((size_t)1 << top));
+      bigint_montgomery_mul(m, &rest, &powers[top * fb->spacing + k], &x);
+      fixed_base_store(fb, k, index, &x);
+    }
+  }
+
+  for (size_t i = 0; i < powers_len; i++) {
+    bigint_free_limbs(&powers[i]);
+  }
+  free(powers);
+  bigint_free_limbs(&q);
+  bigint_free_limbs(&x);
+  bigint_free_limbs(&one);
+  return Ok;
+}
+
+BigIntError bigint_fixed_base_exp(const bigint_fixed_base *fb, const bigint *e,
+                                  bigint *result) {
+  if (e->negative || bigint_bit_length(e) > fb->max_bits) {
+    return NotImplemented;
+  }
+
+  bigint acc = BIGINT_ZERO;
+  bool first = true;
+  for (size_t k = 0; k < fb->spacing; k++) {
+    size_t index = 0;
+    for (size_t j = 0; j < fb->teeth; j++) {
+      const size_t bit = j * fb->spacing + k;
+      if (bit / LIMB_SIZE_BITS < e->len &&
+          (e->limbs[bit / LIMB_SIZE_BITS] >> (bit % LIMB_SIZE_BITS)) & 1) {
+        index |= (size_t)1 << j;
+      }
+    }
+    if (index == 0) {
+      continue;
+    }
+    bigint entry = fixed_base_entry(fb, k, index);
+    if (first) {
+      bigint_copy(&entry, &acc);
+      first = false;
+    } else {
+      bigint_montgomery_mul(fb->m, &acc, &entry, &acc);
+    }
+  }
+
+  if (first) {
+    bigint entry = fixed_base_entry(fb, 0, 0);
+    bigint_copy(&entry, &acc);
+  }
+  BigIntError reduce_result = bigint_montgomery_reduce(fb->m, &acc, result);
+  bigint_free_limbs(&acc);
+  return reduce_result;
+}
+
+void bigint_fixed_base_free(bigint_fixed_base *fb) {
+  free(fb->table);
+  fb->table = NULL;
+}
+
+size_t bigint_fixed_base_serialized_size(const bigint_fixed_base *fb) {
+  return fixed_base_serialized_bytes(fb->spacing, fb->teeth, fb->entry_limbs);
+}
+
+// Native byte order, the modulus is stored to reject a table built for
+// another context.
+BigIntError bigint_fixed_base_serialize(const bigint_fixed_base *fb,
+                                        uint8_t *buffer) {
+  const fixed_base_header header = {
+      FIXED_BASE_MAGIC, FIXED_BASE_VERSION, LIMB_SIZE_BYTES, fb->teeth,
+      fb->spacing,      fb->max_bits,       fb->entry_limbs};
+  const size_t entry_bytes = fb->entry_limbs * LIMB_SIZE_BYTES;
+  memcpy(buffer, &header, sizeof(header));
+  buffer += sizeof(header);
+  memset(buffer, 0, entry_bytes);
+  memcpy(buffer, fb->m->modulus.limbs, fb->m->modulus.len * LIMB_SIZE_BYTES);
+  buffer += entry_bytes;
+  memcpy(buffer, fb->table, (fb->spacing << fb->teeth) * entry_bytes);
+  return Ok;
+}
+
+BigIntError bigint_fixed_base_deserialize(const Montgomery *m,
+                                          const uint8_t *buffer, size_t size,
+                                          bigint_fixed_base *fb) {
+  fixed_base_header header;
+  if (size < sizeof(header)) {
+    return InvalidFormat;
+  }
+  memcpy(&header, buffer, sizeof(header));
+  if (header.magic != FIXED_BASE_MAGIC ||
+      header.version != FIXED_BASE_VERSION ||
+      header.limb_size != LIMB_SIZE_BYTES ||
+      header.entry_limbs != m->modulus.len || header.teeth == 0 ||
+      header.teeth > FIXED_BASE_MAX_TEETH || header.max_bits == 0 ||
+      header.max_bits > SIZE_MAX ||
+      header.spacing != fixed_base_spacing(header.max_bits, header.teeth)) {
+    return InvalidFormat;
+  }
+  // the header is untrusted, check it against the buffer before allocating
+  const size_t expected = fixed_base_serialized_bytes(
+      header.spacing, header.teeth, header.entry_limbs);
+  if (expected == 0 || size != expected) {
+    return InvalidFormat;
+  }
+
+  BigIntError result = fixed_base_alloc(m, header.max_bits, header.teeth, fb);
+  if (result != Ok) {
+    return result;
+  }
+
+  const size_t entry_bytes = fb->entry_limbs * LIMB_SIZE_BYTES;
+  buffer += sizeof(header);
+  if (memcmp(buffer, m->modulus.limbs, entry_bytes) != 0) {
+    bigint_fixed_base_free(fb);
+    return InvalidFormat;
+  }
+  buffer += entry_bytes;
+  memcpy(fb->table, buffer, (fb->spacing << fb->teeth) * entry_bytes);
+  return Ok;
+}
+
+#define MULTIEXP_PIPPENGER_THRESHOLD 32
+
+static size_t exp_window(const bigint *e, size_t bit, size_t width) {
+  size_t digit = 0;
+  for (size_t j = 0; j < width; j++, bit++) {
+    if (bit / LIMB_SIZE_BITS < e->len &&
+        (e->limbs[bit / LIMB_SIZE_BITS] >> (bit % LIMB_SIZE_BITS)) & 1) {
+      digit |= (size_t)1 << j;
+    }
+  }
+  return digit;
+}
+
+// acc *= x, an empty acc is the neutral element and takes a copy of x
+static void multiexp_mul(const Montgomery *m, bigint *acc, bool *empty,
+                         const bigint *x) {
+  if (*empty) {
+    bigint_copy(x, acc);
+    *empty = false;
+  } else {
+    bigint_montgomery_mul(m, acc, x, acc);
+  }
+}
+
+// Straus: every base gets a table of its first 2^width powers and all terms
+// share one chain of squarings.
+static BigIntError multiexp_straus(const Montgomery *m, const bigint *bases,
+                                   const bigint *exps[], size_t n, size_t bits,
+                                   bigint *acc, bool *empty) {
+  const size_t width = bits > 512 ? 5 : bits > 128 ? 4 : bits > 24 ? 3 : 1;
+  const size_t table_len = (size_t)1 << width;
+  bigint *table = calloc(n * table_len, sizeof(*table));
+  if (table == NULL) {
+    return MemoryError;
+  }
+  for (size_t i = 0; i < n; i++) {
+    bigint *powers = table + i * table_len;
+    bigint_copy(&bases[i], &powers[1]);
+    for (size_t d = 2; d < table_len; d++) {
+      bigint_montgomery_mul(m, &powers[d - 1], &bases[i], &powers[d]);
+    }
+  }
+
+  for (size_t bit = (bits + width - 1) / width * width; bit > 0;) {
+    bit -= width;
+    for (size_t j = 0; j < width && !*empty; j++) {
+      bigint_montgomery_mul(m, acc, acc, acc);
+    }
+    for (size_t i = 0; i < n; i++) {
+      const size_t digit = exp_window(exps[i], bit, width);
+      if (digit) {
+        multiexp_mul(m, acc, empty, &table[i * table_len + digit]);
+      }
+    }
+  }
+
+  for (size_t i = 0; i < n * table_len; i++) {
+    bigint_free_limbs(&table[i]);
+  }
+  free(table);
+  return Ok;
+}
+
+// Pippenger: per window every base goes into the bucket of its digit, and
+// prod bucket[d]^d is collected with two running products.
+static BigIntError multiexp_pippenger(const Montgomery *m, const bigint *bases,
+                                      const bigint *exps[], size_t n,
+                                      size_t bits, bigint *acc, bool *empty) {
+  size_t width = 1;
+  while (((size_t)1 << (width + 2)) < n) {
+    width++;
+  }
+  const size_t buckets_len = (size_t)1 << width;
+  bigint *buckets = calloc(buckets_len, sizeof(*buckets));
+  bool *filled = calloc(buckets_len, sizeof(*filled));
+  bigint running = BIGINT_ZERO, total = BIGINT_ZERO;
+  if (buckets == NULL || filled == NULL) {
+    free(buckets);
+    free(filled);
+    return MemoryError;
+  }
+
+  for (size_t bit = (bits + width - 1) / width * width; bit > 0;) {
+    bit -= width;
+    for (size_t j = 0; j < width && !*empty; j++) {
+      bigint_montgomery_mul(m, acc, acc, acc);
+    }
+
+    memset(filled, 0, buckets_len * sizeof(*filled));
+    for (size_t i = 0; i < n; i++) {
+      const size_t digit = exp_window(exps[i], bit, width);
+      if (digit) {
+        bool empty_bucket = !filled[digit];
+        multiexp_mul(m, &buckets[digit], &empty_bucket, &bases[i]);
+        filled[digit] = true;
+      }
+    }
+
+    bool running_empty = true, total_empty = true;
+    for (size_t d = buckets_len - 1; d > 0; d--) {
+      if (filled[d]) {
+        multiexp_mul(m, &running, &running_empty, &buckets[d]);
+      }
+      if (!running_empty) {
+        multiexp_mul(m, &total, &total_empty, &running);
+      }
+    }
+    if (!total_empty) {
+      multiexp_mul(m, acc, empty, &total);
+    }
+  }
+
+  for (size_t d = 0; d < buckets_len; d++) {
+    bigint_free_limbs(&buckets[d]);
+  }
+  free(buckets);
+  free(filled);
+  bigint_free_limbs(&running);
+  bigint_free_limbs(&total);
+  return Ok;
+}
+
+BigIntError bigint_montgomery_multiexp(const Montgomery *m,
+                                       const bigint *bases[],
+                                       const bigint *exps[], size_t n,
+                                       bigint *result) {
+  size_t bits = 0;
+  for (size_t i = 0; i < n; i++) {
+    if (exps[i]->negative) {
+      return NotImplemented;
+    }
+    const size_t e_bits = bigint_bit_length(exps[i]);
+    bits = e_bits > bits ? e_bits : bits;
+  }
+
+  bigint *residues = calloc(n ? n : 1, sizeof(*residues));
+  if (residues == NULL) {
+    return MemoryError;
+  }
+  bigint q = BIGINT_ZERO, acc = BIGINT_ZERO;
+  for (size_t i = 0; i < n; i++) {
+    bigint_div(bases[i], &m->modulus, &q, &residues[i]);
+    bigint_montgomery_to(m, &residues[i], &residues[i]);
+  }
+
+  bool empty = true;
+  BigIntError error =
+      n < MULTIEXP_PIPPENGER_THRESHOLD
+          ? multiexp_straus(m, residues, exps, n, bits, &acc, &empty)
+          : multiexp_pippenger(m, residues, exps, n, bits, &acc, &empty);
+
+  if (error == Ok) {
+    if (empty) {
+      bigint_montgomery_reduce(m, &m->rrm, &acc);
+    }
+    error = bigint_montgomery_reduce(m, &acc, result);
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    bigint_free_limbs(&residues[i]);
+  }
+  free(residues);
+  bigint_free_limbs(&q);
+  bigint_free_limbs(&acc);
+  return error;
+}
+
+BigIntError bigint_montgomery_exp(const Montgomery *m, const bigint *base,
+                                  const bigint *e, bigint *result) {
+  return bigint_montgomery_multiexp(m, &base, &e, 1, result);
+}
+
+// Products of reduced values are below m^2, so with MONTGOMERY_ACC_HEADROOM
+// spare limbs the sum of 2^(headroom bits) of them still fits the buffer
+// reserved at init and no reduction is needed until then.
+BigIntError bigint_montgomery_acc_init(const Montgomery *m,
+                                       bigint_montgomery_acc *acc) {
+  acc->m = m;
+  acc->sum = BIGINT_ZERO;
+  acc->terms = 0;
+  acc->max_terms = MONTGOMERY_ACC_HEADROOM * LIMB_SIZE_BITS < sizeof(size_t) * 8
+                       ? (size_t)1 << (MONTGOMERY_ACC_HEADROOM * LIMB_SIZE_BITS)
+                       : SIZE_MAX;
+  BigIntError result =
+      bigint_resize(&acc->sum, 2 * m->modulus.len + MONTGOMERY_ACC_HEADROOM);
+  acc->sum.len = 0;
+  return result;
+}
+
+// sum += a b for a, b in Montgomery form
+BigIntError bigint_montgomery_acc_addmul(bigint_montgomery_acc *acc,
+                                         const bigint *a, const bigint *b) {
+  if (acc->terms >= acc->max_terms) {
+    // out of headroom, fold the sum back below m
+    bigint q = BIGINT_ZERO;
+    BigIntError result = bigint_div(&acc->sum, &acc->m->modulus, &q, &acc->sum);
+    bigint_free_limbs(&q);
+    if (result != Ok) {
+      return result;
+    }
+    acc->terms = 1;
+  }
+  acc->terms++;
+  return bigint_addmul(&acc->sum, a, b);
+}
+
+// result = sum R^-1 mod m, the Montgomery form of the sum of products, and
+// the accumulator starts over from zero.
+BigIntError bigint_montgomery_acc_finish(bigint_montgomery_acc *acc,
+                                         bigint *result) {
+  BigIntError error = bigint_montgomery_reduce(acc->m, &acc->sum, result);
+  if (error == Ok && !bigint_less_than(result, &acc->m->modulus)) {
+    // REDC of a sum of k products leaves up to k + 1 multiples of m
+    bigint q = BIGINT_ZERO;
+    error = bigint_div(result, &acc->m->modulus, &q, result);
+    bigint_free_limbs(&q);
+  }
+  acc->sum.len = 0;
+  acc->terms = 0;
+  return error;
+}
+
+void bigint_montgomery_acc_free(bigint_montgomery_acc *acc) {
+  bigint_free_limbs(&acc->sum);
+}
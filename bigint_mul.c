@@ -1,5 +1,8 @@
 #include "bigint.h"
+#include "bigint_comba.h"
+#include "bigint_stats.h"
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 static void supermul(Limb a, Limb b, Limb *lo, Limb *hi) {
@@ -27,11 +30,82 @@ static void supermul(Limb a, Limb b, Limb *lo, Limb *hi) {
 #endif
 }
 
+static void add_1(Limb *r, size_t n, Limb carry) {
+  for (size_t i = 0; carry && i < n; i++) {
+    r[i] += carry;
+    carry = r[i] < carry;
+  }
+}
+
+static Limb sub_1(Limb *r, size_t n, Limb borrow) {
+  for (size_t i = 0; borrow && i < n; i++) {
+    Limb x = r[i];
+    r[i] = x - borrow;
+    borrow = x < borrow;
+  }
+  return borrow;
+}
+
+static Limb addmul_1(Limb *r, const Limb *a, size_t n, Limb b) {
+  Limb carry = 0;
+  for (size_t i = 0; i < n; i++) {
+    Limb lo, hi;
+    supermul(a[i], b, &lo, &hi);
+    lo += carry;
+    hi += lo < carry;
+    lo += r[i];
+    hi += lo < r[i];
+    r[i] = lo;
+    carry = hi;
+  }
+  return carry;
+}
+
+static Limb submul_1(Limb *r, const Limb *a, size_t n, Limb b) {
+  Limb borrow = 0;
+  for (size_t i = 0; i < n; i++) {
+    Limb lo, hi;
+    supermul(a[i], b, &lo, &hi);
+    lo += borrow;
+    hi += lo < borrow;
+    Limb x = r[i];
+    r[i] = x - lo;
+    borrow = hi + (x < lo);
+  }
+  return borrow;
+}
+
 BigIntError bigint_mul_classic(const bigint *a, const bigint *b, bigint *result) {
+  if (result == a || result == b) {
+    bigint product = BIGINT_ZERO;
+    BigIntError mul_result = bigint_mul_classic(a, b, &product);
+    if (mul_result == Ok) {
+      mul_result = bigint_copy(&product, result);
+    }
+    bigint_free_limbs(&product);
+    return mul_result;
+  }
+
   const size_t max_len = a->len + b->len;
+  const bool comba =
+      a->len == b->len && a->len > 0 && a->len <= COMBA_MAX_LIMBS;
+  STATS_START(timer, comba ? StatsMulComba : StatsMulClassic,
+              a->len > b->len ? a->len : b->len);
 
+  result->len = 0;
   bigint_resize(result, max_len);
 
+  if (comba) {
+    if (a->limbs == b->limbs) {
+      bigint_comba_sqr[a->len](result->limbs, a->limbs);
+    } else {
+      bigint_comba_mul[a->len](result->limbs, a->limbs, b->limbs);
+    }
+    bigint_fit(result);
+    STATS_STOP(timer);
+    return Ok;
+  }
+
   for (size_t i = 0; i < a->len; i++) {
     Limb carry = 0;
     for (size_t j = 0; j < b->len; j++) {
@@ -49,99 +123,381 @@ BigIntError bigint_mul_classic(const bigint *a, const bigint *b, bigint *result)
     result->limbs[i + b->len] = carry;
   }
 
+  bigint_fit(result);
+  STATS_STOP(timer);
   return Ok;
 }
 
-BigIntError bigint_mul_karatsuba_internal(const bigint *a, 
-  const bigint *b, bigint *result) {
-  if (a->len <= MIN_LIMBS && b->len <= MIN_LIMBS) {
-    return bigint_mul_classic(a, b, result);
+static Limb add_n(Limb *r, const Limb *a, const Limb *b, size_t n) {
+  Limb carry = 0;
+  for (size_t i = 0; i < n; i++) {
+    const Limb x = a[i] + carry;
+    carry = x < carry;
+    r[i] = x + b[i];
+    carry += r[i] < x;
+  }
+  return carry;
+}
+
+static Limb sub_n(Limb *r, const Limb *a, const Limb *b, size_t n) {
+  Limb borrow = 0;
+  for (size_t i = 0; i < n; i++) {
+    const Limb x = a[i] - b[i];
+    const Limb y = x - borrow;
+    borrow = (a[i] < b[i]) | (x < borrow);
+    r[i] = y;
   }
+  return borrow;
+}
 
-  const size_t max_len = (a->len > b->len) ? a->len : b->len;
-  const size_t middle = (max_len + 1)/2;
-  const size_t middle_bytes = (max_len * LIMB_SIZE_BYTES) / 2;
-  #if LIMB_SIZE_BITS != 8
-  const size_t middle_bytes_high = middle_bytes;
-  #else
-  const size_t middle_bytes_high = middle_bytes + 1;
-  #endif
-
-  bigint *a_low = bigint_new_capacity(0);
-  bigint_resize(a_low, middle);
-  memset(a_low->limbs, 0, a_low->capacity * LIMB_SIZE_BYTES);
-  memcpy(a_low->limbs, a->limbs, middle_bytes);
-
-  bigint *a_high = bigint_new_capacity(0);
-  bigint_resize(a_high, middle);
-  memset(a_high->limbs, 0, a_high->capacity * LIMB_SIZE_BYTES);
-  memcpy(a_high->limbs, (uint8_t*)a->limbs + middle_bytes,middle_bytes_high);
-
-  bigint *b_low = bigint_new_capacity(0);
-  bigint_resize(b_low, middle);
-  memset(b_low->limbs, 0, b_low->capacity * LIMB_SIZE_BYTES);
-  memcpy(b_low->limbs, b->limbs, middle_bytes);
-
-  bigint *b_high = bigint_new_capacity(0);
-  bigint_resize(b_high, middle);
-  memset(b_high->limbs, 0, b_high->capacity * LIMB_SIZE_BYTES);
-  memcpy(b_high->limbs, (uint8_t*)b->limbs + middle_bytes,middle_bytes_high);
-
-  bigint *c0 = bigint_new_capacity(0);
-  bigint_mul_karatsuba(a_low, b_low, c0);
- 
-  bigint *c2 = bigint_new_capacity(0);
-  bigint_mul_karatsuba(a_high, b_high, c2);
-
-  bigint *c1 = bigint_new_capacity(0);
-  bigint *c1_0 = bigint_new_capacity(0);
-  bigint_add(a_high, a_low, c1_0);
-  bigint *c1_1 = bigint_new_capacity(0);
-  bigint_add(b_low, b_high, c1_1);
-  bigint_mul_karatsuba(c1_0, c1_1, c1);
-  bigint_sub(c1, c2, c1_0);
-  bigint_sub(c1_0, c0, c1_1);
-  bigint_copy(c1_1, c1);
-  
-  bigint_copy(c0, result);
-  
-  bigint *tmp = bigint_new_capacity(0);
-  memset(tmp->limbs, 0, LIMB_SIZE_BYTES * tmp->capacity);
-  bigint_bit_shiftl(c1, middle_bytes*8, tmp);
-  bigint_add(result, tmp, c1);
-  bigint_copy(c1, result);
-
-  memset(tmp->limbs, 0, LIMB_SIZE_BYTES * tmp->capacity);
-  bigint_bit_shiftl(c2, 2*middle_bytes*8, tmp);
-  bigint_add(result, tmp, c2);
-  bigint_copy(c2, result);
-
-  bigint_free_limbs(a_low);
-  bigint_free_limbs(a_high);
-  bigint_free_limbs(b_low);
-  bigint_free_limbs(b_high);
-  bigint_free_limbs(c0);
-  bigint_free_limbs(c2);
-  bigint_free_limbs(c1);
-  bigint_free_limbs(c1_0);
-  bigint_free_limbs(c1_1);
-  bigint_free_limbs(tmp);
-  return Ok;
+// r = |x - y| for x of n limbs and y of m <= n limbs, true when x < y
+static bool abs_diff(Limb *r, const Limb *x, size_t n, const Limb *y,
+                     size_t m) {
+  bool less = false;
+  size_t i = n;
+  while (i > m && x[i - 1] == 0) {
+    i--;
+  }
+  if (i == m) {
+    while (i > 0 && x[i - 1] == y[i - 1]) {
+      i--;
+    }
+    less = i > 0 && x[i - 1] < y[i - 1];
+  }
+  if (less) {
+    sub_n(r, y, x, m);
+    for (size_t j = m; j < n; j++) {
+      r[j] = 0;
+    }
+  } else {
+    const Limb borrow = sub_n(r, x, y, m);
+    memcpy(r + m, x + m, (n - m) * LIMB_SIZE_BYTES);
+    sub_1(r + m, n - m, borrow);
+  }
+  return less;
+}
+
+// r[0, n + m) = a[0, n) b[0, m), r must not overlap a or b
+static void mul_basecase(Limb *r, const Limb *a, size_t n, const Limb *b,
+                         size_t m) {
+  if (n == m && n <= COMBA_MAX_LIMBS) {
+    STATS_START(timer, StatsMulComba, n);
+    if (a == b) {
+      bigint_comba_sqr[n](r, a);
+    } else {
+      bigint_comba_mul[n](r, a, b);
+    }
+    STATS_STOP(timer);
+    return;
+  }
+  STATS_START(timer, StatsMulClassic, n > m ? n : m);
+  memset(r, 0, m * LIMB_SIZE_BYTES);
+  for (size_t i = 0; i < n; i++) {
+    r[i + m] = addmul_1(r + i, b, m, a[i]);
+  }
+  STATS_STOP(timer);
+}
+
+// Scratch limbs karatsuba_n needs below r: the two differences and their
+// product on every level, and the middle sum on the last one.
+static size_t karatsuba_scratch(size_t n) {
+  size_t total = 0;
+  while (n >= KARATSUBA_THRESHOLD) {
+    const size_t low = (n + 1) / 2;
+    total += 4 * low;
+    if (low < KARATSUBA_THRESHOLD) {
+      total += 2 * low + 1;
+    }
+    n = low;
+  }
+  return total;
+}
+
+// r[0, 2 n) = a b with the subtractive variant, a0 b1 + a1 b0 is
+// a0 b0 + a1 b1 - (a0 - a1)(b0 - b1), so no operand grows a carry limb.
+// a == b squares, the differences coincide and every product is a square.
+static void karatsuba_n(Limb *r, const Limb *a, const Limb *b, size_t n,
+                        Limb *scratch) {
+  if (n < KARATSUBA_THRESHOLD) {
+    mul_basecase(r, a, n, b, n);
+    return;
+  }
+  STATS_START(timer, StatsMulKaratsuba, n);
+  const size_t low = (n + 1) / 2;
+  const size_t high = n - low;
+  Limb *da = scratch;
+  Limb *db = scratch + low;
+  Limb *t = scratch + 2 * low;
+  Limb *next = scratch + 4 * low;
+
+  bool negative = abs_diff(da, a, low, a + low, high);
+  if (a == b) {
+    db = da;
+    negative = false;
+  } else {
+    negative ^= abs_diff(db, b, low, b + low, high);
+  }
+  karatsuba_n(t, da, db, low, next);
+  karatsuba_n(r, a, b, low, next);
+  karatsuba_n(r + 2 * low, a + low, b + low, high, next);
+
+  // z = a0 b0 + a1 b1 -+ t, then r += z shifted by low limbs
+  Limb *z = next;
+  memcpy(z, r, 2 * low * LIMB_SIZE_BYTES);
+  z[2 * low] = 0;
+  const Limb carry = add_n(z, z, r + 2 * low, 2 * high);
+  add_1(z + 2 * high, 2 * low + 1 - 2 * high, carry);
+  if (negative) {
+    const Limb sum_carry = add_n(z, z, t, 2 * low);
+    add_1(z + 2 * low, 1, sum_carry);
+  } else {
+    const Limb borrow = sub_n(z, z, t, 2 * low);
+    sub_1(z + 2 * low, 1, borrow);
+  }
+  const Limb top = add_n(r + low, r + low, z, 2 * low + 1);
+  add_1(r + 3 * low + 1, 2 * n - 3 * low - 1, top);
+  STATS_STOP(timer);
+}
+
+static size_t mul_scratch(size_t n, size_t m) {
+  if (m < KARATSUBA_THRESHOLD) {
+    return 0;
+  }
+  size_t need = karatsuba_scratch(m);
+  if (n > m) {
+    need += 2 * m;
+  }
+  if (n % m != 0) {
+    const size_t rest = 2 * m + mul_scratch(m, n % m);
+    need = rest > need ? rest : need;
+  }
+  return need;
+}
+
+// r[0, n + m) = a b for n >= m, the longer operand is cut into m limb
+// pieces so every piece is a balanced Karatsuba product
+static void mul_unbalanced(Limb *r, const Limb *a, size_t n, const Limb *b,
+                           size_t m, Limb *scratch) {
+  if (m < KARATSUBA_THRESHOLD) {
+    mul_basecase(r, a, n, b, m);
+    return;
+  }
+  karatsuba_n(r, a, b, m, scratch);
+  Limb *t = scratch;
+  for (size_t i = m; i < n; i += m) {
+    const size_t len = n - i < m ? n - i : m;
+    if (len == m) {
+      karatsuba_n(t, a + i, b, m, t + 2 * m);
+    } else {
+      mul_unbalanced(t, b, m, a + i, len, t + 2 * m);
+    }
+    // r[i, i + m) holds the top of the previous piece
+    const Limb carry = add_n(r + i, r + i, t, m);
+    memcpy(r + i + m, t + m, len * LIMB_SIZE_BYTES);
+    add_1(r + i + m, len, carry);
+  }
 }
 
 BigIntError bigint_mul_karatsuba(const bigint *a, 
   const bigint *b, bigint *result) {
-    bigint *a_copy = bigint_new_capacity(0);
-    bigint *b_copy = bigint_new_capacity(0);
-    const size_t max_len = (a->len > b->len) ? a->len : b->len;
-    bigint_resize(a_copy, max_len);
-    bigint_resize(b_copy, max_len);
-    bigint_copy(a, a_copy);
-    bigint_copy(b, b_copy);
-    bigint_mul_karatsuba_internal(a_copy, b_copy, result);
-    return Ok;
+  if (a->len < b->len) {
+    const bigint *t = a;
+    a = b;
+    b = t;
+  }
+  const size_t n = a->len;
+  const size_t m = b->len;
+  if (m == 0) {
+    return bigint_set_from_limb(0, result);
+  }
+
+  // one buffer for the scratch and, when result aliases an operand, the product
+  const bool aliased = result == a || result == b;
+  const size_t scratch_len = mul_scratch(n, m);
+  Limb *buffer =
+      malloc((scratch_len + (aliased ? n + m : 0) + 1) * LIMB_SIZE_BYTES);
+  if (buffer == NULL) {
+    return MemoryError;
+  }
+  Limb *product = buffer + scratch_len;
+  if (!aliased) {
+    result->len = 0;
+    const BigIntError resize_result = bigint_resize(result, n + m);
+    if (resize_result != Ok) {
+      free(buffer);
+      return resize_result;
+    }
+    product = result->limbs;
+  }
+  mul_unbalanced(product, a->limbs, n, b->limbs, m, buffer);
+  if (aliased) {
+    const BigIntError resize_result = bigint_resize(result, n + m);
+    if (resize_result != Ok) {
+      free(buffer);
+      return resize_result;
+    }
+    memcpy(result->limbs, product, (n + m) * LIMB_SIZE_BYTES);
+  }
+  free(buffer);
+  result->len = n + m;
+  bigint_fit(result);
+  return Ok;
 }
 
 BigIntError bigint_mul(const bigint *a, const bigint *b, bigint *result) {
+  if (a->len < KARATSUBA_THRESHOLD || b->len < KARATSUBA_THRESHOLD) {
+    return bigint_mul_classic(a, b, result);
+  }
   return bigint_mul_karatsuba(a, b, result);
 }
+
+BigIntError bigint_addmul_limb(bigint *acc, const bigint *a, Limb b) {
+  const size_t len_a = a->len;
+  const size_t len = (acc->len > len_a ? acc->len : len_a) + 1;
+  BigIntError resize_result = bigint_resize(acc, len);
+  if (resize_result != Ok) {
+    return resize_result;
+  }
+  // a may alias acc, addmul_1 reads each limb before writing it back
+  Limb carry = addmul_1(acc->limbs, a->limbs, len_a, b);
+  add_1(acc->limbs + len_a, len - len_a, carry);
+  bigint_fit(acc);
+  return Ok;
+}
+
+static BigIntError bigint_addmul_rows(bigint *acc, const bigint *a,
+                                      const bigint *b, bool sub) {
+  if (a->len == 0 || b->len == 0) {
+    return Ok;
+  }
+  if (a->len >= KARATSUBA_THRESHOLD && b->len >= KARATSUBA_THRESHOLD) {
+    bigint product = BIGINT_ZERO;
+    BigIntError result = bigint_mul(a, b, &product);
+    if (result == Ok) {
+      result = sub ? bigint_sub(acc, &product, acc)
+                   : bigint_add(acc, &product, acc);
+    }
+    if (sub && result == NotImplemented) {
+      // acc now holds product - acc
+      bigint_sub(&product, acc, acc);
+    }
+    bigint_free_limbs(&product);
+    return result;
+  }
+
+  const size_t product_len = a->len + b->len;
+  const size_t len =
+      (acc->len > product_len ? acc->len : product_len) + (sub ? 0 : 1);
+  BigIntError resize_result = bigint_resize(acc, len);
+  if (resize_result != Ok) {
+    return resize_result;
+  }
+
+  Limb borrow = 0;
+  for (size_t j = 0; j < b->len; j++) {
+    Limb *row = acc->limbs + j;
+    if (sub) {
+      Limb carry = submul_1(row, a->limbs, a->len, b->limbs[j]);
+      borrow |= sub_1(row + a->len, len - j - a->len, carry);
+    } else {
+      Limb carry = addmul_1(row, a->limbs, a->len, b->limbs[j]);
+      add_1(row + a->len, len - j - a->len, carry);
+    }
+  }
+
+  if (borrow) {
+    // acc < a * b, add the product back to restore acc
+    for (size_t j = 0; j < b->len; j++) {
+      Limb *row = acc->limbs + j;
+      Limb carry = addmul_1(row, a->limbs, a->len, b->limbs[j]);
+      add_1(row + a->len, len - j - a->len, carry);
+    }
+    bigint_fit(acc);
+    return NotImplemented;
+  }
+
+  bigint_fit(acc);
+  return Ok;
+}
+
+static BigIntError bigint_addmul_aliased(bigint *acc, const bigint *a,
+                                         const bigint *b, bool sub) {
+  if (acc != a && acc != b) {
+    return bigint_addmul_rows(acc, a, b, sub);
+  }
+  bigint acc_copy = BIGINT_ZERO;
+  BigIntError result = bigint_copy(acc, &acc_copy);
+  if (result == Ok) {
+    result = bigint_addmul_rows(acc, acc == a ? &acc_copy : a,
+                                acc == b ? &acc_copy : b, sub);
+  }
+  bigint_free_limbs(&acc_copy);
+  return result;
+}
+
+BigIntError bigint_addmul(bigint *acc, const bigint *a, const bigint *b) {
+  return bigint_addmul_aliased(acc, a, b, false);
+}
+
+BigIntError bigint_submul(bigint *acc, const bigint *a, const bigint *b) {
+  return bigint_addmul_aliased(acc, a, b, true);
+}
+
+// The rows of every term are summed into acc with their carries parked in a
+// second limb vector, so the sum is carried through acc once at the end
+// instead of after every row. Karatsuba-sized terms are multiplied first
+// and added in one pass.
+BigIntError bigint_dot(bigint *acc, const bigint *a[], const bigint *b[],
+                       size_t n) {
+  bool aliased = false;
+  size_t len = acc->len;
+  for (size_t i = 0; i < n; i++) {
+    aliased |= a[i] == acc || b[i] == acc;
+    if (a[i]->len + b[i]->len > len) {
+      len = a[i]->len + b[i]->len;
+    }
+  }
+
+  bigint acc_copy = BIGINT_ZERO;
+  if (aliased) {
+    BigIntError copy_result = bigint_copy(acc, &acc_copy);
+    if (copy_result != Ok) {
+      return copy_result;
+    }
+  }
+
+  // room for the whole sum, n terms add at most log2(n) + 1 bits
+  const size_t total = len + sizeof(n) / LIMB_SIZE_BYTES + 1;
+  Limb *carries = calloc(total, LIMB_SIZE_BYTES);
+  BigIntError result = carries == NULL ? MemoryError : bigint_resize(acc, total);
+  bigint product = BIGINT_ZERO;
+  for (size_t i = 0; result == Ok && i < n; i++) {
+    const bigint *x = a[i] == acc ? &acc_copy : a[i];
+    const bigint *y = b[i] == acc ? &acc_copy : b[i];
+    if (x->len == 0 || y->len == 0) {
+      continue;
+    }
+    if (x->len >= KARATSUBA_THRESHOLD && y->len >= KARATSUBA_THRESHOLD) {
+      result = bigint_mul(x, y, &product);
+      if (result == Ok) {
+        const Limb carry =
+            add_n(acc->limbs, acc->limbs, product.limbs, product.len);
+        add_1(carries + product.len, total - product.len, carry);
+      }
+      continue;
+    }
+    for (size_t j = 0; j < y->len; j++) {
+      const Limb carry =
+          addmul_1(acc->limbs + j, x->limbs, x->len, y->limbs[j]);
+      add_1(carries + j + x->len, total - j - x->len, carry);
+    }
+  }
+  if (result == Ok) {
+    add_n(acc->limbs, acc->limbs, carries, total);
+  }
+  bigint_fit(acc);
+  free(carries);
+  bigint_free_limbs(&product);
+  bigint_free_limbs(&acc_copy);
+  return result;
+}
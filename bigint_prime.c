@@ -0,0 +1,383 @@
+#include "bigint.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef BIGINT_THREADS
+#include <pthread.h>
+#endif
+
+#define SMALL_PRIMES_LIMIT 4096
+#define SMALL_PRIMES_MAX 564
+#define SIEVE_WINDOW 4096
+#define BPSW_REPS 24
+
+// Small odd primes, grouped so that the primes of a group multiply to a
+// value that fits in a Limb: trial division is one bigint_divrem_limb per
+// group instead of one per prime.
+static Limb small_primes[SMALL_PRIMES_MAX];
+static size_t small_primes_len;
+static Limb group_products[SMALL_PRIMES_MAX];
+static size_t group_ends[SMALL_PRIMES_MAX];
+static size_t groups_len;
+
+static void small_primes_init(void) {
+  static bool composite[SMALL_PRIMES_LIMIT];
+  for (size_t i = 3; i < SMALL_PRIMES_LIMIT; i += 2) {
+    if (composite[i]) {
+      continue;
+    }
+    small_primes[small_primes_len++] = i;
+    for (size_t j = i * i; j < SMALL_PRIMES_LIMIT; j += 2 * i) {
+      composite[j] = true;
+    }
+  }
+
+  DoubleLimb product = 1;
+  for (size_t i = 0; i < small_primes_len; i++) {
+    if ((product * small_primes[i]) >> LIMB_SIZE_BITS) {
+      group_ends[groups_len] = i;
+      group_products[groups_len++] = product;
+      product = 1;
+    }
+    product *= small_primes[i];
+  }
+  group_ends[groups_len] = small_primes_len;
+  group_products[groups_len++] = product;
+}
+
+static void small_primes_ready(void) {
+#ifdef BIGINT_THREADS
+  static pthread_once_t once = PTHREAD_ONCE_INIT;
+  pthread_once(&once, small_primes_init);
+#else
+  if (small_primes_len == 0) {
+    small_primes_init();
+  }
+#endif
+}
+
+// residues[i] = n mod small_primes[i]
+static void small_primes_residues(const bigint *n, Limb *residues) {
+  size_t begin = 0;
+  for (size_t g = 0; g < groups_len; g++) {
+    Limb r;
+    bigint_divrem_limb(n, group_products[g], NULL, &r);
+    for (size_t i = begin; i < group_ends[g]; i++) {
+      residues[i] = r % small_primes[i];
+    }
+    begin = group_ends[g];
+  }
+}
+
+static void mod_add(const bigint *a, const bigint *b, const bigint *n,
+                    bigint *r) {
+  bigint_add(a, b, r);
+  if (bigint_cmp(r, n) >= 0) {
+    bigint_sub(r, n, r);
+  }
+}
+
+static void mod_sub(const bigint *a, const bigint *b, const bigint *n,
+                    bigint *r) {
+  if (bigint_sub(a, b, r) != Ok) {
+    // r holds b - a
+    bigint_sub(n, r, r);
+  }
+}
+
+static void mod_half(const bigint *a, const bigint *n, bigint *r) {
+  if (a->len > 0 && (a->limbs[0] & 1)) {
+    bigint_add(a, n, r);
+  } else {
+    bigint_copy(a, r);
+  }
+  bigint_bit_shiftr(r, 1, r);
+}
+
+// Montgomery form of a small signed value
+static void montgomery_small(const Montgomery *m, SignedDoubleLimb x,
+                             bigint *r) {
+  bigint_set_from_limb((Limb)(x < 0 ? -x : x), r);
+  bigint_montgomery_to(m, r, r);
+  if (x < 0 && r->len > 0) {
+    bigint_sub(&m->modulus, r, r);
+  }
+}
+
+// Jacobi symbol (a / n) for odd n
+static int jacobi_limb(Limb a, Limb n) {
+  int result = 1;
+  a %= n;
+  while (a != 0) {
+    while ((a & 1) == 0) {
+      a >>= 1;
+      if ((n & 7) == 3 || (n & 7) == 5) {
+        result = -result;
+      }
+    }
+    Limb t = a;
+    a = n;
+    n = t;
+    if ((a & 3) == 3 && (n & 3) == 3) {
+      result = -result;
+    }
+    a %= n;
+  }
+  return n == 1 ? result : 0;
+}
+
+static bool miller_rabin(const Montgomery *m, const bigint *n_minus_1,
+                         const bigint *base) {
+  bigint d = BIGINT_ZERO, x = BIGINT_ZERO, one = BIGINT_ZERO,
+         minus_one = BIGINT_ZERO;
+  size_t s = 0;
+  while (((n_minus_1->limbs[s / LIMB_SIZE_BITS] >> (s % LIMB_SIZE_BITS)) & 1) ==
+         0) {
+    s++;
+  }
+  bigint_bit_shiftr(n_minus_1, s, &d);
+
+  bigint_montgomery_exp(m, base, &d, &x);
+  bigint_montgomery_to(m, &x, &x);
+  bigint_montgomery_reduce(m, &m->rrm, &one);
+  bigint_sub(&m->modulus, &one, &minus_one);
+
+  bool probable = bigint_equal(&x, &one) || bigint_equal(&x, &minus_one);
+  for (size_t i = 1; i < s && !probable; i++) {
+    bigint_montgomery_mul(m, &x, &x, &x);
+    if (bigint_equal(&x, &one)) {
+      break;
+    }
+    probable = bigint_equal(&x, &minus_one);
+  }
+
+  bigint_free_limbs(&d);
+  bigint_free_limbs(&x);
+  bigint_free_limbs(&one);
+  bigint_free_limbs(&minus_one);
+  return probable;
+}
+
+// Strong Lucas probable prime test with Selfridge's parameters: the first D
+// in 5, -7, 9, -11, ... with (D / n) = -1, P = 1 and Q = (1 - D) / 4.
+static bool strong_lucas(const Montgomery *m, const bigint *n) {
+  const bigint *modulus = &m->modulus;
+  SignedDoubleLimb D = 5;
+  for (size_t tries = 0;; tries++) {
+    const Limb abs_d = (Limb)(D < 0 ? -D : D);
+    Limb n_mod_d;
+    bigint_divrem_limb(n, abs_d, NULL, &n_mod_d);
+    int jacobi = jacobi_limb(n_mod_d, abs_d);
+    if (D < 0 && (n->limbs[0] & 3) == 3) {
+      // (-1 / n) = -1 and reciprocity for (|D| / n)
+      jacobi = -jacobi;
+    }
+    if ((abs_d & 3) == 3 && (n->limbs[0] & 3) == 3) {
+      jacobi = -jacobi;
+    }
+    if (jacobi == -1) {
+      break;
+    }
+    if (jacobi == 0 && (n->len > 1 || n->limbs[0] != abs_d)) {
+      return false;
+    }
+    if (tries == 16 && bigint_perfect_square(n)) {
+      return false;
+    }
+    D = D < 0 ? -D + 2 : -D - 2;
+  }
+
+  bigint d = BIGINT_ZERO, u = BIGINT_ZERO, v = BIGINT_ZERO, qk = BIGINT_ZERO;
+  bigint dm = BIGINT_ZERO, qm = BIGINT_ZERO, t = BIGINT_ZERO;
+  Limb one_limb = 1;
+  const bigint one = {&one_limb, 1, 1, false};
+
+  // n + 1 = d 2^s
+  bigint_add(n, &one, &d);
+  size_t s = 0;
+  while (((d.limbs[s / LIMB_SIZE_BITS] >> (s % LIMB_SIZE_BITS)) & 1) == 0) {
+    s++;
+  }
+  bigint_bit_shiftr(&d, s, &d);
+
+  montgomery_small(m, D, &dm);
+  montgomery_small(m, (1 - D) / 4, &qm);
+  // U_1 = 1, V_1 = P = 1, Q^1
+  montgomery_small(m, 1, &u);
+  bigint_copy(&u, &v);
+  bigint_copy(&qm, &qk);
+
+  for (size_t bit = bigint_bit_length(&d) - 1; bit > 0;) {
+    bit--;
+    // U_2k = U_k V_k, V_2k = V_k^2 - 2 Q^k, Q^2k = (Q^k)^2
+    bigint_montgomery_mul(m, &u, &v, &u);
+    bigint_montgomery_mul(m, &v, &v, &v);
+    mod_sub(&v, &qk, modulus, &v);
+    mod_sub(&v, &qk, modulus, &v);
+    bigint_montgomery_mul(m, &qk, &qk, &qk);
+    if ((d.limbs[bit / LIMB_SIZE_BITS] >> (bit % LIMB_SIZE_BITS)) & 1) {
+      // U_k+1 = (U_k + V_k) / 2, V_k+1 = (D U_k + V_k) / 2
+      bigint_montgomery_mul(m, &dm, &u, &t);
+      mod_add(&u, &v, modulus, &u);
+      mod_half(&u, modulus, &u);
+      mod_add(&t, &v, modulus, &v);
+      mod_half(&v, modulus, &v);
+      bigint_montgomery_mul(m, &qk, &qm, &qk);
+    }
+  }
+
+  bool probable = u.len == 0 || v.len == 0;
+  for (size_t r = 1; r < s && !probable; r++) {
+    bigint_montgomery_mul(m, &v, &v, &v);
+    mod_sub(&v, &qk, modulus, &v);
+    mod_sub(&v, &qk, modulus, &v);
+    bigint_montgomery_mul(m, &qk, &qk, &qk);
+    probable = v.len == 0;
+  }
+
+  bigint_free_limbs(&d);
+  bigint_free_limbs(&u);
+  bigint_free_limbs(&v);
+  bigint_free_limbs(&qk);
+  bigint_free_limbs(&dm);
+  bigint_free_limbs(&qm);
+  bigint_free_limbs(&t);
+  return probable;
+}
+
+// Baillie-PSW followed by reps - BPSW_REPS Miller-Rabin rounds with
+// pseudo-random bases, for odd n past the trial division range.
+static int probable_prime_test(const bigint *n, int reps) {
+  Montgomery m = {BIGINT_ZERO, BIGINT_ZERO, 0, 0};
+  bigint n_minus_1 = BIGINT_ZERO, base = BIGINT_ZERO;
+  Limb one_limb = 1;
+  const bigint one = {&one_limb, 1, 1, false};
+
+  bigint_montgomery_init(n, &m);
+  bigint_sub(n, &one, &n_minus_1);
+  bigint_set_from_limb(2, &base);
+
+  bool probable = miller_rabin(&m, &n_minus_1, &base) && strong_lucas(&m, n);
+
+  Limb seed = n->limbs[0] ^ (Limb)n->len;
+  for (int i = BPSW_REPS; probable && i < reps; i++) {
+    // bases in [2, n - 2] from a xorshift stream seeded with n
+    base.len = 0;
+    bigint_resize(&base, n->len);
+    for (size_t j = 0; j < n->len; j++) {
+      seed ^= seed << (LIMB_SIZE_BITS / 4 + 1);
+      seed ^= seed >> (LIMB_SIZE_BITS / 8 + 3);
+      seed ^= seed << (LIMB_SIZE_BITS / 2 - 5);
+      base.limbs[j] = seed;
+    }
+    bigint_fit(&base);
+    bigint div_q = BIGINT_ZERO;
+    bigint_sub(&n_minus_1, &one, &n_minus_1);
+    bigint_sub(&n_minus_1, &one, &n_minus_1);
+    bigint_div(&base, &n_minus_1, &div_q, &base);
+    bigint_add(&n_minus_1, &one, &n_minus_1);
+    bigint_add(&n_minus_1, &one, &n_minus_1);
+    bigint_add(&base, &one, &base);
+    bigint_add(&base, &one, &base);
+    bigint_free_limbs(&div_q);
+    probable = miller_rabin(&m, &n_minus_1, &base);
+  }
+
+  bigint_free_limbs(&m.rrm);
+  bigint_free_limbs(&n_minus_1);
+  bigint_free_limbs(&base);
+  return probable ? 1 : 0;
+}
+
+// Returns 2 if n is definitely prime, 1 if it is probably prime and 0 if it
+// is composite. The sign of n is ignored.
+int bigint_probab_prime(const bigint *n, int reps) {
+  small_primes_ready();
+  if (n->len == 0 || (n->len == 1 && n->limbs[0] < 2)) {
+    return 0;
+  }
+  if (n->len == 1 && n->limbs[0] == 2) {
+    return 2;
+  }
+  if ((n->limbs[0] & 1) == 0) {
+    return 0;
+  }
+
+  bigint abs_n = *n;
+  abs_n.negative = false;
+  Limb residues[SMALL_PRIMES_MAX];
+  small_primes_residues(&abs_n, residues);
+  const bool small = n->len == 1 && n->limbs[0] < SMALL_PRIMES_LIMIT;
+  for (size_t i = 0; i < small_primes_len; i++) {
+    if (residues[i] == 0) {
+      return small && n->limbs[0] == small_primes[i] ? 2 : 0;
+    }
+  }
+  if (n->len == 1 && n->limbs[0] < (Limb)SMALL_PRIMES_LIMIT * SMALL_PRIMES_LIMIT) {
+    return 2;
+  }
+  return probable_prime_test(&abs_n, reps);
+}
+
+// Smallest prime > n. Odd candidates are sieved a window at a time with the
+// small primes, whose residues are carried from one window to the next.
+BigIntError bigint_next_prime(const bigint *n, bigint *result) {
+  small_primes_ready();
+  if (n->negative || n->len == 0 || (n->len == 1 && n->limbs[0] < 2)) {
+    return bigint_set_from_limb(2, result);
+  }
+  if (n->len == 1 && n->limbs[0] < small_primes[small_primes_len - 1]) {
+    for (size_t i = 0;; i++) {
+      if (small_primes[i] > n->limbs[0]) {
+        return bigint_set_from_limb(small_primes[i], result);
+      }
+    }
+  }
+
+  Limb one_limb = 1;
+  const bigint one = {&one_limb, 1, 1, false};
+  bigint candidate = BIGINT_ZERO, step = BIGINT_ZERO;
+  Limb residues[SMALL_PRIMES_MAX];
+  bool *composite = malloc(SIEVE_WINDOW * sizeof(*composite));
+  if (composite == NULL) {
+    return MemoryError;
+  }
+
+  // first odd number above n
+  bigint_add(n, &one, &candidate);
+  if ((candidate.limbs[0] & 1) == 0) {
+    bigint_add(&candidate, &one, &candidate);
+  }
+  bigint_set_from_limb(2, &step);
+  small_primes_residues(&candidate, residues);
+
+  for (bool found = false; !found;) {
+    memset(composite, 0, SIEVE_WINDOW * sizeof(*composite));
+    for (size_t i = 0; i < small_primes_len; i++) {
+      // candidate + 2 j = 0 (mod p) for j = -r / 2 (mod p)
+      const Limb p = small_primes[i];
+      const Limb first = (DoubleLimb)(p - residues[i]) % p * ((p + 1) / 2) % p;
+      for (size_t j = first; j < SIEVE_WINDOW; j += p) {
+        composite[j] = true;
+      }
+    }
+
+    size_t j = 0;
+    for (; j < SIEVE_WINDOW; j++) {
+      if (!composite[j] && probable_prime_test(&candidate, BPSW_REPS)) {
+        found = true;
+        break;
+      }
+      bigint_add(&candidate, &step, &candidate);
+    }
+
+    for (size_t i = 0; !found && i < small_primes_len; i++) {
+      residues[i] = (residues[i] + 2 * SIEVE_WINDOW) % small_primes[i];
+    }
+  }
+
+  BigIntError copy_result = bigint_copy(&candidate, result);
+  free(composite);
+  bigint_free_limbs(&candidate);
+  bigint_free_limbs(&step);
+  return copy_result;
+}
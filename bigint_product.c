@@ -0,0 +1,262 @@
+#include "bigint.h"
+#include <stdint.h>
+#include <stdlib.h>
+#ifdef BIGINT_THREADS
+#include <pthread.h>
+#endif
+
+// subtrees with fewer items are not worth a thread
+#define PRODUCT_THREAD_MIN 64
+
+static BigIntError product_range(const bigint *items[], size_t n, bigint *out,
+                                 size_t threads);
+
+#ifdef BIGINT_THREADS
+typedef struct product_job {
+  const bigint **items;
+  size_t n;
+  bigint *out;
+  size_t threads;
+  BigIntError result;
+} product_job;
+
+static void *product_worker(void *arg) {
+  product_job *job = arg;
+  job->result = product_range(job->items, job->n, job->out, job->threads);
+  return NULL;
+}
+#endif
+
+// Splits where the limbs on both sides balance rather than at n / 2, so a
+// few large items do not end up multiplied by a long tail of small ones.
+static size_t product_split(const bigint *items[], size_t n) {
+  size_t total = 0;
+  for (size_t i = 0; i < n; i++) {
+    total += items[i]->len;
+  }
+  size_t prefix = 0;
+  size_t split = 1;
+  for (; split < n - 1; split++) {
+    prefix += items[split - 1]->len;
+    if (2 * prefix >= total) {
+      break;
+    }
+  }
+  return split;
+}
+
+static BigIntError product_range(const bigint *items[], size_t n, bigint *out,
+                                 size_t threads) {
+  if (n == 0) {
+    return bigint_set_from_limb(1, out);
+  }
+  if (n == 1) {
+    return bigint_copy(items[0], out);
+  }
+  if (n == 2) {
+    return bigint_smul(items[0], items[1], out);
+  }
+
+  const size_t split = product_split(items, n);
+  bigint left = BIGINT_ZERO, right = BIGINT_ZERO;
+  BigIntError result = Ok;
+#ifdef BIGINT_THREADS
+  if (threads > 1 && n >= PRODUCT_THREAD_MIN) {
+    pthread_t id;
+    product_job job = {items, split, &left, threads / 2, Ok};
+    const bool threaded = pthread_create(&id, NULL, product_worker, &job) == 0;
+    if (!threaded) {
+      product_worker(&job);
+    }
+    result = product_range(items + split, n - split, &right,
+                           threads - threads / 2);
+    if (threaded) {
+      pthread_join(id, NULL);
+    }
+    if (result == Ok) {
+      result = job.result;
+    }
+  } else
+#endif
+  {
+    (void)threads;
+    result = product_range(items, split, &left, 1);
+    if (result == Ok) {
+      result = product_range(items + split, n - split, &right, 1);
+    }
+  }
+
+  if (result == Ok) {
+    result = bigint_smul(&left, &right, out);
+  }
+  bigint_free_limbs(&left);
+  bigint_free_limbs(&right);
+  return result;
+}
+
+BigIntError bigint_product(const bigint *items[], size_t n, bigint *out) {
+  return product_range(items, n, out, 1);
+}
+
+BigIntError bigint_product_parallel(const bigint *items[], size_t n,
+                                    bigint *out, size_t threads) {
+  return product_range(items, n, out, threads);
+}
+
+// Packs small factors into limb-sized products, the leaves of the tree. The
+// buffer starts at a bit-length estimate of the whole product and doubles
+// when the estimate falls short.
+typedef struct limb_factors {
+  Limb *limbs;
+  size_t len;
+  size_t capacity;
+  Limb acc;
+} limb_factors;
+
+static BigIntError limb_factors_init(limb_factors *f, size_t bits, Limb acc) {
+  *f = (limb_factors){NULL, 0, bits / LIMB_SIZE_BITS + 1, acc};
+  f->limbs = malloc(f->capacity * sizeof(Limb));
+  return f->limbs == NULL ? MemoryError : Ok;
+}
+
+static BigIntError limb_factors_flush(limb_factors *f) {
+  if (f->len == f->capacity) {
+    Limb *limbs = realloc(f->limbs, 2 * f->capacity * sizeof(Limb));
+    if (limbs == NULL) {
+      return MemoryError;
+    }
+    f->limbs = limbs;
+    f->capacity *= 2;
+  }
+  f->limbs[f->len++] = f->acc;
+  return Ok;
+}
+
+static BigIntError limb_factors_push(limb_factors *f, Limb x) {
+  const DoubleLimb product = (DoubleLimb)f->acc * x;
+  if (product >> LIMB_SIZE_BITS) {
+    const BigIntError result = limb_factors_flush(f);
+    f->acc = x;
+    return result;
+  }
+  f->acc = (Limb)product;
+  return Ok;
+}
+
+static BigIntError limb_factors_product(limb_factors *f, bigint *out) {
+  if (f->acc != 1) {
+    const BigIntError result = limb_factors_flush(f);
+    if (result != Ok) {
+      return result;
+    }
+  }
+  if (f->len == 0) {
+    return bigint_set_from_limb(1, out);
+  }
+  bigint *views = malloc(f->len * sizeof(*views));
+  const bigint **items = malloc(f->len * sizeof(*items));
+  BigIntError result = MemoryError;
+  if (views != NULL && items != NULL) {
+    for (size_t i = 0; i < f->len; i++) {
+      views[i] = (bigint){f->limbs + i, 0, 1, false};
+      items[i] = &views[i];
+    }
+    result = bigint_product(items, f->len, out);
+  }
+  free(views);
+  free(items);
+  return result;
+}
+
+// product of from, from + 1, ..., to
+static BigIntError product_sequence(Limb from, Limb to, bigint *out) {
+  if (from > to) {
+    return bigint_set_from_limb(1, out);
+  }
+  // every factor has at most the bits of to
+  size_t bits = 1;
+  while (bits < LIMB_SIZE_BITS && to >> bits) {
+    bits++;
+  }
+  const size_t count = (size_t)(to - from) + 1;
+  limb_factors f;
+  BigIntError result = limb_factors_init(
+      &f, count < SIZE_MAX / bits ? count * bits : SIZE_MAX, 1);
+  for (Limb x = from; result == Ok; x++) {
+    result = limb_factors_push(&f, x);
+    if (x == to) {
+      break;
+    }
+  }
+  if (result == Ok) {
+    result = limb_factors_product(&f, out);
+  }
+  free(f.limbs);
+  return result;
+}
+
+BigIntError bigint_fac_ui(Limb n, bigint *result) {
+  return product_sequence(2, n, result);
+}
+
+BigIntError bigint_bin_ui(Limb n, Limb k, bigint *result) {
+  if (k > n) {
+    return bigint_set_from_limb(0, result);
+  }
+  if (k > n - k) {
+    k = n - k;
+  }
+  if (k == 0) {
+    return bigint_set_from_limb(1, result);
+  }
+  bigint numerator = BIGINT_ZERO, denominator = BIGINT_ZERO,
+         r = BIGINT_ZERO;
+  BigIntError error = product_sequence(n - k + 1, n, &numerator);
+  if (error == Ok) {
+    error = product_sequence(2, k, &denominator);
+  }
+  if (error == Ok) {
+    error = bigint_div(&numerator, &denominator, result, &r);
+  }
+  bigint_free_limbs(&numerator);
+  bigint_free_limbs(&denominator);
+  bigint_free_limbs(&r);
+  return error;
+}
+
+// product of the primes <= n
+BigIntError bigint_primorial_ui(Limb n, bigint *result) {
+  if (n < 2) {
+    return bigint_set_from_limb(1, result);
+  }
+  // the sieve needs n + 1 flags
+  if (n >= SIZE_MAX) {
+    return MemoryError;
+  }
+  bool *composite = calloc((size_t)n + 1, sizeof(*composite));
+  // the primes up to n multiply to less than 2^(1.5 n)
+  const size_t half = (size_t)n / 2;
+  limb_factors f;
+  BigIntError error = limb_factors_init(
+      &f, half < (SIZE_MAX - 2) / 3 ? half * 3 + 2 : SIZE_MAX, 2);
+  if (composite == NULL) {
+    error = MemoryError;
+  }
+  if (error == Ok) {
+    for (Limb p = 3; error == Ok && p <= n && p != 0; p += 2) {
+      if (composite[p]) {
+        continue;
+      }
+      error = limb_factors_push(&f, p);
+      for (DoubleLimb j = (DoubleLimb)p * p; j <= n; j += 2 * p) {
+        composite[j] = true;
+      }
+    }
+  }
+  if (error == Ok) {
+    error = limb_factors_product(&f, result);
+  }
+  free(composite);
+  free(f.limbs);
+  return error;
+}
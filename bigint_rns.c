@@ -0,0 +1,420 @@
+#include "bigint.h"
+#include <stdlib.h>
+
+// Nodes below this many limbs are reduced with bigint_div, a reciprocal
+// only pays for itself once the products run through Karatsuba.
+#define BARRETT_MIN_LIMBS KARATSUBA_THRESHOLD
+
+// r = floor(2^(2k) / m) for m of k bits. The reciprocal of the top half of m,
+// scaled up, is one Newton step r (2 - m r / 2^(2k)) away from k bits of
+// precision, so a level costs a few multiplications and the whole
+// recursion O(M(k)). A final correction makes the result exact.
+static BigIntError reciprocal(const bigint *m, bigint *r) {
+  const size_t k = bigint_bit_length(m);
+  bigint t = BIGINT_ZERO, u = BIGINT_ZERO;
+  BigIntError result = Ok;
+  if (m->len < BARRETT_MIN_LIMBS) {
+    result = bigint_set_from_limb(1, &t);
+    if (result == Ok) {
+      result = bigint_bit_shiftl(&t, 2 * k, &t);
+    }
+    if (result == Ok) {
+      result = bigint_div(&t, m, r, &u);
+    }
+    bigint_free_limbs(&t);
+    bigint_free_limbs(&u);
+    return result;
+  }
+
+  const size_t h = k / 2 + 2;
+  result = bigint_bit_shiftr(m, k - h, &t);
+  if (result == Ok) {
+    result = reciprocal(&t, r);
+  }
+  if (result == Ok) {
+    result = bigint_bit_shiftl(r, k - h, r);
+  }
+  if (result == Ok) {
+    result = bigint_mul(r, r, &t);
+  }
+  if (result == Ok) {
+    result = bigint_mul(&t, m, &u);
+  }
+  if (result == Ok) {
+    result = bigint_bit_shiftr(&u, 2 * k, &u);
+  }
+  if (result == Ok) {
+    result = bigint_bit_shiftl(r, 1, &t);
+  }
+  if (result == Ok) {
+    result = bigint_ssub(&t, &u, r);
+  }
+
+  // e = 2^(2k) - m r, step r until 0 <= e < m
+  if (result == Ok) {
+    result = bigint_mul(m, r, &u);
+  }
+  if (result == Ok) {
+    result = bigint_set_from_limb(1, &t);
+  }
+  if (result == Ok) {
+    result = bigint_bit_shiftl(&t, 2 * k, &t);
+  }
+  if (result == Ok) {
+    result = bigint_ssub(&t, &u, &t);
+  }
+  bigint one = BIGINT_ZERO;
+  if (result == Ok) {
+    result = bigint_set_from_limb(1, &one);
+  }
+  while (result == Ok && t.negative) {
+    result = bigint_ssub(r, &one, r);
+    if (result == Ok) {
+      result = bigint_sadd(&t, m, &t);
+    }
+  }
+  while (result == Ok && !bigint_less_than(&t, m)) {
+    result = bigint_sadd(r, &one, r);
+    if (result == Ok) {
+      result = bigint_sub(&t, m, &t);
+    }
+  }
+  bigint_free_limbs(&one);
+  bigint_free_limbs(&t);
+  bigint_free_limbs(&u);
+  return result;
+}
+
+// r = x mod m with the reciprocal mu of m when 0 <= x < 2^(2k), with
+// bigint_div otherwise. The quotient estimate is at most 2 short.
+static BigIntError reduce(const bigint *x, const bigint *m, const bigint *mu,
+                          bigint *r) {
+  const size_t k = bigint_bit_length(m);
+  bigint q = BIGINT_ZERO, t = BIGINT_ZERO;
+  BigIntError result = Ok;
+  if (mu->len == 0 || x->negative || bigint_bit_length(x) > 2 * k) {
+    result = bigint_div(x, m, &q, r);
+    bigint_free_limbs(&q);
+    return result;
+  }
+  result = bigint_bit_shiftr(x, k - 1, &t);
+  if (result == Ok) {
+    result = bigint_mul(&t, mu, &q);
+  }
+  if (result == Ok) {
+    result = bigint_bit_shiftr(&q, k + 1, &q);
+  }
+  if (result == Ok) {
+    result = bigint_mul(&q, m, &t);
+  }
+  if (result == Ok) {
+    result = bigint_sub(x, &t, r);
+  }
+  while (result == Ok && !bigint_less_than(r, m)) {
+    result = bigint_sub(r, m, r);
+  }
+  bigint_free_limbs(&q);
+  bigint_free_limbs(&t);
+  return result;
+}
+
+// Nodes are stored in pre-order: a node covering n moduli is followed by its
+// left child covering n / 2 of them, the right child starts 2 (n / 2) later.
+static BigIntError tree_build(bigint *nodes, size_t idx, const bigint *moduli[],
+                              size_t n) {
+  if (n == 1) {
+    return bigint_copy(moduli[0], &nodes[idx]);
+  }
+  const size_t half = n / 2;
+  BigIntError result = tree_build(nodes, idx + 1, moduli, half);
+  if (result == Ok) {
+    result = tree_build(nodes, idx + 2 * half, moduli + half, n - half);
+  }
+  if (result == Ok) {
+    result = bigint_mul(&nodes[idx + 1], &nodes[idx + 2 * half], &nodes[idx]);
+  }
+  return result;
+}
+
+BigIntError bigint_subproduct_tree_init(const bigint *moduli[], size_t n,
+                                        bigint_subproduct_tree *tree) {
+  tree->n = n;
+  tree->nodes = NULL;
+  tree->reciprocals = NULL;
+  if (n == 0) {
+    return NotImplemented;
+  }
+  for (size_t i = 0; i < n; i++) {
+    if (moduli[i]->len == 0) {
+      return DivisionByZeroError;
+    }
+  }
+  tree->nodes = calloc(2 * n - 1, sizeof(*tree->nodes));
+  tree->reciprocals = calloc(2 * n - 1, sizeof(*tree->reciprocals));
+  if (tree->nodes == NULL || tree->reciprocals == NULL) {
+    bigint_subproduct_tree_free(tree);
+    return MemoryError;
+  }
+  BigIntError result = tree_build(tree->nodes, 0, moduli, n);
+  for (size_t i = 0; result == Ok && i < 2 * n - 1; i++) {
+    if (tree->nodes[i].len >= BARRETT_MIN_LIMBS) {
+      result = reciprocal(&tree->nodes[i], &tree->reciprocals[i]);
+    }
+  }
+  if (result != Ok) {
+    bigint_subproduct_tree_free(tree);
+  }
+  return result;
+}
+
+void bigint_subproduct_tree_free(bigint_subproduct_tree *tree) {
+  if (tree->nodes == NULL && tree->reciprocals == NULL) {
+    return;
+  }
+  for (size_t i = 0; i < 2 * tree->n - 1; i++) {
+    if (tree->nodes != NULL) {
+      bigint_free_limbs(&tree->nodes[i]);
+    }
+    if (tree->reciprocals != NULL) {
+      bigint_free_limbs(&tree->reciprocals[i]);
+    }
+  }
+  free(tree->nodes);
+  free(tree->reciprocals);
+  tree->nodes = NULL;
+  tree->reciprocals = NULL;
+}
+
+// x is already reduced modulo the node at idx, or its square when squared is
+// set. The squares only occur while setting up an RNS, their reciprocals are
+// computed on the way down. Leaves go to out as bigints or to limbs_out when
+// out is NULL.
+static BigIntError remainder_descend(const bigint_subproduct_tree *tree,
+                                     size_t idx, size_t n, const bigint *x,
+                                     bool squared, bigint *out[],
+                                     Limb *limbs_out) {
+  if (n == 1) {
+    if (out == NULL) {
+      limbs_out[0] = x->len ? x->limbs[0] : 0;
+      return Ok;
+    }
+    return bigint_copy(x, out[0]);
+  }
+
+  const size_t half = n / 2;
+  const size_t children[2] = {idx + 1, idx + 2 * half};
+  const size_t counts[2] = {half, n - half};
+  bigint r = BIGINT_ZERO, square = BIGINT_ZERO, square_mu = BIGINT_ZERO;
+  BigIntError result = Ok;
+  for (size_t c = 0; result == Ok && c < 2; c++) {
+    const bigint *modulus = &tree->nodes[children[c]];
+    const bigint *mu = &tree->reciprocals[children[c]];
+    if (squared) {
+      result = bigint_mul(modulus, modulus, &square);
+      square_mu.len = 0;
+      if (result == Ok && square.len >= BARRETT_MIN_LIMBS) {
+        result = reciprocal(&square, &square_mu);
+      }
+      modulus = &square;
+      mu = &square_mu;
+    }
+    const bigint *reduced = x;
+    if (result == Ok && !bigint_less_than(x, modulus)) {
+      result = reduce(x, modulus, mu, &r);
+      reduced = &r;
+    }
+    if (result == Ok) {
+      result = remainder_descend(tree, children[c], counts[c], reduced,
+                                 squared, out ? out + (c ? half : 0) : NULL,
+                                 out ? NULL : limbs_out + (c ? half : 0));
+    }
+  }
+  bigint_free_limbs(&r);
+  bigint_free_limbs(&square);
+  bigint_free_limbs(&square_mu);
+  return result;
+}
+
+static BigIntError remainder_tree(const bigint_subproduct_tree *tree,
+                                  const bigint *x, bigint *out[],
+                                  Limb *limbs_out) {
+  bigint q = BIGINT_ZERO, r = BIGINT_ZERO;
+  BigIntError result = Ok;
+  if (x->negative) {
+    result = bigint_sdiv(x, &tree->nodes[0], &q, &r, RoundFloor);
+  } else {
+    result = reduce(x, &tree->nodes[0], &tree->reciprocals[0], &r);
+  }
+  if (result == Ok) {
+    result = remainder_descend(tree, 0, tree->n, &r, false, out, limbs_out);
+  }
+  bigint_free_limbs(&q);
+  bigint_free_limbs(&r);
+  return result;
+}
+
+// out[i] = x mod m_i in [0, m_i). Every node keeps floor(2^(2k) / node), so
+// reducing a value by its children is two multiplications (Barrett) and
+// the descent costs O(M(n) log n).
+BigIntError bigint_remainder_tree(const bigint_subproduct_tree *tree,
+                                  const bigint *x, bigint *out[]) {
+  return remainder_tree(tree, x, out, NULL);
+}
+
+static Limb limb_invert(Limb a, Limb m, bool *invertible) {
+  SignedDoubleLimb r0 = m, r1 = a, s0 = 0, s1 = 1;
+  while (r1 != 0) {
+    const SignedDoubleLimb q = r0 / r1;
+    SignedDoubleLimb t = r0 - q * r1;
+    r0 = r1;
+    r1 = t;
+    t = s0 - q * s1;
+    s0 = s1;
+    s1 = t;
+  }
+  *invertible = r0 == 1;
+  return (Limb)(s0 < 0 ? s0 + (SignedDoubleLimb)m : s0);
+}
+
+// M mod m_i^2 = m_i ((M / m_i) mod m_i), the CRT weights are the inverses
+// of (M / m_i) mod m_i
+static BigIntError rns_weights(bigint_rns *rns) {
+  const size_t n = rns->n;
+  bigint *weights = calloc(n, sizeof(*weights));
+  bigint **weight_ptrs = malloc(n * sizeof(*weight_ptrs));
+  BigIntError result = weights && weight_ptrs ? Ok : MemoryError;
+  for (size_t i = 0; result == Ok && i < n; i++) {
+    weight_ptrs[i] = &weights[i];
+  }
+  if (result == Ok) {
+    result = remainder_descend(&rns->tree, 0, n, &rns->tree.nodes[0], true,
+                               weight_ptrs, NULL);
+  }
+  for (size_t i = 0; result == Ok && i < n; i++) {
+    bool invertible;
+    bigint_divrem_limb(&weights[i], rns->moduli[i], &weights[i], NULL);
+    rns->inverses[i] = limb_invert(weights[i].len ? weights[i].limbs[0] : 0,
+                                   rns->moduli[i], &invertible);
+    if (!invertible) {
+      result = NotInvertible;
+    }
+  }
+  for (size_t i = 0; weights != NULL && i < n; i++) {
+    bigint_free_limbs(&weights[i]);
+  }
+  free(weights);
+  free(weight_ptrs);
+  return result;
+}
+
+// moduli must be pairwise coprime, NotInvertible otherwise
+BigIntError bigint_rns_init(const Limb *moduli, size_t n, bigint_rns *rns) {
+  rns->n = n;
+  rns->moduli = malloc(n * sizeof(Limb) + 1);
+  rns->inverses = malloc(n * sizeof(Limb) + 1);
+  rns->tree.n = 0;
+  rns->tree.nodes = NULL;
+  rns->tree.reciprocals = NULL;
+  bigint *views = malloc(n * sizeof(*views) + 1);
+  const bigint **items = malloc(n * sizeof(*items) + 1);
+  BigIntError result = MemoryError;
+  if (rns->moduli != NULL && rns->inverses != NULL && views != NULL &&
+      items != NULL) {
+    for (size_t i = 0; i < n; i++) {
+      rns->moduli[i] = moduli[i];
+      views[i] = (bigint){rns->moduli + i, 1, 1, false};
+      bigint_fit(&views[i]);
+      items[i] = &views[i];
+    }
+    result = bigint_subproduct_tree_init(items, n, &rns->tree);
+  }
+  if (result == Ok) {
+    result = rns_weights(rns);
+  }
+  free(views);
+  free(items);
+  if (result != Ok) {
+    bigint_rns_free(rns);
+  }
+  return result;
+}
+
+void bigint_rns_free(bigint_rns *rns) {
+  free(rns->moduli);
+  free(rns->inverses);
+  rns->moduli = NULL;
+  rns->inverses = NULL;
+  bigint_subproduct_tree_free(&rns->tree);
+}
+
+BigIntError bigint_rns_from(const bigint_rns *rns, const bigint *x,
+                            Limb *residues) {
+  return remainder_tree(&rns->tree, x, NULL, residues);
+}
+
+// sum of v_i M / m_i, combined bottom-up: a node is left * right_product +
+// right * left_product
+static BigIntError crt_combine(const bigint *nodes, size_t idx, size_t n,
+                               const Limb *v, bigint *out) {
+  if (n == 1) {
+    return bigint_set_from_limb(v[0], out);
+  }
+  const size_t half = n / 2;
+  bigint left = BIGINT_ZERO, right = BIGINT_ZERO;
+  BigIntError result = crt_combine(nodes, idx + 1, half, v, &left);
+  if (result == Ok) {
+    result = crt_combine(nodes, idx + 2 * half, n - half, v + half, &right);
+  }
+  if (result == Ok) {
+    result = bigint_mul(&left, &nodes[idx + 2 * half], out);
+  }
+  if (result == Ok) {
+    result = bigint_addmul(out, &right, &nodes[idx + 1]);
+  }
+  bigint_free_limbs(&left);
+  bigint_free_limbs(&right);
+  return result;
+}
+
+// CRT reconstruction into [0, M)
+BigIntError bigint_rns_to(const bigint_rns *rns, const Limb *residues,
+                          bigint *result) {
+  Limb *v = malloc(rns->n * sizeof(*v));
+  if (v == NULL) {
+    return MemoryError;
+  }
+  for (size_t i = 0; i < rns->n; i++) {
+    v[i] = (DoubleLimb)residues[i] * rns->inverses[i] % rns->moduli[i];
+  }
+  bigint sum = BIGINT_ZERO;
+  BigIntError error = crt_combine(rns->tree.nodes, 0, rns->n, v, &sum);
+  if (error == Ok) {
+    error = reduce(&sum, &rns->tree.nodes[0], &rns->tree.reciprocals[0], result);
+  }
+  free(v);
+  bigint_free_limbs(&sum);
+  return error;
+}
+
+void bigint_rns_add(const bigint_rns *rns, const Limb *a, const Limb *b,
+                    Limb *out) {
+  for (size_t i = 0; i < rns->n; i++) {
+    const Limb m = rns->moduli[i];
+    const Limb s = a[i] + b[i];
+    out[i] = s < a[i] || s >= m ? s - m : s;
+  }
+}
+
+void bigint_rns_sub(const bigint_rns *rns, const Limb *a, const Limb *b,
+                    Limb *out) {
+  for (size_t i = 0; i < rns->n; i++) {
+    out[i] = a[i] >= b[i] ? a[i] - b[i] : a[i] - b[i] + rns->moduli[i];
+  }
+}
+
+void bigint_rns_mul(const bigint_rns *rns, const Limb *a, const Limb *b,
+                    Limb *out) {
+  for (size_t i = 0; i < rns->n; i++) {
+    out[i] = (DoubleLimb)a[i] * b[i] % rns->moduli[i];
+  }
+}
@@ -0,0 +1,242 @@
+#include "bigint.h"
+#include <stdlib.h>
+#ifdef BIGINT_THREADS
+#include <pthread.h>
+#endif
+
+// Residues that can be squares modulo 64, 63, 65 and 11 reject all but about
+// 1 / 100 of non-squares before a square root is computed.
+#define QR_PRODUCT (63 * 65 * 11)
+static bool qr_64[64], qr_63[63], qr_65[65], qr_11[11];
+
+static void qr_tables_init(void) {
+  for (size_t x = 0; x < 65; x++) {
+    qr_64[x * x % 64] = true;
+    qr_63[x * x % 63] = true;
+    qr_65[x * x % 65] = true;
+    qr_11[x * x % 11] = true;
+  }
+}
+
+static void qr_tables_ready(void) {
+#ifdef BIGINT_THREADS
+  static pthread_once_t once = PTHREAD_ONCE_INIT;
+  pthread_once(&once, qr_tables_init);
+#else
+  if (!qr_64[0]) {
+    qr_tables_init();
+  }
+#endif
+}
+
+static Limb limb_sqrt(Limb x) {
+  if (x == 0) {
+    return 0;
+  }
+  size_t bits = 0;
+  while (bits < LIMB_SIZE_BITS && (x >> bits) != 0) {
+    bits++;
+  }
+  Limb s = (Limb)1 << ((bits + 1) / 2);
+  for (;;) {
+    Limb y = (s + x / s) / 2;
+    if (y >= s) {
+      return s;
+    }
+    s = y;
+  }
+}
+
+// Zimmermann's Karatsuba square root. With a = a_h 2^2k + a_1 2^k + a_0
+// normalized so that a_h >= 2^(2k - 2), the root of a_h gives the top half
+// of the root and one division by 2 s' gives the bottom half.
+static void sqrt_rem(const bigint *a, bigint *s, bigint *r) {
+  const size_t bits = bigint_bit_length(a);
+  if (bits <= LIMB_SIZE_BITS) {
+    const Limb x = a->len ? a->limbs[0] : 0;
+    const Limb root = limb_sqrt(x);
+    bigint_set_from_limb(root, s);
+    bigint_set_from_limb(x - root * root, r);
+    return;
+  }
+
+  const size_t k = (bits + 3) / 4;
+  const size_t shift = (4 * k - bits) & ~(size_t)1;
+  bigint x = BIGINT_ZERO, high = BIGINT_ZERO, low = BIGINT_ZERO;
+  bigint a1 = BIGINT_ZERO, q = BIGINT_ZERO, u = BIGINT_ZERO;
+  bigint_bit_shiftl(a, shift, &x);
+
+  // low = a_1 2^k + a_0, a1 = a_1, then low = a_0
+  bigint_bit_shiftr(&x, 2 * k, &high);
+  bigint_bit_shiftl(&high, 2 * k, &low);
+  bigint_sub(&x, &low, &low);
+  bigint_bit_shiftr(&low, k, &a1);
+  bigint_bit_shiftl(&a1, k, &q);
+  bigint_sub(&low, &q, &low);
+
+  sqrt_rem(&high, s, r);
+
+  // q, u = (r' 2^k + a_1) / 2 s'
+  bigint_bit_shiftl(r, k, r);
+  bigint_add(r, &a1, r);
+  bigint_bit_shiftl(s, 1, &a1);
+  bigint_div(r, &a1, &q, &u);
+
+  // s = s' 2^k + q, r = u 2^k + a_0 - q^2
+  bigint_bit_shiftl(s, k, s);
+  bigint_add(s, &q, s);
+  bigint_bit_shiftl(&u, k, r);
+  bigint_add(r, &low, r);
+  bigint_mul(&q, &q, &u);
+  bigint_ssub(r, &u, r);
+  if (r->negative) {
+    // r += 2 s - 1, s -= 1
+    bigint_sadd(r, s, r);
+    bigint_sadd(r, s, r);
+    bigint_set_from_limb(1, &u);
+    bigint_ssub(r, &u, r);
+    bigint_sub(s, &u, s);
+  }
+
+  if (shift != 0) {
+    bigint_bit_shiftr(s, shift / 2, s);
+    bigint_mul(s, s, &u);
+    bigint_sub(a, &u, r);
+  }
+
+  bigint_free_limbs(&x);
+  bigint_free_limbs(&high);
+  bigint_free_limbs(&low);
+  bigint_free_limbs(&a1);
+  bigint_free_limbs(&q);
+  bigint_free_limbs(&u);
+}
+
+// s = floor(sqrt(a)), r = a - s^2, r may be NULL.
+BigIntError bigint_sqrt_rem(const bigint *a, bigint *s, bigint *r) {
+  if (a->negative) {
+    return NotImplemented;
+  }
+  bigint root = BIGINT_ZERO, rem = BIGINT_ZERO;
+  sqrt_rem(a, &root, &rem);
+  BigIntError result = bigint_copy(&root, s);
+  if (result == Ok && r != NULL) {
+    result = bigint_copy(&rem, r);
+  }
+  bigint_free_limbs(&root);
+  bigint_free_limbs(&rem);
+  return result;
+}
+
+static void bigint_pow_size(const bigint *a, size_t e, bigint *result) {
+  bigint base = BIGINT_ZERO;
+  bigint_copy(a, &base);
+  bigint_set_from_limb(1, result);
+  for (; e != 0; e >>= 1) {
+    if (e & 1) {
+      bigint_mul(result, &base, result);
+    }
+    if (e > 1) {
+      bigint_mul(&base, &base, &base);
+    }
+  }
+  bigint_free_limbs(&base);
+}
+
+static void bigint_set_from_size(size_t x, bigint *result) {
+  result->len = 0;
+  for (size_t i = 0; x != 0; i++) {
+    bigint_resize(result, i + 1);
+    result->limbs[i] = (Limb)x;
+    x = x >> (LIMB_SIZE_BITS - 1) >> 1;
+  }
+  result->negative = false;
+}
+
+// result = floor(a^(1/k)), truncated towards zero for negative a and odd k.
+// Newton's iteration x = ((k - 1) x + a / x^(k - 1)) / k decreases
+// monotonically from 2^ceil(bits / k) down to the root.
+BigIntError bigint_root(const bigint *a, size_t k, bigint *result) {
+  if (k == 0 || (a->negative && k % 2 == 0)) {
+    return NotImplemented;
+  }
+  if (k == 1) {
+    return bigint_copy(a, result);
+  }
+  const bool negative = a->negative;
+  const size_t bits = bigint_bit_length(a);
+  bigint abs_a = *a;
+  abs_a.negative = false;
+  BigIntError error = Ok;
+
+  if (k == 2) {
+    error = bigint_sqrt_rem(&abs_a, result, NULL);
+  } else if (k >= bits) {
+    error = bigint_set_from_limb(bits != 0, result);
+  } else {
+    bigint x = BIGINT_ZERO, y = BIGINT_ZERO, t = BIGINT_ZERO;
+    bigint q = BIGINT_ZERO, rem = BIGINT_ZERO, big_k = BIGINT_ZERO;
+    bigint_set_from_size(k, &big_k);
+    bigint_set_from_limb(1, &x);
+    bigint_bit_shiftl(&x, (bits + k - 1) / k, &x);
+    for (;;) {
+      bigint_pow_size(&x, k - 1, &t);
+      bigint_div(&abs_a, &t, &q, &rem);
+      bigint_set_from_size(k - 1, &t);
+      bigint_mul(&x, &t, &y);
+      bigint_add(&y, &q, &y);
+      bigint_div(&y, &big_k, &y, &rem);
+      if (bigint_cmp(&y, &x) >= 0) {
+        break;
+      }
+      bigint_copy(&y, &x);
+    }
+    error = bigint_copy(&x, result);
+    bigint_free_limbs(&x);
+    bigint_free_limbs(&y);
+    bigint_free_limbs(&t);
+    bigint_free_limbs(&q);
+    bigint_free_limbs(&rem);
+    bigint_free_limbs(&big_k);
+  }
+
+  if (error == Ok && negative) {
+    error = bigint_neg(result, result);
+  }
+  return error;
+}
+
+bool bigint_perfect_square(const bigint *a) {
+  qr_tables_ready();
+  if (a->negative) {
+    return false;
+  }
+  if (a->len == 0) {
+    return true;
+  }
+  if (!qr_64[a->limbs[0] % 64]) {
+    return false;
+  }
+  Limb r63, r65, r11;
+  if ((DoubleLimb)QR_PRODUCT <= (Limb)~(Limb)0) {
+    Limb r;
+    bigint_divrem_limb(a, (Limb)QR_PRODUCT, NULL, &r);
+    r63 = r % 63;
+    r65 = r % 65;
+    r11 = r % 11;
+  } else {
+    bigint_divrem_limb(a, 63, NULL, &r63);
+    bigint_divrem_limb(a, 65, NULL, &r65);
+    bigint_divrem_limb(a, 11, NULL, &r11);
+  }
+  if (!qr_63[r63] || !qr_65[r65] || !qr_11[r11]) {
+    return false;
+  }
+
+  bigint s = BIGINT_ZERO, r = BIGINT_ZERO;
+  sqrt_rem(a, &s, &r);
+  const bool square = r.len == 0;
+  bigint_free_limbs(&s);
+  bigint_free_limbs(&r);
+  return square;
+}
@@ -0,0 +1,168 @@
+#include "bigint.h"
+#include <string.h>
+
+#define SPECIAL_MIN_FOLD_BITS 32
+
+static void bigint_low_bits(const bigint *a, size_t bits, bigint *result) {
+  const size_t limbs = (bits + LIMB_SIZE_BITS - 1) / LIMB_SIZE_BITS;
+  const size_t len = a->len < limbs ? a->len : limbs;
+  if (result != a) {
+    bigint_resize(result, len);
+    memcpy(result->limbs, a->limbs, len * LIMB_SIZE_BYTES);
+  }
+  result->len = len;
+  if (len == limbs && bits % LIMB_SIZE_BITS != 0) {
+    result->limbs[len - 1] &= ((Limb)1 << (bits % LIMB_SIZE_BITS)) - 1;
+  }
+  bigint_fit(result);
+}
+
+// Non-adjacent form of c, returns false when it has more than
+// SOLINAS_MAX_TERMS non-zero digits.
+static bool special_solinas_terms(const bigint *c, SpecialModulus *m) {
+  bigint x = BIGINT_ZERO;
+  Limb one_limb = 1;
+  const bigint one = {&one_limb, 1, 1, false};
+  bigint_copy(c, &x);
+  x.negative = false;
+
+  m->terms = 0;
+  for (size_t shift = 0; x.len > 0; shift++) {
+    if (x.limbs[0] & 1) {
+      if (m->terms == SOLINAS_MAX_TERMS) {
+        bigint_free_limbs(&x);
+        return false;
+      }
+      // digit 1 when x = 1 (mod 4), -1 when x = 3 (mod 4)
+      const bool negative_digit = (x.limbs[0] & 3) == 3;
+      if (negative_digit) {
+        bigint_add(&x, &one, &x);
+      } else {
+        bigint_sub(&x, &one, &x);
+      }
+      m->shifts[m->terms] = shift;
+      m->negative_terms[m->terms] = negative_digit != c->negative;
+      m->terms++;
+    }
+    bigint_bit_shiftr(&x, 1, &x);
+  }
+  bigint_free_limbs(&x);
+  return true;
+}
+
+static BigIntError special_setup(size_t k, const bigint *c, SpecialModulus *m) {
+  m->n = k;
+  m->modulus = BIGINT_ZERO;
+  m->rrm = BIGINT_ZERO;
+  m->c = BIGINT_ZERO;
+  bigint_copy(c, &m->c);
+
+  bigint_set_from_limb(1, &m->modulus);
+  bigint_bit_shiftl(&m->modulus, k, &m->modulus);
+  bigint_ssub(&m->modulus, c, &m->modulus);
+  // R = 1, so code that converts with rrm like for Montgomery still works
+  bigint_set_from_limb(1, &m->rrm);
+
+  if (!c->negative && c->len == 1 && c->limbs[0] == 1) {
+    m->form = SpecialMersenne;
+  } else if (!c->negative && c->len == 1) {
+    m->form = SpecialPseudoMersenne;
+  } else if (special_solinas_terms(c, m)) {
+    m->form = SpecialSolinas;
+  } else {
+    m->form = SpecialGeneric;
+  }
+  return Ok;
+}
+
+BigIntError bigint_special_init(const bigint *modulus, SpecialModulus *m) {
+  const size_t k = bigint_bit_length(modulus);
+  if (k < 2 || modulus->negative) {
+    return NotImplemented;
+  }
+
+  bigint c = BIGINT_ZERO;
+  bigint_set_from_limb(1, &c);
+  bigint_bit_shiftl(&c, k, &c);
+  bigint_sub(&c, modulus, &c);
+
+  // a small c, or a c with few signed terms like the NIST primes, as long as
+  // each fold of the reduction still drops SPECIAL_MIN_FOLD_BITS
+  const size_t c_bits = bigint_bit_length(&c);
+  BigIntError result = NotImplemented;
+  if (c_bits <= k / 2 || (c_bits + SPECIAL_MIN_FOLD_BITS <= k &&
+                          special_solinas_terms(&c, m))) {
+    result = special_setup(k, &c, m);
+  }
+  bigint_free_limbs(&c);
+  return result;
+}
+
+BigIntError bigint_special_init_form(size_t k, const bigint *c,
+                                     SpecialModulus *m) {
+  if (k < 2 || c->len == 0 || bigint_bit_length(c) >= k) {
+    return NotImplemented;
+  }
+  return special_setup(k, c, m);
+}
+
+// Folds a = hi 2^k + lo into lo + hi c until it fits in k bits, then
+// corrects into [0, m) with a few additions or subtractions of m.
+BigIntError bigint_special_reduce(const SpecialModulus *m, const bigint *a,
+                                  bigint *result) {
+  bigint x = BIGINT_ZERO, hi = BIGINT_ZERO, term = BIGINT_ZERO;
+  bigint_copy(a, &x);
+
+  while (bigint_bit_length(&x) > m->n) {
+    const bool negative = x.negative;
+    bigint_bit_shiftr(&x, m->n, &hi);
+    bigint_low_bits(&x, m->n, &x);
+    switch (m->form) {
+    case SpecialMersenne:
+      bigint_add(&x, &hi, &x);
+      break;
+    case SpecialPseudoMersenne:
+      bigint_addmul_limb(&x, &hi, m->c.limbs[0]);
+      break;
+    case SpecialSolinas:
+      for (size_t i = 0; i < m->terms; i++) {
+        bigint_bit_shiftl(&hi, m->shifts[i], &term);
+        term.negative = m->negative_terms[i] && term.len > 0;
+        bigint_sadd(&x, &term, &x);
+      }
+      break;
+    case SpecialGeneric:
+      bigint_smul(&hi, &m->c, &term);
+      bigint_sadd(&x, &term, &x);
+      break;
+    }
+    if (negative) {
+      bigint_neg(&x, &x);
+    }
+  }
+
+  while (x.negative) {
+    bigint_sadd(&x, &m->modulus, &x);
+  }
+  while (bigint_cmp(&x, &m->modulus) >= 0) {
+    bigint_sub(&x, &m->modulus, &x);
+  }
+
+  BigIntError copy_result = bigint_copy(&x, result);
+  bigint_free_limbs(&x);
+  bigint_free_limbs(&hi);
+  bigint_free_limbs(&term);
+  return copy_result;
+}
+
+BigIntError bigint_special_mul(const SpecialModulus *m, const bigint *r1,
+                               const bigint *r2, bigint *result) {
+  bigint_mul(r1, r2, result);
+  return bigint_special_reduce(m, result, result);
+}
+
+void bigint_special_free(SpecialModulus *m) {
+  bigint_free_limbs(&m->modulus);
+  bigint_free_limbs(&m->rrm);
+  bigint_free_limbs(&m->c);
+}
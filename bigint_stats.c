@@ -0,0 +1,179 @@
+#define _POSIX_C_SOURCE 199309L
+#include "bigint.h"
+#include "bigint_stats.h"
+#include <string.h>
+#include <time.h>
+#ifdef BIGINT_THREADS
+#include <pthread.h>
+#endif
+
+const char *BigIntStatsOpNames[] = {
+    "mul_classic", "mul_comba",         "mul_karatsuba",   "div",
+    "div_limb",    "montgomery_reduce", "montgomery_mul",
+};
+
+#ifdef BIGINT_STATS
+#define STATS_FIELDS (sizeof(bigint_stats) / sizeof(uint64_t))
+
+typedef struct stats_block {
+  bigint_stats stats;
+  size_t karatsuba_depth;
+  struct stats_block *next;
+  struct stats_block *prev;
+} stats_block;
+
+static uint64_t stats_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// only the owning thread writes its block, relaxed accesses keep the readers
+// in bigint_stats_snapshot well defined without a locked add
+void bigint_stats_add(uint64_t *counter, uint64_t n) {
+  __atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + n,
+                   __ATOMIC_RELAXED);
+}
+
+// the counters viewed as an array, every field is a uint64_t
+static void stats_accumulate(const bigint_stats *from, bigint_stats *to) {
+  const uint64_t *src = (const uint64_t *)from;
+  uint64_t *dst = (uint64_t *)to;
+  for (size_t i = 0; i < STATS_FIELDS; i++) {
+    const uint64_t value = __atomic_load_n(&src[i], __ATOMIC_RELAXED);
+    if (&src[i] == &from->karatsuba_max_depth) {
+      dst[i] = value > dst[i] ? value : dst[i];
+    } else {
+      dst[i] += value;
+    }
+  }
+}
+
+static void stats_clear(bigint_stats *stats) {
+  uint64_t *fields = (uint64_t *)stats;
+  for (size_t i = 0; i < STATS_FIELDS; i++) {
+    __atomic_store_n(&fields[i], 0, __ATOMIC_RELAXED);
+  }
+}
+
+#ifdef BIGINT_THREADS
+// Live blocks are linked under stats_lock, a thread's block is folded into
+// stats_retired by the key destructor when the thread exits.
+static __thread stats_block stats_thread_block;
+static __thread bool stats_registered;
+static stats_block *stats_threads;
+static bigint_stats stats_retired;
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t stats_key;
+static pthread_once_t stats_key_once = PTHREAD_ONCE_INIT;
+
+static void stats_thread_exit(void *block) {
+  stats_block *b = block;
+  pthread_mutex_lock(&stats_lock);
+  stats_accumulate(&b->stats, &stats_retired);
+  if (b->prev != NULL) {
+    b->prev->next = b->next;
+  } else {
+    stats_threads = b->next;
+  }
+  if (b->next != NULL) {
+    b->next->prev = b->prev;
+  }
+  pthread_mutex_unlock(&stats_lock);
+}
+
+static void stats_key_init(void) {
+  pthread_key_create(&stats_key, stats_thread_exit);
+}
+
+static stats_block *stats_local_block(void) {
+  stats_block *b = &stats_thread_block;
+  if (!stats_registered) {
+    stats_registered = true;
+    pthread_once(&stats_key_once, stats_key_init);
+    pthread_mutex_lock(&stats_lock);
+    b->next = stats_threads;
+    if (stats_threads != NULL) {
+      stats_threads->prev = b;
+    }
+    stats_threads = b;
+    pthread_mutex_unlock(&stats_lock);
+    pthread_setspecific(stats_key, b);
+  }
+  return b;
+}
+#else
+static stats_block stats_single_block;
+
+static stats_block *stats_local_block(void) { return &stats_single_block; }
+#endif
+
+bigint_stats *bigint_stats_local(void) { return &stats_local_block()->stats; }
+
+bigint_stats_timer bigint_stats_start(BigIntStatsOp op, size_t limbs) {
+  stats_block *b = stats_local_block();
+  bigint_stats_op *s = &b->stats.ops[op];
+  size_t bucket = 0;
+  while (limbs != 0 && bucket < BIGINT_STATS_SIZE_BUCKETS - 1) {
+    limbs >>= 1;
+    bucket++;
+  }
+  bigint_stats_add(&s->calls, 1);
+  bigint_stats_add(&s->sizes[bucket], 1);
+  if (op == StatsMulKaratsuba) {
+    b->karatsuba_depth++;
+    if (b->karatsuba_depth >
+        __atomic_load_n(&b->stats.karatsuba_max_depth, __ATOMIC_RELAXED)) {
+      __atomic_store_n(&b->stats.karatsuba_max_depth, b->karatsuba_depth,
+                       __ATOMIC_RELAXED);
+    }
+  }
+  bigint_stats_timer timer = {op, stats_now()};
+  return timer;
+}
+
+void bigint_stats_stop(bigint_stats_timer timer) {
+  stats_block *b = stats_local_block();
+  if (timer.op == StatsMulKaratsuba && --b->karatsuba_depth != 0) {
+    return;
+  }
+  bigint_stats_add(&b->stats.ops[timer.op].ns, stats_now() - timer.start);
+}
+
+BigIntError bigint_stats_snapshot(bigint_stats *out) {
+  memset(out, 0, sizeof(*out));
+#ifdef BIGINT_THREADS
+  pthread_mutex_lock(&stats_lock);
+  stats_accumulate(&stats_retired, out);
+  for (const stats_block *b = stats_threads; b != NULL; b = b->next) {
+    stats_accumulate(&b->stats, out);
+  }
+  pthread_mutex_unlock(&stats_lock);
+#else
+  stats_accumulate(&stats_single_block.stats, out);
+#endif
+  return Ok;
+}
+
+// counts racing with the reset may survive it
+BigIntError bigint_stats_reset(void) {
+#ifdef BIGINT_THREADS
+  pthread_mutex_lock(&stats_lock);
+  stats_clear(&stats_retired);
+  for (stats_block *b = stats_threads; b != NULL; b = b->next) {
+    stats_clear(&b->stats);
+  }
+  pthread_mutex_unlock(&stats_lock);
+#else
+  stats_clear(&stats_single_block.stats);
+#endif
+  return Ok;
+}
+#else
+BigIntError bigint_stats_snapshot(bigint_stats *out) {
+  memset(out, 0, sizeof(*out));
+  return NotImplemented;
+}
+
+BigIntError bigint_stats_reset(void) { return NotImplemented; }
+#endif
@@ -0,0 +1,25 @@
+// Instrumentation hooks, compiled out unless BIGINT_STATS is defined.
+//
+//   STATS_START(timer, StatsDiv, a->len);
+//   ... the operation ...
+//   STATS_STOP(timer);
+#ifdef BIGINT_STATS
+typedef struct bigint_stats_timer {
+  BigIntStatsOp op;
+  uint64_t start;
+} bigint_stats_timer;
+
+bigint_stats *bigint_stats_local(void);
+void bigint_stats_add(uint64_t *counter, uint64_t n);
+bigint_stats_timer bigint_stats_start(BigIntStatsOp op, size_t limbs);
+void bigint_stats_stop(bigint_stats_timer timer);
+
+#define STATS_ADD(field, n) bigint_stats_add(&bigint_stats_local()->field, n)
+#define STATS_START(timer, op, limbs)                                          \
+  const bigint_stats_timer timer = bigint_stats_start(op, limbs)
+#define STATS_STOP(timer) bigint_stats_stop(timer)
+#else
+#define STATS_ADD(field, n) ((void)0)
+#define STATS_START(timer, op, limbs) ((void)0)
+#define STATS_STOP(timer) ((void)0)
+#endif
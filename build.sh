@@ -1 +1,16 @@
-cc -shared -fPIC -Wall -Wextra -Werror -pedantic -std=c99 -g bigint.c bigint_mul.c utils.c -o bigint.so
\ No newline at end of file
+SOURCES="bigint.c bigint_comba.c bigint_mul.c bigint_gcd.c bigint_montgomery.c bigint_special.c bigint_prime.c bigint_root.c bigint_product.c bigint_rns.c bigint_fixed.c bigint_stats.c bigint_file.c bigint_lanes.c utils.c"
+# native as the first or second argument compiles for this machine's
+# instruction set, which is what turns on the AVX2/AVX-512 lanes
+NATIVE=""
+if [ "$1" = "native" ] || [ "$2" = "native" ]; then
+  NATIVE="-O2 -march=native"
+fi
+if [ "$1" = "bench" ]; then
+  cc -O2 $NATIVE -pthread -DBIGINT_THREADS -Wall -Wextra -Werror -pedantic -std=c99 -g bench.c $SOURCES -o bench
+  exit
+fi
+FLAGS=""
+if [ "$1" = "stats" ]; then
+  FLAGS="-DBIGINT_STATS"
+fi
+cc -shared -fPIC -pthread -DBIGINT_THREADS $FLAGS $NATIVE -Wall -Wextra -Werror -pedantic -std=c99 -g $SOURCES -o bigint.so
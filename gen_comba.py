@@ -0,0 +1,194 @@
+# Generates bigint_comba.h, bigint_comba_kernels.h and bigint_comba.c:
+# straight-line comba multiplication, squaring and Montgomery multiplication
+# for 1..MAX_LIMBS limbs. The kernels are static inline in
+# bigint_comba_kernels.h so fixed width code can call them directly, while
+# bigint_comba.c builds the tables indexed by limb count for callers that only
+# know the length at run time.
+#
+#   python gen_comba.py
+
+MAX_LIMBS = 16
+
+HEADER = """\
+// Generated by gen_comba.py, do not edit.
+#ifndef BIGINT_COMBA_H
+#define BIGINT_COMBA_H
+#define COMBA_MAX_LIMBS {max_limbs}
+typedef void (*bigint_comba_mul_fn)(Limb *r, const Limb *a, const Limb *b);
+typedef void (*bigint_comba_sqr_fn)(Limb *r, const Limb *a);
+typedef void (*bigint_comba_mont_fn)(Limb *r, const Limb *a, const Limb *b,
+                                     const Limb *m, Limb minv);
+extern const bigint_comba_mul_fn bigint_comba_mul[COMBA_MAX_LIMBS + 1];
+extern const bigint_comba_sqr_fn bigint_comba_sqr[COMBA_MAX_LIMBS + 1];
+extern const bigint_comba_mont_fn bigint_comba_mont[COMBA_MAX_LIMBS + 1];
+#endif
+"""
+
+KERNELS_HEADER = """\
+// Generated by gen_comba.py, do not edit.
+#ifndef BIGINT_COMBA_KERNELS_H
+#define BIGINT_COMBA_KERNELS_H
+#include "bigint.h"
+#include "bigint_comba.h"
+
+// (c2, c1, c0) is a three limb column accumulator
+#define COMBA_ADD(p)                                                           \\
+  do {                                                                         \\
+    DoubleLimb s_ = (DoubleLimb)c0 + (Limb)(p);                                \\
+    c0 = (Limb)s_;                                                             \\
+    s_ = (DoubleLimb)c1 + (Limb)((p) >> LIMB_SIZE_BITS) +                      \\
+         (s_ >> LIMB_SIZE_BITS);                                               \\
+    c1 = (Limb)s_;                                                             \\
+    c2 += (Limb)(s_ >> LIMB_SIZE_BITS);                                        \\
+  } while (0)
+
+#define COMBA_MULADD(x, y)                                                     \\
+  do {                                                                         \\
+    const DoubleLimb p_ = (DoubleLimb)(x) * (y);                               \\
+    COMBA_ADD(p_);                                                             \\
+  } while (0)
+
+#define COMBA_MULADD2(x, y)                                                    \\
+  do {                                                                         \\
+    const DoubleLimb p_ = (DoubleLimb)(x) * (y);                               \\
+    COMBA_ADD(p_);                                                             \\
+    COMBA_ADD(p_);                                                             \\
+  } while (0)
+
+#define COMBA_SHIFT()                                                          \\
+  do {                                                                         \\
+    c0 = c1;                                                                   \\
+    c1 = c2;                                                                   \\
+    c2 = 0;                                                                    \\
+  } while (0)
+
+// r = t - m if t >= m else t, where t has n + 1 limbs and t < 2 m
+static inline void bigint_comba_mont_finish(Limb *r, const Limb *t,
+                                            const Limb *m, size_t n) {
+  Limb d[COMBA_MAX_LIMBS];
+  Limb borrow = 0;
+  for (size_t i = 0; i < n; i++) {
+    const Limb x = t[i] - m[i];
+    const Limb y = x - borrow;
+    borrow = (t[i] < m[i]) | (x < borrow);
+    d[i] = y;
+  }
+  const bool subtract = t[n] >= borrow;
+  for (size_t i = 0; i < n; i++) {
+    r[i] = subtract ? d[i] : t[i];
+  }
+}
+"""
+
+SOURCE = """\
+// Generated by gen_comba.py, do not edit.
+#include "bigint.h"
+#include "bigint_comba.h"
+#include "bigint_comba_kernels.h"
+"""
+
+
+def mul_kernel(n):
+    lines = [f"static inline void bigint_comba_mul_{n}(Limb *r, const Limb *a,",
+             "                                      const Limb *b) {",
+             "  Limb c0 = 0, c1 = 0, c2 = 0;"]
+    for k in range(2 * n - 1):
+        for i in range(max(0, k - n + 1), min(k, n - 1) + 1):
+            lines.append(f"  COMBA_MULADD(a[{i}], b[{k - i}]);")
+        lines.append(f"  r[{k}] = c0;")
+        lines.append("  COMBA_SHIFT();")
+    lines.append(f"  r[{2 * n - 1}] = c0;")
+    lines.append("}")
+    return "\n".join(lines)
+
+
+def sqr_kernel(n):
+    lines = [f"static inline void bigint_comba_sqr_{n}(Limb *r, const Limb *a) {{",
+             "  Limb c0 = 0, c1 = 0, c2 = 0;"]
+    for k in range(2 * n - 1):
+        for i in range(max(0, k - n + 1), (k + 1) // 2):
+            lines.append(f"  COMBA_MULADD2(a[{i}], a[{k - i}]);")
+        if k % 2 == 0:
+            lines.append(f"  COMBA_MULADD(a[{k // 2}], a[{k // 2}]);")
+        lines.append(f"  r[{k}] = c0;")
+        lines.append("  COMBA_SHIFT();")
+    lines.append(f"  r[{2 * n - 1}] = c0;")
+    lines.append("}")
+    return "\n".join(lines)
+
+
+# Product scanning Montgomery multiplication (Koc, Acar and Kaliski's FIPS):
+# column i of a b + q m is completed before q[i] is chosen to clear it.
+def mont_kernel(n):
+    lines = [f"static inline void bigint_comba_mont_{n}(Limb *r, const Limb *a,",
+             "                                       const Limb *b, const Limb *m,",
+             "                                       Limb minv) {",
+             "  Limb c0 = 0, c1 = 0, c2 = 0;",
+             f"  Limb q[{n}], t[{n + 1}];"]
+    for i in range(n):
+        for j in range(i):
+            lines.append(f"  COMBA_MULADD(a[{j}], b[{i - j}]);")
+            lines.append(f"  COMBA_MULADD(q[{j}], m[{i - j}]);")
+        lines.append(f"  COMBA_MULADD(a[{i}], b[0]);")
+        lines.append(f"  q[{i}] = c0 * minv;")
+        lines.append(f"  COMBA_MULADD(q[{i}], m[0]);")
+        lines.append("  COMBA_SHIFT();")
+    for i in range(n, 2 * n):
+        for j in range(i - n + 1, n):
+            lines.append(f"  COMBA_MULADD(a[{j}], b[{i - j}]);")
+            lines.append(f"  COMBA_MULADD(q[{j}], m[{i - j}]);")
+        lines.append(f"  t[{i - n}] = c0;")
+        lines.append("  COMBA_SHIFT();")
+    lines.append(f"  t[{n}] = c0;")
+    lines.append(f"  bigint_comba_mont_finish(r, t, m, {n});")
+    lines.append("}")
+    return "\n".join(lines)
+
+
+# Direct dispatch for 1 <= n <= COMBA_MAX_LIMBS. With a constant n the switch
+# folds away and the kernel is called (or inlined) without the tables.
+def dispatch(kind, params, args):
+    lines = [f"static inline void bigint_comba_{kind}_n({params}, size_t n) {{",
+             "  switch (n) {"]
+    for n in range(1, MAX_LIMBS + 1):
+        lines.append(f"  case {n}:")
+        lines.append(f"    bigint_comba_{kind}_{n}({args});")
+        lines.append("    return;")
+    lines.append("  }")
+    lines.append("}")
+    return "\n".join(lines)
+
+
+def table(kind, fn_type):
+    entries = ",\n".join(f"    bigint_comba_{kind}_{n}"
+                         for n in range(1, MAX_LIMBS + 1))
+    return (f"const {fn_type} bigint_comba_{kind}[COMBA_MAX_LIMBS + 1] = {{\n"
+            f"    NULL,\n{entries},\n}};")
+
+
+def main():
+    with open("bigint_comba.h", "w") as f:
+        f.write(HEADER.format(max_limbs=MAX_LIMBS))
+
+    parts = [KERNELS_HEADER]
+    for n in range(1, MAX_LIMBS + 1):
+        parts += [mul_kernel(n), sqr_kernel(n), mont_kernel(n)]
+    parts += [dispatch("mul", "Limb *r, const Limb *a,\n"
+                       "                                      const Limb *b", "r, a, b"),
+              dispatch("sqr", "Limb *r, const Limb *a", "r, a"),
+              dispatch("mont", "Limb *r, const Limb *a, const Limb *b,\n"
+                       "                                       const Limb *m, "
+                       "Limb minv", "r, a, b, m, minv")]
+    with open("bigint_comba_kernels.h", "w") as f:
+        f.write("\n\n".join(parts) + "\n#endif\n")
+
+    parts = [SOURCE.rstrip("\n"),
+             table("mul", "bigint_comba_mul_fn"),
+             table("sqr", "bigint_comba_sqr_fn"),
+             table("mont", "bigint_comba_mont_fn")]
+    with open("bigint_comba.c", "w") as f:
+        f.write("\n\n".join(parts) + "\n")
+
+
+if __name__ == "__main__":
+    main()
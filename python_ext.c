@@ -0,0 +1,546 @@
+// The bigint_ext CPython extension module, python setup.py build_ext --inplace
+//
+// Python ints are converted by copying their magnitude bytes straight into
+// the limbs (limbs are little-endian, so on little-endian hosts the bytes
+// are the limbs). Objects supporting the buffer protocol (bytes, bytearray,
+// numpy arrays) are read as little-endian unsigned magnitudes. The GIL is
+// released around calls on operands of EXT_GIL_LIMBS limbs or more and around
+// the whole compute loop of the batched functions.
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include "bigint.h"
+
+#define EXT_GIL_LIMBS 16
+
+#if PY_VERSION_HEX >= 0x030D0000
+#define EXT_AS_BYTE_ARRAY(v, bytes, n) _PyLong_AsByteArray(v, bytes, n, 1, 0, 1)
+#else
+#define EXT_AS_BYTE_ARRAY(v, bytes, n) _PyLong_AsByteArray(v, bytes, n, 1, 0)
+#endif
+
+static PyObject *ext_error(BigIntError error) {
+  switch (error) {
+  case MemoryError:
+    return PyErr_NoMemory();
+  case DivisionByZeroError:
+    PyErr_SetString(PyExc_ZeroDivisionError, BigIntErrorStrings[error]);
+    return NULL;
+  default:
+    PyErr_SetString(PyExc_ValueError, BigIntErrorStrings[error]);
+    return NULL;
+  }
+}
+
+// little-endian bytes to limbs, x->limbs has room for n bytes rounded up
+static void ext_bytes_to_limbs(const unsigned char *bytes, size_t n,
+                               bigint *x) {
+#if PY_LITTLE_ENDIAN
+  memcpy(x->limbs, bytes, n);
+#else
+  for (size_t i = 0; i < n; i++) {
+    x->limbs[i / LIMB_SIZE_BYTES] |= (Limb)bytes[i]
+                                     << (i % LIMB_SIZE_BYTES * 8);
+  }
+#endif
+}
+
+static int ext_resize_zero(bigint *x, size_t bytes) {
+  x->len = 0;
+  const size_t limbs = (bytes + LIMB_SIZE_BYTES - 1) / LIMB_SIZE_BYTES;
+  if (bigint_resize(x, limbs) != Ok) {
+    PyErr_NoMemory();
+    return -1;
+  }
+  return 0;
+}
+
+// Python int or buffer to bigint, -1 with an exception set on failure
+static int ext_from_object(PyObject *obj, bigint *x) {
+  if (PyLong_Check(obj)) {
+    const int sign = _PyLong_Sign(obj);
+    PyObject *magnitude = sign < 0 ? PyNumber_Absolute(obj) : obj;
+    if (magnitude == NULL) {
+      return -1;
+    }
+    const size_t bytes = (_PyLong_NumBits(magnitude) + 7) / 8;
+    int result = ext_resize_zero(x, bytes);
+    if (result == 0 && bytes > 0) {
+#if PY_LITTLE_ENDIAN
+      result = EXT_AS_BYTE_ARRAY((PyLongObject *)magnitude,
+                                 (unsigned char *)x->limbs, bytes);
+#else
+      unsigned char *buffer = PyMem_Malloc(bytes);
+      result = buffer == NULL ? -1
+                              : EXT_AS_BYTE_ARRAY((PyLongObject *)magnitude,
+                                                  buffer, bytes);
+      if (result == 0) {
+        ext_bytes_to_limbs(buffer, bytes, x);
+      }
+      PyMem_Free(buffer);
+#endif
+    }
+    if (magnitude != obj) {
+      Py_DECREF(magnitude);
+    }
+    bigint_fit(x);
+    x->negative = sign < 0;
+    return result;
+  }
+  if (PyObject_CheckBuffer(obj)) {
+    Py_buffer view;
+    if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS) != 0) {
+      return -1;
+    }
+    int result = ext_resize_zero(x, view.len);
+    if (result == 0) {
+      ext_bytes_to_limbs(view.buf, view.len, x);
+      bigint_fit(x);
+    }
+    PyBuffer_Release(&view);
+    return result;
+  }
+  PyErr_Format(PyExc_TypeError, "expected int or buffer, got %s",
+               Py_TYPE(obj)->tp_name);
+  return -1;
+}
+
+static PyObject *ext_to_object(const bigint *x) {
+  const size_t bytes = x->len * LIMB_SIZE_BYTES;
+#if PY_LITTLE_ENDIAN
+  PyObject *magnitude =
+      _PyLong_FromByteArray((const unsigned char *)x->limbs, bytes, 1, 0);
+#else
+  unsigned char *buffer = PyMem_Malloc(bytes + 1);
+  if (buffer == NULL) {
+    return PyErr_NoMemory();
+  }
+  for (size_t i = 0; i < bytes; i++) {
+    buffer[i] = (unsigned char)(x->limbs[i / LIMB_SIZE_BYTES] >>
+                                (i % LIMB_SIZE_BYTES * 8));
+  }
+  PyObject *magnitude = _PyLong_FromByteArray(buffer, bytes, 1, 0);
+  PyMem_Free(buffer);
+#endif
+  if (magnitude == NULL || !x->negative || x->len == 0) {
+    return magnitude;
+  }
+  PyObject *negated = PyNumber_Negative(magnitude);
+  Py_DECREF(magnitude);
+  return negated;
+}
+
+static PyThreadState *ext_unlock(size_t limbs) {
+  return limbs >= EXT_GIL_LIMBS ? PyEval_SaveThread() : NULL;
+}
+
+static void ext_lock(PyThreadState *state) {
+  if (state != NULL) {
+    PyEval_RestoreThread(state);
+  }
+}
+
+static size_t ext_max_len(const bigint *a, const bigint *b) {
+  return a->len > b->len ? a->len : b->len;
+}
+
+static void ext_free(bigint *values, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    bigint_free_limbs(&values[i]);
+  }
+}
+
+typedef BigIntError (*ext_binary_fn)(const bigint *, const bigint *, bigint *);
+
+static PyObject *ext_binary(PyObject *args, ext_binary_fn fn) {
+  PyObject *a_obj, *b_obj;
+  if (!PyArg_ParseTuple(args, "OO", &a_obj, &b_obj)) {
+    return NULL;
+  }
+  bigint v[3] = {BIGINT_ZERO, BIGINT_ZERO, BIGINT_ZERO};
+  PyObject *result = NULL;
+  if (ext_from_object(a_obj, &v[0]) == 0 &&
+      ext_from_object(b_obj, &v[1]) == 0) {
+    PyThreadState *state = ext_unlock(ext_max_len(&v[0], &v[1]));
+    const BigIntError error = fn(&v[0], &v[1], &v[2]);
+    ext_lock(state);
+    result = error == Ok ? ext_to_object(&v[2]) : ext_error(error);
+  }
+  ext_free(v, 3);
+  return result;
+}
+
+static PyObject *ext_add(PyObject *self, PyObject *args) {
+  (void)self;
+  return ext_binary(args, bigint_sadd);
+}
+
+static PyObject *ext_sub(PyObject *self, PyObject *args) {
+  (void)self;
+  return ext_binary(args, bigint_ssub);
+}
+
+static PyObject *ext_mul(PyObject *self, PyObject *args) {
+  (void)self;
+  return ext_binary(args, bigint_smul);
+}
+
+static PyObject *ext_gcd(PyObject *self, PyObject *args) {
+  (void)self;
+  return ext_binary(args, bigint_gcd);
+}
+
+static PyObject *ext_invert(PyObject *self, PyObject *args) {
+  (void)self;
+  return ext_binary(args, bigint_invert);
+}
+
+static PyObject *ext_divmod(PyObject *self, PyObject *args) {
+  (void)self;
+  PyObject *a_obj, *b_obj;
+  if (!PyArg_ParseTuple(args, "OO", &a_obj, &b_obj)) {
+    return NULL;
+  }
+  bigint v[4] = {BIGINT_ZERO, BIGINT_ZERO, BIGINT_ZERO, BIGINT_ZERO};
+  PyObject *result = NULL;
+  if (ext_from_object(a_obj, &v[0]) == 0 &&
+      ext_from_object(b_obj, &v[1]) == 0) {
+    PyThreadState *state = ext_unlock(ext_max_len(&v[0], &v[1]));
+    const BigIntError error = bigint_sdiv(&v[0], &v[1], &v[2], &v[3], RoundFloor);
+    ext_lock(state);
+    if (error != Ok) {
+      ext_error(error);
+    } else {
+      PyObject *q = ext_to_object(&v[2]);
+      PyObject *r = q == NULL ? NULL : ext_to_object(&v[3]);
+      result = r == NULL ? NULL : PyTuple_Pack(2, q, r);
+      Py_XDECREF(q);
+      Py_XDECREF(r);
+    }
+  }
+  ext_free(v, 4);
+  return result;
+}
+
+static int ext_check_exponents(const bigint *exps, Py_ssize_t n) {
+  for (Py_ssize_t i = 0; i < n; i++) {
+    if (exps[i].negative && exps[i].len > 0) {
+      PyErr_SetString(PyExc_ValueError, "negative exponent");
+      return -1;
+    }
+  }
+  return 0;
+}
+
+// base^e mod m for an odd m > 1 and e >= 0
+static BigIntError ext_powmod(const Montgomery *m, const bigint *base,
+                              const bigint *e, bigint *reduced,
+                              bigint *scratch, bigint *result) {
+  BigIntError error = bigint_sdiv(base, &m->modulus, scratch, reduced,
+                                  RoundFloor);
+  if (error == Ok) {
+    error = bigint_montgomery_exp(m, reduced, e, result);
+  }
+  return error;
+}
+
+static int ext_montgomery(const bigint *modulus, Montgomery *m) {
+  if (modulus->negative || modulus->len == 0 ||
+      (modulus->len == 1 && modulus->limbs[0] == 1)) {
+    PyErr_SetString(PyExc_ValueError, "modulus must be greater than 1");
+    return -1;
+  }
+  const BigIntError error = bigint_montgomery_init(modulus, m);
+  if (error == NotImplemented) {
+    PyErr_SetString(PyExc_ValueError, "modulus must be odd");
+    return -1;
+  }
+  if (error != Ok) {
+    ext_error(error);
+    return -1;
+  }
+  return 0;
+}
+
+static PyObject *ext_powmod_one(PyObject *self, PyObject *args) {
+  (void)self;
+  PyObject *base_obj, *e_obj, *m_obj;
+  if (!PyArg_ParseTuple(args, "OOO", &base_obj, &e_obj, &m_obj)) {
+    return NULL;
+  }
+  bigint v[6] = {BIGINT_ZERO, BIGINT_ZERO, BIGINT_ZERO,
+                 BIGINT_ZERO, BIGINT_ZERO, BIGINT_ZERO};
+  Montgomery m = {BIGINT_ZERO, BIGINT_ZERO, 0, 0};
+  PyObject *result = NULL;
+  if (ext_from_object(base_obj, &v[0]) == 0 &&
+      ext_from_object(e_obj, &v[1]) == 0 &&
+      ext_check_exponents(&v[1], 1) == 0 &&
+      ext_from_object(m_obj, &v[2]) == 0 && ext_montgomery(&v[2], &m) == 0) {
+    PyThreadState *state = ext_unlock(v[2].len);
+    const BigIntError error = ext_powmod(&m, &v[0], &v[1], &v[3], &v[4], &v[5]);
+    ext_lock(state);
+    result = error == Ok ? ext_to_object(&v[5]) : ext_error(error);
+  }
+  bigint_free_limbs(&m.rrm);
+  ext_free(v, 6);
+  return result;
+}
+
+static PyObject *ext_isqrt(PyObject *self, PyObject *arg) {
+  (void)self;
+  bigint v[2] = {BIGINT_ZERO, BIGINT_ZERO};
+  PyObject *result = NULL;
+  if (ext_from_object(arg, &v[0]) == 0) {
+    if (v[0].negative) {
+      PyErr_SetString(PyExc_ValueError, "isqrt of a negative number");
+    } else {
+      PyThreadState *state = ext_unlock(v[0].len);
+      const BigIntError error = bigint_sqrt_rem(&v[0], &v[1], NULL);
+      ext_lock(state);
+      result = error == Ok ? ext_to_object(&v[1]) : ext_error(error);
+    }
+  }
+  ext_free(v, 2);
+  return result;
+}
+
+static PyObject *ext_is_prime(PyObject *self, PyObject *args) {
+  (void)self;
+  PyObject *n_obj;
+  int reps = 24;
+  if (!PyArg_ParseTuple(args, "O|i", &n_obj, &reps)) {
+    return NULL;
+  }
+  bigint n = BIGINT_ZERO;
+  PyObject *result = NULL;
+  if (ext_from_object(n_obj, &n) == 0) {
+    PyThreadState *state = ext_unlock(n.len);
+    const int prime = n.negative ? 0 : bigint_probab_prime(&n, reps);
+    ext_lock(state);
+    result = PyLong_FromLong(prime);
+  }
+  bigint_free_limbs(&n);
+  return result;
+}
+
+static PyObject *ext_next_prime(PyObject *self, PyObject *arg) {
+  (void)self;
+  bigint v[2] = {BIGINT_ZERO, BIGINT_ZERO};
+  PyObject *result = NULL;
+  if (ext_from_object(arg, &v[0]) == 0) {
+    PyThreadState *state = ext_unlock(v[0].len);
+    const BigIntError error = bigint_next_prime(&v[0], &v[1]);
+    ext_lock(state);
+    result = error == Ok ? ext_to_object(&v[1]) : ext_error(error);
+  }
+  ext_free(v, 2);
+  return result;
+}
+
+// the limbs of |x| as bytes, for numpy.frombuffer(..., dtype=uint64)
+static PyObject *ext_limbs(PyObject *self, PyObject *arg) {
+  (void)self;
+  bigint x = BIGINT_ZERO;
+  PyObject *result = NULL;
+  if (ext_from_object(arg, &x) == 0) {
+    result = PyBytes_FromStringAndSize((const char *)x.limbs,
+                                       x.len * LIMB_SIZE_BYTES);
+  }
+  bigint_free_limbs(&x);
+  return result;
+}
+
+// converts every item of seq, values has room for n
+static int ext_from_sequence(PyObject *seq, bigint *values, Py_ssize_t n) {
+  for (Py_ssize_t i = 0; i < n; i++) {
+    if (ext_from_object(PySequence_Fast_GET_ITEM(seq, i), &values[i]) != 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static PyObject *ext_to_list(const bigint *values, Py_ssize_t n) {
+  PyObject *list = PyList_New(n);
+  for (Py_ssize_t i = 0; list != NULL && i < n; i++) {
+    PyObject *item = ext_to_object(&values[i]);
+    if (item == NULL) {
+      Py_CLEAR(list);
+    } else {
+      PyList_SET_ITEM(list, i, item);
+    }
+  }
+  return list;
+}
+
+// Pairs up two sequences of equal length, returns their lengths through n
+// and new references to the fast sequences, NULL on failure.
+static int ext_pair(PyObject *a_obj, PyObject *b_obj, PyObject **a,
+                    PyObject **b, Py_ssize_t *n) {
+  *a = PySequence_Fast(a_obj, "expected a sequence");
+  *b = *a == NULL ? NULL : PySequence_Fast(b_obj, "expected a sequence");
+  if (*b == NULL) {
+    Py_CLEAR(*a);
+    return -1;
+  }
+  *n = PySequence_Fast_GET_SIZE(*a);
+  if (PySequence_Fast_GET_SIZE(*b) != *n) {
+    PyErr_SetString(PyExc_ValueError, "sequences differ in length");
+    Py_CLEAR(*a);
+    Py_CLEAR(*b);
+    return -1;
+  }
+  return 0;
+}
+
+static PyObject *ext_mul_many(PyObject *self, PyObject *args) {
+  (void)self;
+  PyObject *a_obj, *b_obj, *a, *b;
+  Py_ssize_t n;
+  if (!PyArg_ParseTuple(args, "OO", &a_obj, &b_obj) ||
+      ext_pair(a_obj, b_obj, &a, &b, &n) != 0) {
+    return NULL;
+  }
+  bigint *v = PyMem_Calloc(3 * n + 1, sizeof(bigint));
+  PyObject *result = NULL;
+  if (v == NULL) {
+    PyErr_NoMemory();
+  } else if (ext_from_sequence(a, v, n) == 0 &&
+             ext_from_sequence(b, v + n, n) == 0) {
+    BigIntError error = Ok;
+    Py_BEGIN_ALLOW_THREADS
+    for (Py_ssize_t i = 0; i < n && error == Ok; i++) {
+      error = bigint_smul(&v[i], &v[n + i], &v[2 * n + i]);
+    }
+    Py_END_ALLOW_THREADS
+    result = error == Ok ? ext_to_list(v + 2 * n, n) : ext_error(error);
+  }
+  if (v != NULL) {
+    ext_free(v, 3 * n);
+    PyMem_Free(v);
+  }
+  Py_DECREF(a);
+  Py_DECREF(b);
+  return result;
+}
+
+// one Montgomery context shared by every base[i]^exps[i] mod m
+static PyObject *ext_powmod_many(PyObject *self, PyObject *args) {
+  (void)self;
+  PyObject *bases_obj, *exps_obj, *m_obj, *bases, *exps;
+  Py_ssize_t n;
+  if (!PyArg_ParseTuple(args, "OOO", &bases_obj, &exps_obj, &m_obj) ||
+      ext_pair(bases_obj, exps_obj, &bases, &exps, &n) != 0) {
+    return NULL;
+  }
+  // bases, exps, results, then the modulus and two scratch values
+  bigint *v = PyMem_Calloc(3 * n + 3, sizeof(bigint));
+  Montgomery m = {BIGINT_ZERO, BIGINT_ZERO, 0, 0};
+  PyObject *result = NULL;
+  if (v == NULL) {
+    PyErr_NoMemory();
+  } else if (ext_from_sequence(bases, v, n) == 0 &&
+             ext_from_sequence(exps, v + n, n) == 0 &&
+             ext_check_exponents(v + n, n) == 0 &&
+             ext_from_object(m_obj, &v[3 * n]) == 0 &&
+             ext_montgomery(&v[3 * n], &m) == 0) {
+    BigIntError error = Ok;
+    Py_BEGIN_ALLOW_THREADS
+    for (Py_ssize_t i = 0; i < n && error == Ok; i++) {
+      error = ext_powmod(&m, &v[i], &v[n + i], &v[3 * n + 1], &v[3 * n + 2],
+                         &v[2 * n + i]);
+    }
+    Py_END_ALLOW_THREADS
+    result = error == Ok ? ext_to_list(v + 2 * n, n) : ext_error(error);
+  }
+  bigint_free_limbs(&m.rrm);
+  if (v != NULL) {
+    ext_free(v, 3 * n + 3);
+    PyMem_Free(v);
+  }
+  Py_DECREF(bases);
+  Py_DECREF(exps);
+  return result;
+}
+
+// product of a sequence through the balanced product tree
+static PyObject *ext_product(PyObject *self, PyObject *arg) {
+  (void)self;
+  PyObject *items = PySequence_Fast(arg, "expected a sequence");
+  if (items == NULL) {
+    return NULL;
+  }
+  const Py_ssize_t n = PySequence_Fast_GET_SIZE(items);
+  bigint *v = PyMem_Calloc(n + 1, sizeof(bigint));
+  const bigint **pointers = PyMem_Calloc(n + 1, sizeof(bigint *));
+  PyObject *result = NULL;
+  if (v == NULL || pointers == NULL) {
+    PyErr_NoMemory();
+  } else if (ext_from_sequence(items, v, n) == 0) {
+    bool negative = false;
+    for (Py_ssize_t i = 0; i < n; i++) {
+      negative ^= v[i].negative && v[i].len > 0;
+      pointers[i] = &v[i];
+    }
+    BigIntError error = Ok;
+    if (n == 0) {
+      error = bigint_set_from_limb(1, &v[n]);
+    } else {
+      Py_BEGIN_ALLOW_THREADS
+      error = bigint_product(pointers, n, &v[n]);
+      Py_END_ALLOW_THREADS
+    }
+    v[n].negative = negative;
+    result = error == Ok ? ext_to_object(&v[n]) : ext_error(error);
+  }
+  if (v != NULL) {
+    ext_free(v, n + 1);
+  }
+  PyMem_Free(v);
+  PyMem_Free(pointers);
+  Py_DECREF(items);
+  return result;
+}
+
+static PyMethodDef ext_methods[] = {
+    {"add", ext_add, METH_VARARGS, "add(a, b) -> a + b"},
+    {"sub", ext_sub, METH_VARARGS, "sub(a, b) -> a - b"},
+    {"mul", ext_mul, METH_VARARGS, "mul(a, b) -> a * b"},
+    {"divmod", ext_divmod, METH_VARARGS,
+     "divmod(a, b) -> (a // b, a % b), floor rounding like Python"},
+    {"powmod", ext_powmod_one, METH_VARARGS,
+     "powmod(base, exp, m) -> pow(base, exp, m) for an odd m > 1"},
+    {"gcd", ext_gcd, METH_VARARGS, "gcd(a, b)"},
+    {"invert", ext_invert, METH_VARARGS, "invert(a, m) -> a^-1 mod m"},
+    {"isqrt", ext_isqrt, METH_O, "isqrt(a) -> floor(sqrt(a))"},
+    {"is_prime", ext_is_prime, METH_VARARGS,
+     "is_prime(n, reps=24) -> 2 prime, 1 probably prime, 0 composite"},
+    {"next_prime", ext_next_prime, METH_O, "next_prime(n) -> next prime > n"},
+    {"limbs", ext_limbs, METH_O, "limbs(x) -> little-endian limbs of |x|"},
+    {"mul_many", ext_mul_many, METH_VARARGS,
+     "mul_many(xs, ys) -> [x * y for x, y in zip(xs, ys)]"},
+    {"powmod_many", ext_powmod_many, METH_VARARGS,
+     "powmod_many(bases, exps, m) -> [pow(b, e, m) ...] for an odd m > 1"},
+    {"product", ext_product, METH_O, "product(xs) -> xs[0] * xs[1] * ..."},
+    {NULL, NULL, 0, NULL},
+};
+
+static struct PyModuleDef ext_module = {
+    PyModuleDef_HEAD_INIT,
+    "bigint_ext",
+    "Arbitrary precision arithmetic on Python ints through bigint.",
+    -1,
+    ext_methods,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+};
+
+PyMODINIT_FUNC PyInit_bigint_ext(void) {
+  PyObject *module = PyModule_Create(&ext_module);
+  if (module != NULL &&
+      PyModule_AddIntConstant(module, "LIMB_SIZE_BITS", LIMB_SIZE_BITS) != 0) {
+    Py_CLEAR(module);
+  }
+  return module;
+}
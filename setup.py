@@ -0,0 +1,28 @@
+# Builds the bigint_ext extension module:
+#
+#   python setup.py build_ext --inplace
+#
+# BIGINT_NATIVE=1 compiles for the building machine (-march=native), which
+# enables the AVX2/AVX-512 lanes in bigint_lanes.c.
+import glob
+import os
+
+from setuptools import Extension, setup
+
+sources = ["python_ext.c", "utils.c"] + sorted(glob.glob("bigint*.c"))
+compile_args = ["-std=c99"]
+if os.environ.get("BIGINT_NATIVE") == "1":
+    compile_args.append("-march=native")
+
+setup(
+    name="bigint_ext",
+    version="0.1",
+    ext_modules=[
+        Extension(
+            "bigint_ext",
+            sources,
+            define_macros=[("BIGINT_THREADS", None)],
+            extra_compile_args=compile_args,
+        )
+    ],
+)
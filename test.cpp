@@ -0,0 +1,239 @@
+#include "bigint.hpp"
+#include <cassert>
+#include <climits>
+#include <cstdio>
+#include <string>
+
+static unsigned long long state = 12345;
+
+static BigInt random_bigint(size_t limbs, bool allow_negative) {
+  std::string hex;
+  for (size_t i = 0; i < limbs * LIMB_SIZE_BYTES * 2; i++) {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    hex += "0123456789abcdef"[state >> 60];
+  }
+  if (allow_negative && (state >> 59) & 1) {
+    hex = "-" + hex;
+  }
+  return BigInt(hex);
+}
+
+static void test_arithmetic() {
+  for (size_t i = 0; i < 200; i++) {
+    const bool negative = i % 2 == 1;
+    BigInt a = random_bigint(1 + i % 40, negative);
+    BigInt b = random_bigint(1 + i % 17, negative);
+    BigInt c = random_bigint(1 + i % 23, negative);
+    BigInt product = a;
+    product *= b;
+
+    BigInt x = a * b + c;
+    assert(x == product + c);
+    assert(x - c == product);
+    BigInt y = c - a * b;
+    assert(y == c - product);
+    BigInt z = a * b + c * c - b * c;
+    assert(z == product + c * c - b * c);
+    x += a * b;
+    assert(x == product + product + c);
+    x -= a * b;
+    x -= a * b;
+    assert(x == c);
+    if (!b.is_zero()) {
+      assert((product + c - c) / b == a);
+      assert(product % b == 0);
+    }
+    // the destination is also an operand
+    x = a;
+    x = c + x * b;
+    assert(x == c + product);
+    assert(-(-a) == a);
+    assert((a << 70) >> 70 == a);
+  }
+  assert(BigInt(-5) * BigInt(7) + 40 == 5);
+  assert(BigInt("-ff") == -255);
+  assert(BigInt(0).hex() == "0");
+  assert(BigInt("-1f").hex() == "-1f");
+  assert(BigInt(-5L) == -5);
+  assert(BigInt(7u) == 7);
+  assert(BigInt(9ul) == BigInt((size_t)9));
+  assert(BigInt(~0ull).hex() == "ffffffffffffffff");
+  assert(BigInt(LLONG_MIN) + BigInt(LLONG_MAX) == -1);
+  assert(BigInt(~(Limb)0) + 1 == BigInt(1) << LIMB_SIZE_BITS);
+}
+
+static void test_storage() {
+  BigInt a = random_bigint(8, false);
+  BigInt b = random_bigint(8, false);
+  BigInt c = random_bigint(8, false);
+
+  // move steals the limbs
+  BigInt moved(a);
+  const Limb *limbs = moved.raw()->limbs;
+  BigInt stolen(std::move(moved));
+  assert(stolen.raw()->limbs == limbs);
+  assert(moved.raw()->limbs == NULL && moved.is_zero());
+
+  // assignments evaluate into the limbs the destination already owns
+  BigInt x = random_bigint(20, false);
+  limbs = x.raw()->limbs;
+  x = a * b + c;
+  assert(x.raw()->limbs == limbs);
+  x = c;
+  assert(x.raw()->limbs == limbs);
+  x += a * b;
+  assert(x.raw()->limbs == limbs);
+  x = a * b;
+  assert(x.raw()->limbs == limbs);
+  assert(x == stolen * b);
+}
+
+static void test_errors() {
+  bool thrown = false;
+  try {
+    BigInt("12x");
+  } catch (const BigIntException &e) {
+    thrown = e.error() == InvalidFormat;
+  }
+  assert(thrown);
+  thrown = false;
+  try {
+    BigInt(1) / BigInt(0);
+  } catch (const BigIntException &e) {
+    thrown = e.error() == DivisionByZeroError;
+  }
+  assert(thrown);
+}
+
+// the C types for each width against BigInt
+#define CHECK_FIXED_C(BITS)                                                    \
+  do {                                                                         \
+    const size_t n = BITS / LIMB_SIZE_BITS;                                    \
+    const BigInt base = BigInt(1) << BITS;                                     \
+    BigInt big_a = random_bigint(n, false);                                    \
+    BigInt big_b = random_bigint(n, false);                                    \
+    BigInt big_m = random_bigint(n - 1, false) * 2 + 1;                        \
+    bigint_fixed##BITS a, b, m, lo, hi, r;                                     \
+    assert(bigint_fixed##BITS##_from_bigint(big_a.raw(), &a) == Ok);           \
+    assert(bigint_fixed##BITS##_from_bigint(big_b.raw(), &b) == Ok);           \
+    assert(bigint_fixed##BITS##_from_bigint(big_m.raw(), &m) == Ok);           \
+    assert(bigint_fixed##BITS##_from_bigint(base.raw(), &r) ==                 \
+           ResultMemoryTooSmall);                                              \
+    BigInt x, y;                                                               \
+    const Limb carry = bigint_fixed##BITS##_add(&a, &b, &r);                   \
+    bigint_fixed##BITS##_to_bigint(&r, x.raw());                               \
+    assert(x + BigInt((long long)carry) * base == big_a + big_b);              \
+    bigint_fixed##BITS##_sub(&a, &b, &r);                                      \
+    bigint_fixed##BITS##_to_bigint(&r, x.raw());                               \
+    assert(x == ((big_a - big_b) + base) % base);                              \
+    bigint_fixed##BITS##_mul(&a, &b, &lo, &hi);                                \
+    bigint_fixed##BITS##_to_bigint(&lo, x.raw());                              \
+    bigint_fixed##BITS##_to_bigint(&hi, y.raw());                              \
+    assert(x + y * base == big_a * big_b);                                     \
+    bigint_fixed##BITS##_sqr(&a, &lo, &hi);                                    \
+    bigint_fixed##BITS##_to_bigint(&lo, x.raw());                              \
+    bigint_fixed##BITS##_to_bigint(&hi, y.raw());                              \
+    assert(x + y * base == big_a * big_a);                                     \
+    bigint_fixed##BITS##_shl(&a, 77, &r);                                      \
+    bigint_fixed##BITS##_to_bigint(&r, x.raw());                               \
+    assert(x == (big_a << 77) % base);                                         \
+    bigint_fixed##BITS##_shr(&a, 77, &r);                                      \
+    bigint_fixed##BITS##_to_bigint(&r, x.raw());                               \
+    assert(x == big_a >> 77);                                                  \
+    assert(bigint_fixed##BITS##_cmp(&a, &a) == 0);                             \
+                                                                               \
+    bigint_fixed##BITS##_mont ctx;                                             \
+    assert(bigint_fixed##BITS##_mont_init(&m, &ctx) == Ok);                    \
+    bigint_fixed##BITS am, bm;                                                 \
+    BigInt big_ar = big_a % big_m, big_br = big_b % big_m;                     \
+    bigint_fixed##BITS##_from_bigint(big_ar.raw(), &a);                        \
+    bigint_fixed##BITS##_from_bigint(big_br.raw(), &b);                        \
+    bigint_fixed##BITS##_mont_to(&ctx, &a, &am);                               \
+    bigint_fixed##BITS##_mont_to(&ctx, &b, &bm);                               \
+    bigint_fixed##BITS##_mont_mul(&ctx, &am, &bm, &r);                         \
+    bigint_fixed##BITS##_mont_from(&ctx, &r, &r);                              \
+    bigint_fixed##BITS##_to_bigint(&r, x.raw());                               \
+    assert(x == big_ar * big_br % big_m);                                      \
+    bigint_fixed##BITS e = {{5}};                                              \
+    bigint_fixed##BITS##_mont_exp(&ctx, &am, &e, &r);                          \
+    bigint_fixed##BITS##_mont_from(&ctx, &r, &r);                              \
+    bigint_fixed##BITS##_to_bigint(&r, x.raw());                               \
+    BigInt a2 = big_ar * big_ar % big_m;                                       \
+    assert(x == a2 * a2 % big_m * big_ar % big_m);                             \
+  } while (0)
+
+template <size_t N> static void check_fixed_template() {
+  const BigInt base = BigInt(1) << (N * LIMB_SIZE_BITS);
+  for (size_t i = 0; i < 10; i++) {
+    const BigInt big_a = random_bigint(N, false);
+    const BigInt big_b = random_bigint(N, false);
+    const BigInt big_m = random_bigint(N, false) / 2 * 2 + 1;
+    const FixedInt<N> a(big_a), b(big_b), m(big_m);
+    assert((a + b).to_bigint() == (big_a + big_b) % base);
+    assert((a - b).to_bigint() == (big_a - big_b + base) % base);
+    assert((a * b).to_bigint() == big_a * big_b % base);
+    FixedInt<N> lo, hi;
+    mul(a, b, lo, hi);
+    assert(lo.to_bigint() + hi.to_bigint() * base == big_a * big_b);
+    sqr(b, lo, hi);
+    assert(lo.to_bigint() + hi.to_bigint() * base == big_b * big_b);
+    assert((a << 3).to_bigint() == (big_a << 3) % base);
+    assert((a >> 65).to_bigint() == big_a >> 65);
+    assert((a < b) == (big_a < big_b));
+
+    const FixedMontgomery<N> ctx(m);
+    const FixedInt<N> ar(big_a % big_m), br(big_b % big_m);
+    const FixedInt<N> product = ctx.from(ctx.mul(ctx.to(ar), ctx.to(br)));
+    assert(product.to_bigint() == big_a % big_m * (big_b % big_m) % big_m);
+    // Fermat for m = 2^127 - 1 checks exp with a full width exponent
+    if (N == 128 / LIMB_SIZE_BITS) {
+      const FixedInt<N> p(BigInt("7fffffffffffffffffffffffffffffff"));
+      const FixedMontgomery<N> prime(p);
+      const FixedInt<N> x(big_a % p.to_bigint());
+      if (!x.is_zero()) {
+        const FixedInt<N> one = prime.from(prime.exp(prime.to(x), p - 1));
+        assert(one == FixedInt<N>(1));
+      }
+    }
+    // and the Mersenne prime 2^2203 - 1 the squaring path above the comba sizes
+    if (N == 4096 / LIMB_SIZE_BITS && i == 0) {
+      const FixedInt<N> p((BigInt(1) << 2203) - BigInt(1));
+      const FixedMontgomery<N> prime(p);
+      const FixedInt<N> x(big_a % p.to_bigint());
+      if (!x.is_zero()) {
+        const FixedInt<N> one = prime.from(prime.exp(prime.to(x), p - 1));
+        assert(one == FixedInt<N>(1));
+      }
+    }
+  }
+}
+
+static void test_fixed() {
+  for (size_t i = 0; i < 5; i++) {
+    CHECK_FIXED_C(256);
+    CHECK_FIXED_C(512);
+    CHECK_FIXED_C(1024);
+    CHECK_FIXED_C(2048);
+    CHECK_FIXED_C(4096);
+  }
+  check_fixed_template<1>();
+  check_fixed_template<128 / LIMB_SIZE_BITS>();
+  check_fixed_template<3>();
+  check_fixed_template<4096 / LIMB_SIZE_BITS>();
+  bool thrown = false;
+  try {
+    FixedMontgomery<4> even{FixedInt<4>(10)};
+  } catch (const BigIntException &e) {
+    thrown = e.error() == NotImplemented;
+  }
+  assert(thrown);
+}
+
+int main() {
+  test_arithmetic();
+  test_storage();
+  test_errors();
+  test_fixed();
+  printf("ok\n");
+  return 0;
+}
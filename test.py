@@ -1,7 +1,15 @@
 import ctypes
+import importlib
 import unittest
 import random
 import math
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import threading
 
 random.seed(12345)
 TESTS = 25
@@ -14,7 +22,87 @@ Limb = ctypes.c_uint64
 class Bigint(ctypes.Structure):
     _fields_ = [("limbs", ctypes.POINTER(Limb)),
                 ("capacity", ctypes.c_size_t),
-                ("len", ctypes.c_size_t)]
+                ("len", ctypes.c_size_t),
+                ("negative", ctypes.c_bool)]
+
+class Montgomery(ctypes.Structure):
+    _fields_ = [("modulus", Bigint),
+                ("rrm", Bigint),
+                ("n", ctypes.c_size_t),
+                ("minv", Limb)]
+
+class FixedBase(ctypes.Structure):
+    _fields_ = [("m", ctypes.POINTER(Montgomery)),
+                ("teeth", ctypes.c_size_t),
+                ("spacing", ctypes.c_size_t),
+                ("max_bits", ctypes.c_size_t),
+                ("entry_limbs", ctypes.c_size_t),
+                ("table", ctypes.POINTER(Limb))]
+
+lib.bigint_fixed_base_serialized_size.restype = ctypes.c_size_t
+lib.bigint_perfect_square.restype = ctypes.c_bool
+lib.bigint_greater_than.restype = ctypes.c_bool
+lib.bigint_less_than.restype = ctypes.c_bool
+lib.bigint_equal.restype = ctypes.c_bool
+class SpecialModulus(ctypes.Structure):
+    _fields_ = [("modulus", Bigint),
+                ("rrm", Bigint),
+                ("n", ctypes.c_size_t),
+                ("form", ctypes.c_int),
+                ("c", Bigint),
+                ("terms", ctypes.c_size_t),
+                ("shifts", ctypes.c_size_t * 8),
+                ("negative_terms", ctypes.c_bool * 8)]
+
+class MontgomeryAcc(ctypes.Structure):
+    _fields_ = [("m", ctypes.POINTER(Montgomery)),
+                ("sum", Bigint),
+                ("terms", ctypes.c_size_t),
+                ("max_terms", ctypes.c_size_t)]
+
+class SubproductTree(ctypes.Structure):
+    _fields_ = [("n", ctypes.c_size_t),
+                ("nodes", ctypes.POINTER(Bigint)),
+                ("reciprocals", ctypes.POINTER(Bigint))]
+
+STATS_OPS = ["mul_classic", "mul_comba", "mul_karatsuba", "div", "div_limb",
+    "montgomery_reduce", "montgomery_mul"]
+
+class StatsOp(ctypes.Structure):
+    _fields_ = [("calls", ctypes.c_uint64),
+                ("ns", ctypes.c_uint64),
+                ("sizes", ctypes.c_uint64 * 24)]
+
+class Stats(ctypes.Structure):
+    _fields_ = [("allocations", ctypes.c_uint64),
+                ("reallocs", ctypes.c_uint64),
+                ("bytes", ctypes.c_uint64),
+                ("div_corrections", ctypes.c_uint64),
+                ("karatsuba_max_depth", ctypes.c_uint64),
+                ("ops", StatsOp * len(STATS_OPS))]
+
+class Rns(ctypes.Structure):
+    _fields_ = [("n", ctypes.c_size_t),
+                ("moduli", ctypes.POINTER(Limb)),
+                ("inverses", ctypes.POINTER(Limb)),
+                ("tree", SubproductTree)]
+
+class FileWriter(ctypes.Structure):
+    _fields_ = [("fp", ctypes.c_void_p),
+                ("offset", ctypes.c_uint64),
+                ("count", ctypes.c_size_t),
+                ("capacity", ctypes.c_size_t),
+                ("index", ctypes.POINTER(ctypes.c_uint64)),
+                ("failed", ctypes.c_bool),
+                ("swap", ctypes.c_bool)]
+
+class BigintFile(ctypes.Structure):
+    _fields_ = [("data", ctypes.c_void_p),
+                ("size", ctypes.c_size_t),
+                ("count", ctypes.c_size_t),
+                ("limb_size", ctypes.c_size_t),
+                ("swap", ctypes.c_bool),
+                ("index", ctypes.c_void_p)]
 
 lib.bigint_new_capacity.restype = ctypes.POINTER(Bigint)
 lib.bigint_set_hex.argtypes = [ctypes.c_char_p, ctypes.POINTER(Bigint)]
@@ -25,6 +113,12 @@ lib.bigint_bit_xor.argtypes = [ctypes.POINTER(Bigint), ctypes.POINTER(Bigint),
     ctypes.POINTER(Bigint)]
 lib.bigint_set_from_limb.argtypes = [Limb, ctypes.POINTER(Bigint)]
 lib.bigint_get_to_limb.argtypes = [ctypes.POINTER(Bigint), ctypes.POINTER(Limb)]
+lib.bigint_addmul_limb.argtypes = [ctypes.POINTER(Bigint), ctypes.POINTER(Bigint),
+    Limb]
+lib.bigint_primorial_ui.argtypes = [Limb, ctypes.POINTER(Bigint)]
+lib.bigint_dot.argtypes = [ctypes.POINTER(Bigint),
+    ctypes.POINTER(ctypes.POINTER(Bigint)),
+    ctypes.POINTER(ctypes.POINTER(Bigint)), ctypes.c_size_t]
 
 def rand(bits):
     return random.getrandbits(bits)
@@ -33,11 +127,29 @@ def bit_not(num, bits):
     return num ^ ((1 << bits) - 1)
 
 def prepare_buffer(num):
-    hex_ = hex(num)[2:].lstrip("0").encode()
+    hex_ = hex(abs(num))[2:].lstrip("0").encode()
     if not hex_:
         hex_ = b'0'
+    if num < 0:
+        hex_ = b'-' + hex_
     return ctypes.create_string_buffer(hex_)
 
+def to_bigint(num):
+    bigint = lib.bigint_new_capacity(0)
+    lib.bigint_set_hex(prepare_buffer(num), bigint)
+    return bigint
+
+def from_bigint(bigint):
+    return int(lib.bigint_get_hex(bigint, False), 16)
+
+def montgomery(modulus):
+    m = Montgomery()
+    lib.bigint_montgomery_init(to_bigint(modulus), ctypes.byref(m))
+    return m
+
+def bigint_array(nums):
+    return (ctypes.POINTER(Bigint) * len(nums))(*map(to_bigint, nums))
+
 def test_binary_op(t, python_op, lib_op):
     a = rand(BITS_A)
     b = rand(BITS_B)
@@ -107,14 +219,23 @@ class TestLib(unittest.TestCase):
             lib.bigint_div(bigint_a, bigint_b, bigint_q, bigint_r)
             expected_q = hex(a // b)[2:].encode()
             expected_r = hex(a % b)[2:].encode()
-            actual_q = lib.bigint_get_hex(bigint_q)
-            actual_r = lib.bigint_get_hex(bigint_r)
+            actual_q = lib.bigint_get_hex(bigint_q, False)
+            actual_r = lib.bigint_get_hex(bigint_r, False)
             self.assertEqual(expected_q, actual_q)
+            self.assertEqual(expected_r, actual_r)
 
             lib.bigint_free_limbs(bigint_a)
             lib.bigint_free_limbs(bigint_b)
             lib.bigint_free_limbs(bigint_q)
             lib.bigint_free_limbs(bigint_r)
+        # qhat overestimates by one and the add-back step runs
+        for a, b in ((0x5081fcad44dafb32a32b850355841fbe50772d86157212b6f6c05b0cc25b0a18214db6aca9945bbbb4e3013ca4,
+                      0xad43b1a11df587fd2803bab6c398d88348a7eed8d14f06d3fef701966a0c381e88f38c0c8fe),
+                     (0x1800000000000000000000000000000017fffffffffffffff,
+                      0x800000000000000000000000000000008000000000000000)):
+            q, r = lib.bigint_new_capacity(0), lib.bigint_new_capacity(0)
+            lib.bigint_div(to_bigint(a), to_bigint(b), q, r)
+            self.assertEqual((from_bigint(q), from_bigint(r)), divmod(a, b))
             
 
     def test_shifts(self):
@@ -153,5 +274,708 @@ class TestLib(unittest.TestCase):
             self.assertEqual(res_a.value, a)
             lib.bigint_free_limbs(bigint)
 
+    def test_cmp(self):
+        for i in range(TESTS):
+            a = rand(BITS_A)
+            for b in (rand(BITS_B), a, a + 1, a - 1, a >> LIMB_SIZE_BITS,
+                      a << LIMB_SIZE_BITS, 0):
+                bigint_a, bigint_b = to_bigint(a), to_bigint(b)
+                self.assertEqual(lib.bigint_cmp(bigint_a, bigint_b), (a > b) - (a < b))
+                self.assertEqual(lib.bigint_cmp(bigint_b, bigint_a), (b > a) - (b < a))
+                self.assertEqual(lib.bigint_equal(bigint_a, bigint_b), a == b)
+                lib.bigint_free_limbs(bigint_a)
+                lib.bigint_free_limbs(bigint_b)
+
+    def test_normalized_len(self):
+        def limbs(num):
+            return (num.bit_length() + LIMB_SIZE_BITS - 1) // LIMB_SIZE_BITS
+        for i in range(TESTS):
+            a = rand(BITS_A)
+            b = a ^ rand(LIMB_SIZE_BITS)
+            bigint_a, bigint_b = to_bigint(a), to_bigint(b)
+            self.assertEqual(to_bigint(0).contents.len, 0)
+            self.assertEqual(to_bigint(1).contents.len, 1)
+            self.assertEqual(bigint_a.contents.len, limbs(a))
+            res = lib.bigint_new_capacity(0)
+            for op, expected in ((lib.bigint_bit_xor, a ^ b),
+                                 (lib.bigint_bit_and, a & b),
+                                 (lib.bigint_sub, a - b if a >= b else b - a),
+                                 (lib.bigint_mul_karatsuba, a * b)):
+                if op == lib.bigint_sub and a < b:
+                    op(bigint_b, bigint_a, res)
+                else:
+                    op(bigint_a, bigint_b, res)
+                self.assertEqual(res.contents.len, limbs(expected))
+                self.assertEqual(from_bigint(res), expected)
+            lib.bigint_free_limbs(bigint_a)
+            lib.bigint_free_limbs(bigint_b)
+            lib.bigint_free_limbs(res)
+
+    def test_addmul(self):
+        for bits in (64, 512, BITS_A):
+            for i in range(TESTS):
+                acc, a, b = rand(BITS_A), rand(bits), rand(bits)
+                bigint_acc = to_bigint(acc)
+                bigint_a, bigint_b = to_bigint(a), to_bigint(b)
+                self.assertEqual(lib.bigint_addmul(bigint_acc, bigint_a, bigint_b), 0)
+                self.assertEqual(from_bigint(bigint_acc), acc + a * b)
+                self.assertEqual(lib.bigint_submul(bigint_acc, bigint_a, bigint_b), 0)
+                self.assertEqual(from_bigint(bigint_acc), acc)
+
+                self.assertEqual(lib.bigint_addmul(bigint_a, bigint_a, bigint_b), 0)
+                self.assertEqual(from_bigint(bigint_a), a + a * b)
+                self.assertEqual(lib.bigint_addmul(bigint_b, bigint_b, bigint_b), 0)
+                self.assertEqual(from_bigint(bigint_b), b + b * b)
+
+                limb = rand(LIMB_SIZE_BITS)
+                self.assertEqual(lib.bigint_addmul_limb(bigint_acc, bigint_acc, limb), 0)
+                self.assertEqual(from_bigint(bigint_acc), acc + acc * limb)
+                for x in (bigint_acc, bigint_a, bigint_b):
+                    lib.bigint_free_limbs(x)
+
+    def test_submul_negative(self):
+        for i in range(TESTS):
+            bits = random.choice((BITS_A // 2, 256))
+            a, b = rand(bits) | 1, rand(bits) | 1
+            acc = random.choice((a * b - 1, rand(LIMB_SIZE_BITS) | 1))
+            bigint_acc = to_bigint(acc)
+            bigint_a, bigint_b = to_bigint(a), to_bigint(b)
+            self.assertEqual(lib.bigint_submul(bigint_acc, bigint_a, bigint_b), 3)
+            self.assertEqual(from_bigint(bigint_acc), acc)
+            for x in (bigint_acc, bigint_a, bigint_b):
+                lib.bigint_free_limbs(x)
+        # the first row borrows, the last one does not
+        bigint_acc = to_bigint(1)
+        self.assertEqual(lib.bigint_submul(bigint_acc, to_bigint(2),
+            to_bigint((1 << LIMB_SIZE_BITS) + 1)), 3)
+        self.assertEqual(from_bigint(bigint_acc), 1)
+
+    def test_dot(self):
+        Array = ctypes.POINTER(Bigint) * TESTS
+        for bits in (64, 512, BITS_A):
+            a = [rand(bits) for i in range(TESTS)]
+            b = [rand(bits) for i in range(TESTS)]
+            acc = rand(bits)
+            bigint_acc = to_bigint(acc)
+            bigint_a = Array(*map(to_bigint, a))
+            bigint_b = Array(*map(to_bigint, b))
+            bigint_a[3] = bigint_acc
+            lib.bigint_dot(bigint_acc, bigint_a, bigint_b, TESTS)
+            a[3] = acc
+            self.assertEqual(from_bigint(bigint_acc),
+                acc + sum(x * y for x, y in zip(a, b)))
+        # Karatsuba-sized terms mixed with row terms, and all-ones operands
+        # whose row carries pile up in the same columns
+        big = 50 * LIMB_SIZE_BITS
+        ones = (1 << big) - 1
+        for a, b in (([rand(big), rand(64), rand(big // 2), rand(big)],
+                      [rand(big), rand(big), rand(big), rand(3 * big)]),
+                     ([ones] * 4, [ones, ones, ones >> 64 * 30, 1])):
+            acc = ones
+            bigint_acc = to_bigint(acc)
+            lib.bigint_dot(bigint_acc, bigint_array(a), bigint_array(b), len(a))
+            self.assertEqual(from_bigint(bigint_acc),
+                acc + sum(x * y for x, y in zip(a, b)))
+
+    def test_signed(self):
+        def rand_signed(bits):
+            return rand(bits) * random.choice((-1, 1))
+        for i in range(TESTS):
+            a = rand_signed(BITS_A)
+            for b in (rand_signed(BITS_B), rand_signed(BITS_B // 2), a, -a, 0):
+                bigint_a, bigint_b = to_bigint(a), to_bigint(b)
+                res = lib.bigint_new_capacity(0)
+                lib.bigint_sadd(bigint_a, bigint_b, res)
+                self.assertEqual(from_bigint(res), a + b)
+                lib.bigint_ssub(bigint_a, bigint_b, res)
+                self.assertEqual(from_bigint(res), a - b)
+                lib.bigint_smul(bigint_a, bigint_b, res)
+                self.assertEqual(from_bigint(res), a * b)
+                self.assertEqual(lib.bigint_scmp(bigint_a, bigint_b), (a > b) - (a < b))
+                if b != 0:
+                    q, r = lib.bigint_new_capacity(0), lib.bigint_new_capacity(0)
+                    lib.bigint_sdiv(bigint_a, bigint_b, q, r, 1)
+                    self.assertEqual((from_bigint(q), from_bigint(r)), divmod(a, b))
+                    lib.bigint_sdiv(bigint_a, bigint_b, q, r, 0)
+                    trunc = abs(a) // abs(b) * (-1 if (a < 0) != (b < 0) else 1)
+                    self.assertEqual((from_bigint(q), from_bigint(r)), (trunc, a - trunc * b))
+                    lib.bigint_sdiv(bigint_a, bigint_b, q, bigint_b, 1)
+                    self.assertEqual((from_bigint(q), from_bigint(bigint_b)), divmod(a, b))
+                    lib.bigint_free_limbs(q)
+                    lib.bigint_free_limbs(r)
+                lib.bigint_ssub(bigint_a, bigint_a, bigint_a)
+                self.assertFalse(bigint_a.contents.negative)
+                for x in (bigint_a, bigint_b, res):
+                    lib.bigint_free_limbs(x)
+
+    def test_gcd(self):
+        for bits in (LIMB_SIZE_BITS, 3 * LIMB_SIZE_BITS, BITS_A):
+            for i in range(TESTS):
+                common = rand(bits // 3) | 1
+                a = rand(bits) * common * random.choice((-1, 1))
+                b = rand(bits // random.choice((1, 2))) * common * random.choice((-1, 1))
+                bigint_a, bigint_b = to_bigint(a), to_bigint(b)
+                g, s, t = (lib.bigint_new_capacity(0) for i in range(3))
+                lib.bigint_gcd(bigint_a, bigint_b, g)
+                self.assertEqual(from_bigint(g), math.gcd(a, b))
+                lib.bigint_gcdext(bigint_a, bigint_b, g, s, t)
+                self.assertEqual(from_bigint(g), math.gcd(a, b))
+                self.assertEqual(from_bigint(s) * a + from_bigint(t) * b, math.gcd(a, b))
+                self.assertLessEqual(abs(from_bigint(s)), abs(b) or 1)
+
+                m = abs(b) | 1
+                bigint_m = to_bigint(m)
+                if math.gcd(a, m) == 1:
+                    self.assertEqual(lib.bigint_invert(bigint_a, bigint_m, s), 0)
+                    self.assertEqual(from_bigint(s), pow(a, -1, m))
+                else:
+                    self.assertEqual(lib.bigint_invert(bigint_a, bigint_m, s), 5)
+                for x in (bigint_a, bigint_b, bigint_m, g, s, t):
+                    lib.bigint_free_limbs(x)
+
+    def test_gcd_large(self):
+        # past the half-gcd threshold, including a common factor large enough
+        # that the remainders meet within the half-gcd bound
+        bits = 1200 * LIMB_SIZE_BITS
+        for common_bits in (LIMB_SIZE_BITS, bits // 4, bits - LIMB_SIZE_BITS):
+            common = rand(common_bits) | 1
+            a = rand(bits) * common
+            b = rand(bits - random.randrange(LIMB_SIZE_BITS)) * common * random.choice((-1, 1))
+            bigint_a, bigint_b = to_bigint(a), to_bigint(b)
+            g, s, t = (lib.bigint_new_capacity(0) for i in range(3))
+            lib.bigint_gcd(bigint_a, bigint_b, g)
+            self.assertEqual(from_bigint(g), math.gcd(a, b))
+            lib.bigint_gcdext(bigint_a, bigint_b, g, s, t)
+            self.assertEqual(from_bigint(g), math.gcd(a, b))
+            self.assertEqual(from_bigint(s) * a + from_bigint(t) * b, math.gcd(a, b))
+            self.assertLessEqual(abs(from_bigint(s)), abs(b))
+            for x in (bigint_a, bigint_b, g, s, t):
+                lib.bigint_free_limbs(x)
+
+    def test_batch_invert(self):
+        for bits in (LIMB_SIZE_BITS - 3, 256, 521):
+            modulus = rand(bits) | (1 << (bits - 1)) | 1
+            m = montgomery(modulus)
+            R = 1 << modulus.bit_length()
+            xs = [rand(bits) % modulus for i in range(TESTS)]
+            xs = [x for x in xs if math.gcd(x, modulus) == 1]
+            n = len(xs)
+            bigint_in = bigint_array([x * R % modulus for x in xs])
+            for threads in (0, 1, 3):
+                bigint_out = bigint_array([0] * n)
+                if threads:
+                    result = lib.bigint_batch_invert_parallel(ctypes.byref(m),
+                        bigint_in, bigint_out, n, threads)
+                else:
+                    result = lib.bigint_batch_invert(ctypes.byref(m), bigint_in,
+                        bigint_out, n)
+                self.assertEqual(result, 0)
+                for x, out in zip(xs, bigint_out):
+                    self.assertEqual(from_bigint(out), pow(x, -1, modulus) * R % modulus)
+            # in place, out[i] aliasing in[i]
+            bigint_inout = bigint_array([x * R % modulus for x in xs])
+            self.assertEqual(lib.bigint_batch_invert(ctypes.byref(m),
+                bigint_inout, bigint_inout, n), 0)
+            for x, out in zip(xs, bigint_inout):
+                self.assertEqual(from_bigint(out), pow(x, -1, modulus) * R % modulus)
+            bigint_in[1] = to_bigint(0)
+            self.assertEqual(lib.bigint_batch_invert(ctypes.byref(m),
+                bigint_in, bigint_out, n), 5)
+
+    def test_fixed_base(self):
+        for bits, teeth in ((LIMB_SIZE_BITS - 3, 1), (256, 4), (521, 6)):
+            modulus = rand(bits) | (1 << (bits - 1)) | 1
+            m = montgomery(modulus)
+            base = rand(bits + 10)
+            fb = FixedBase()
+            self.assertEqual(lib.bigint_fixed_base_init(ctypes.byref(m),
+                to_bigint(base), bits, teeth, ctypes.byref(fb)), 0)
+            size = lib.bigint_fixed_base_serialized_size(ctypes.byref(fb))
+            buffer = ctypes.create_string_buffer(size)
+            lib.bigint_fixed_base_serialize(ctypes.byref(fb), buffer)
+            loaded = FixedBase()
+            self.assertEqual(lib.bigint_fixed_base_deserialize(ctypes.byref(m),
+                buffer, size, ctypes.byref(loaded)), 0)
+            self.assertEqual(lib.bigint_fixed_base_deserialize(ctypes.byref(m),
+                buffer, size - 1, ctypes.byref(FixedBase())), 6)
+            # crafted headers whose table size overflows: 2^48 << 16 entries
+            # wraps to none, leaving a buffer of just header and modulus
+            magic, version, limb_size, _, _, _, entry_limbs = struct.unpack_from('=IIIIQQQ', buffer)
+            modulus_bytes = buffer.raw[40:40 + entry_limbs * LIMB_SIZE_BITS // 8]
+            for teeth, max_bits in ((16, 1 << 52), (16, (1 << 64) - 1)):
+                spacing = -(-max_bits // teeth)
+                crafted = struct.pack('=IIIIQQQ', magic, version, limb_size,
+                    teeth, spacing, max_bits, entry_limbs) + modulus_bytes
+                self.assertEqual(lib.bigint_fixed_base_deserialize(ctypes.byref(m),
+                    crafted, len(crafted), ctypes.byref(FixedBase())), 6)
+            res = lib.bigint_new_capacity(0)
+            for e in [0, 1, (1 << bits) - 1] + [rand(bits) for i in range(TESTS)]:
+                for table in (fb, loaded):
+                    self.assertEqual(lib.bigint_fixed_base_exp(ctypes.byref(table),
+                        to_bigint(e), res), 0)
+                    self.assertEqual(from_bigint(res), pow(base, e, modulus))
+            self.assertEqual(lib.bigint_fixed_base_exp(ctypes.byref(fb),
+                to_bigint(1 << bits), res), 3)
+            lib.bigint_fixed_base_free(ctypes.byref(fb))
+            lib.bigint_fixed_base_free(ctypes.byref(loaded))
+
+    def test_multiexp(self):
+        for bits, n in ((LIMB_SIZE_BITS - 3, 1), (256, 1), (256, 5), (256, 40), (521, 3)):
+            modulus = rand(bits) | (1 << (bits - 1)) | 1
+            m = montgomery(modulus)
+            bases = [rand(bits + 5) for i in range(n)]
+            exps = [rand(bits) >> random.randrange(bits) for i in range(n)]
+            exps[0] = rand(bits)
+            res = lib.bigint_new_capacity(0)
+            self.assertEqual(lib.bigint_montgomery_multiexp(ctypes.byref(m),
+                bigint_array(bases), bigint_array(exps), n, res), 0)
+            expected = 1
+            for g, e in zip(bases, exps):
+                expected = expected * pow(g, e, modulus) % modulus
+            self.assertEqual(from_bigint(res), expected)
+            lib.bigint_montgomery_exp(ctypes.byref(m), to_bigint(bases[0]),
+                to_bigint(exps[0]), res)
+            self.assertEqual(from_bigint(res), pow(bases[0], exps[0], modulus))
+            lib.bigint_montgomery_exp(ctypes.byref(m), to_bigint(bases[0]),
+                to_bigint(0), res)
+            self.assertEqual(from_bigint(res), 1)
+
+    def test_special_modulus(self):
+        p256_c = 2**224 - 2**192 - 2**96 + 1
+        cases = ((2**127 - 1, None, 0), (2**521 - 1, None, 0),
+                 (2**255 - 19, None, 1), (2**256 - 2**32 - 977, None, 1),
+                 (2**256 - p256_c, (256, p256_c), 2), (2**256 - p256_c, None, 2),
+                 (2**384 - 2**128 - 2**96 + 2**32 - 1, None, 2),
+                 (2**384 - 2**128 - 2**96 + 2**32 - 1,
+                     (384, 2**128 + 2**96 - 2**32 + 1), 2),
+                 (2**256 + 2**200 + 12345, (256, -(2**200 + 12345)), 2),
+                 (2**256 - 0xd6f6e5e4c0a2e3eb33ec0ff6e1c6d3a5, (256, 0xd6f6e5e4c0a2e3eb33ec0ff6e1c6d3a5), 3))
+        for modulus, form, expected_form in cases:
+            m = SpecialModulus()
+            if form is None:
+                self.assertEqual(lib.bigint_special_init(to_bigint(modulus), ctypes.byref(m)), 0)
+            else:
+                self.assertEqual(lib.bigint_special_init_form(form[0],
+                    to_bigint(form[1]), ctypes.byref(m)), 0)
+            self.assertEqual(m.form, expected_form)
+            self.assertEqual(from_bigint(ctypes.pointer(m.modulus)), modulus)
+            res = lib.bigint_new_capacity(0)
+            for i in range(TESTS):
+                a, b = rand(modulus.bit_length()) % modulus, rand(modulus.bit_length()) % modulus
+                lib.bigint_special_mul(ctypes.byref(m), to_bigint(a), to_bigint(b), res)
+                self.assertEqual(from_bigint(res), a * b % modulus)
+                x = rand(3 * modulus.bit_length()) * random.choice((-1, 1))
+                lib.bigint_special_reduce(ctypes.byref(m), to_bigint(x), res)
+                self.assertEqual(from_bigint(res), x % modulus)
+            lib.bigint_special_free(ctypes.byref(m))
+        self.assertEqual(lib.bigint_special_init(to_bigint(rand(256) | 1 | 1 << 255),
+            ctypes.byref(SpecialModulus())), 3)
+        # sparse c, but each fold would only drop a bit
+        self.assertEqual(lib.bigint_special_init(to_bigint(2**255 + 1),
+            ctypes.byref(SpecialModulus())), 3)
+
+    def test_prime(self):
+        def is_prime(n):
+            return n > 1 and all(n % d for d in range(2, int(n**0.5) + 1))
+        lib.bigint_probab_prime.argtypes = [ctypes.POINTER(Bigint), ctypes.c_int]
+        res = lib.bigint_new_capacity(0)
+        for n in list(range(-5, 5000)) + [random.randrange(2**24, 2**32) for _ in range(TESTS)]:
+            expected = 2 if is_prime(abs(n)) else 0
+            if expected and abs(n) >= 4096**2:
+                expected = 1
+            self.assertEqual(lib.bigint_probab_prime(to_bigint(n), 25), expected, n)
+        for n in range(0, 5000, 7):
+            lib.bigint_next_prime(to_bigint(n), res)
+            self.assertEqual(from_bigint(res), next(p for p in range(n + 1, 2 * n + 3) if is_prime(p)))
+        # strong pseudoprimes to base 2, Carmichael numbers and products of primes
+        for n in (3215031751, 2152302898747, 3474749660383, 341550071728321,
+                  3825123056546413051, 318665857834031151167461, 561 * 2**64 + 1,
+                  (2**61 - 1) * (2**89 - 1), 6763 * 10627 * 29947,
+                  (2**127 - 1) * (2**107 - 1)):
+            self.assertEqual(lib.bigint_probab_prime(to_bigint(n), 25), 0, n)
+        for n in (2**61 - 1, 2**89 - 1, 2**127 - 1, 2**255 - 19, 2**256 - 2**32 - 977):
+            self.assertEqual(lib.bigint_probab_prime(to_bigint(n), 25), 1, n)
+            self.assertEqual(lib.bigint_probab_prime(to_bigint(n * (2**64 + 13)), 30), 0, n)
+        for n, gap in ((2**64, 13), (2**127 - 2, 1), (2**128, 51), (2**256, 297)):
+            lib.bigint_next_prime(to_bigint(n), res)
+            self.assertEqual(from_bigint(res), n + gap)
+
+    def test_root(self):
+        def iroot(a, k):
+            x = 1 << -(-a.bit_length() // k)
+            while True:
+                y = ((k - 1) * x + a // x**(k - 1)) // k
+                if y >= x:
+                    return x
+                x = y
+        s, r = lib.bigint_new_capacity(0), lib.bigint_new_capacity(0)
+        for i in range(TESTS):
+            a = rand(random.randint(1, 2048))
+            lib.bigint_sqrt_rem(to_bigint(a), s, r)
+            self.assertEqual(from_bigint(s), math.isqrt(a))
+            self.assertEqual(from_bigint(r), a - math.isqrt(a)**2)
+            self.assertEqual(lib.bigint_perfect_square(to_bigint(a)), math.isqrt(a)**2 == a)
+            self.assertTrue(lib.bigint_perfect_square(to_bigint(a * a)))
+            self.assertFalse(lib.bigint_perfect_square(to_bigint(a * a + 1 + random.randrange(2 * a + 1) % max(2 * a, 1))))
+            k = random.randint(1, 40)
+            lib.bigint_root(to_bigint(a), k, s)
+            self.assertEqual(from_bigint(s), iroot(a, k))
+            lib.bigint_root(to_bigint(-a), 2 * k + 1, s)
+            self.assertEqual(from_bigint(s), -iroot(a, 2 * k + 1))
+        lib.bigint_root(to_bigint(7**300), 300, s)
+        self.assertEqual(from_bigint(s), 7)
+        self.assertEqual(lib.bigint_sqrt_rem(to_bigint(-4), s, r), 3)
+
+    def test_product(self):
+        res = lib.bigint_new_capacity(0)
+        for i in range(TESTS):
+            nums = [rand(random.choice((8, 64, 2048))) * random.choice((-1, 1))
+                    for _ in range(random.randint(0, 200))]
+            lib.bigint_product(bigint_array(nums), len(nums), res)
+            self.assertEqual(from_bigint(res), math.prod(nums))
+            lib.bigint_product_parallel(bigint_array(nums), len(nums), res, 4)
+            self.assertEqual(from_bigint(res), math.prod(nums))
+        for n in (0, 1, 2, 20, 21, 1000, 5000):
+            lib.bigint_fac_ui(n, res)
+            self.assertEqual(from_bigint(res), math.factorial(n))
+            k = random.randint(0, n + 1)
+            lib.bigint_bin_ui(n, k, res)
+            self.assertEqual(from_bigint(res), math.comb(n, k))
+            lib.bigint_primorial_ui(n, res)
+            self.assertEqual(from_bigint(res), math.prod(p for p in range(2, n + 1)
+                if all(p % d for d in range(2, math.isqrt(p) + 1))))
+        # n + 1 sieve flags do not fit a size_t
+        self.assertEqual(lib.bigint_primorial_ui((1 << LIMB_SIZE_BITS) - 1, res), 2)
+
+    def test_remainder_tree(self):
+        for i in range(TESTS):
+            moduli = [rand(random.choice((8, 64, 300))) + 1 for _ in range(random.randint(1, 50))]
+            tree = SubproductTree()
+            self.assertEqual(lib.bigint_subproduct_tree_init(bigint_array(moduli), len(moduli),
+                ctypes.byref(tree)), 0)
+            x = rand(random.randint(1, 8000)) * random.choice((-1, 1))
+            out = [lib.bigint_new_capacity(0) for _ in moduli]
+            lib.bigint_remainder_tree(ctypes.byref(tree), to_bigint(x),
+                (ctypes.POINTER(Bigint) * len(out))(*out))
+            self.assertEqual([from_bigint(r) for r in out], [x % m for m in moduli])
+            lib.bigint_subproduct_tree_free(ctypes.byref(tree))
+        # nodes large enough for Barrett, x below and above the square of the root
+        moduli = [rand(random.choice((64, 300, 2000))) + 1 for _ in range(300)]
+        tree = SubproductTree()
+        self.assertEqual(lib.bigint_subproduct_tree_init(bigint_array(moduli), len(moduli),
+            ctypes.byref(tree)), 0)
+        root = from_bigint(ctypes.pointer(tree.nodes[0]))
+        self.assertEqual(from_bigint(ctypes.pointer(tree.reciprocals[0])), 4**root.bit_length() // root)
+        for x in (rand(2 * root.bit_length()), -rand(root.bit_length() + 100),
+                  rand(3 * root.bit_length())):
+            out = [lib.bigint_new_capacity(0) for _ in moduli]
+            lib.bigint_remainder_tree(ctypes.byref(tree), to_bigint(x),
+                (ctypes.POINTER(Bigint) * len(out))(*out))
+            self.assertEqual([from_bigint(r) for r in out], [x % m for m in moduli])
+        lib.bigint_subproduct_tree_free(ctypes.byref(tree))
+
+    def test_rns(self):
+        primes = [2**64 - 59, 2**64 - 83, 2**64 - 95, 2**64 - 179, 2**64 - 189, 2**64 - 257,
+                  2**63 - 25, 2**62 - 57, 2**61 - 1, 1000003, 65537, 257, 3, 2]
+        for i in range(TESTS):
+            moduli = random.sample(primes, random.randint(1, len(primes)))
+            M = math.prod(moduli)
+            rns = Rns()
+            self.assertEqual(lib.bigint_rns_init((Limb * len(moduli))(*moduli), len(moduli),
+                ctypes.byref(rns)), 0)
+            a, b = random.randrange(M), random.randrange(M)
+            ra, rb, rc = [(Limb * len(moduli))() for _ in range(3)]
+            lib.bigint_rns_from(ctypes.byref(rns), to_bigint(a), ra)
+            lib.bigint_rns_from(ctypes.byref(rns), to_bigint(b - M), rb)
+            self.assertEqual(list(ra), [a % m for m in moduli])
+            self.assertEqual(list(rb), [b % m for m in moduli])
+            res = lib.bigint_new_capacity(0)
+            lib.bigint_rns_to(ctypes.byref(rns), ra, res)
+            self.assertEqual(from_bigint(res), a)
+            for op, python_op in ((lib.bigint_rns_add, lambda x, y: x + y),
+                                  (lib.bigint_rns_sub, lambda x, y: x - y),
+                                  (lib.bigint_rns_mul, lambda x, y: x * y)):
+                op(ctypes.byref(rns), ra, rb, rc)
+                lib.bigint_rns_to(ctypes.byref(rns), rc, res)
+                self.assertEqual(from_bigint(res), python_op(a, b) % M)
+            lib.bigint_rns_free(ctypes.byref(rns))
+        self.assertEqual(lib.bigint_rns_init((Limb * 3)(15, 7, 6), 3, ctypes.byref(Rns())), 5)
+        # enough moduli for reciprocals of the squared nodes in the CRT weights
+        moduli = []
+        while len(moduli) < 300:
+            m = rand(LIMB_SIZE_BITS) | 1
+            if all(math.gcd(m, other) == 1 for other in moduli):
+                moduli.append(m)
+        M = math.prod(moduli)
+        rns = Rns()
+        self.assertEqual(lib.bigint_rns_init((Limb * len(moduli))(*moduli), len(moduli),
+            ctypes.byref(rns)), 0)
+        a = random.randrange(M)
+        ra = (Limb * len(moduli))()
+        lib.bigint_rns_from(ctypes.byref(rns), to_bigint(a), ra)
+        self.assertEqual(list(ra), [a % m for m in moduli])
+        res = lib.bigint_new_capacity(0)
+        lib.bigint_rns_to(ctypes.byref(rns), ra, res)
+        self.assertEqual(from_bigint(res), a)
+        lib.bigint_rns_free(ctypes.byref(rns))
+
+    def test_file(self):
+        nums = [0, -0, 1, -1, 2**64, -(2**64 - 1)]
+        nums += [rand(random.randint(1, 5000)) * random.choice((-1, 1)) for _ in range(TESTS)]
+        with tempfile.TemporaryDirectory() as tmp:
+            path = os.path.join(tmp, "values.bin").encode()
+            w = FileWriter()
+            self.assertEqual(lib.bigint_file_writer_open(path, 0, ctypes.byref(w)), 0)
+            for num in nums:
+                self.assertEqual(lib.bigint_file_writer_append(ctypes.byref(w), to_bigint(num)), 0)
+            self.assertEqual(lib.bigint_file_writer_close(ctypes.byref(w)), 0)
+            f = BigintFile()
+            self.assertEqual(lib.bigint_file_open(path, ctypes.byref(f)), 0)
+            self.assertEqual(f.count, len(nums))
+            view, res = Bigint(), lib.bigint_new_capacity(0)
+            for i, num in enumerate(nums):
+                self.assertEqual(lib.bigint_file_view(ctypes.byref(f), i, ctypes.byref(view)), 0)
+                self.assertEqual(view.capacity, 0)
+                self.assertEqual(from_bigint(ctypes.byref(view)), num)
+                self.assertEqual(lib.bigint_file_get(ctypes.byref(f), i, res), 0)
+                self.assertEqual(from_bigint(res), num)
+            self.assertEqual(lib.bigint_file_get(ctypes.byref(f), len(nums), res), 6)
+            lib.bigint_file_close(ctypes.byref(f))
+
+            # explicit byte orders, the one that is not the host's only
+            # readable through a copy
+            for order, fmt in ((1, "<I"), (2, ">I")):
+                self.assertEqual(lib.bigint_file_writer_open(path, order, ctypes.byref(w)), 0)
+                for num in nums:
+                    self.assertEqual(lib.bigint_file_writer_append(ctypes.byref(w), to_bigint(num)), 0)
+                self.assertEqual(lib.bigint_file_writer_close(ctypes.byref(w)), 0)
+                with open(path, "rb") as written:
+                    self.assertEqual(written.read(4), struct.pack(fmt, 0x46494742))
+                self.assertEqual(lib.bigint_file_open(path, ctypes.byref(f)), 0)
+                native = (fmt[0] == "<") == (sys.byteorder == "little")
+                self.assertEqual(lib.bigint_file_view(ctypes.byref(f), 0,
+                    ctypes.byref(view)), 0 if native else 3)
+                for i, num in enumerate(nums):
+                    self.assertEqual(lib.bigint_file_get(ctypes.byref(f), i, res), 0)
+                    self.assertEqual(from_bigint(res), num)
+                lib.bigint_file_close(ctypes.byref(f))
+
+            # big endian 32-bit limbs, only readable through a copy
+            payload, index = b"", b""
+            for num in nums:
+                limbs = []
+                while abs(num) >> (32 * len(limbs)):
+                    limbs.append(abs(num) >> (32 * len(limbs)) & 0xffffffff)
+                index += struct.pack(">QQ", 32 + len(payload), len(limbs) | (num < 0) << 63)
+                payload += b"".join(struct.pack(">I", limb) for limb in limbs)
+            payload += bytes(-len(payload) % 8)
+            header = struct.pack(">IIIIQQ", 0x46494742, 1, 4, 0, len(nums), 32 + len(payload))
+            foreign = os.path.join(tmp, "foreign.bin").encode()
+            with open(foreign, "wb") as out:
+                out.write(header + payload + index)
+            self.assertEqual(lib.bigint_file_open(foreign, ctypes.byref(f)), 0)
+            self.assertEqual(lib.bigint_file_view(ctypes.byref(f), 0, ctypes.byref(view)), 3)
+            for i, num in enumerate(nums):
+                self.assertEqual(lib.bigint_file_get(ctypes.byref(f), i, res), 0)
+                self.assertEqual(from_bigint(res), num)
+            lib.bigint_file_close(ctypes.byref(f))
+
+            with open(foreign, "r+b") as out:
+                out.truncate(len(header + payload + index) - 8)
+            self.assertEqual(lib.bigint_file_open(foreign, ctypes.byref(f)), 6)
+            lib.bigint_file_writer_open(path, 0, ctypes.byref(w))
+            lib.bigint_file_writer_append(ctypes.byref(w), to_bigint(5))
+            lib.fflush(ctypes.c_void_p(w.fp))
+            self.assertEqual(lib.bigint_file_open(path, ctypes.byref(f)), 6)
+            self.assertEqual(lib.bigint_file_writer_close(ctypes.byref(w)), 0)
+            self.assertEqual(lib.bigint_file_open(os.path.join(tmp, "missing").encode(),
+                ctypes.byref(f)), 7)
+
+            # entries a view would hand out unnormalized: a zero top limb, -0
+            for entry in ((32, 2), (32, 1 << 63)):
+                crafted = os.path.join(tmp, "crafted.bin").encode()
+                with open(crafted, "wb") as out:
+                    out.write(struct.pack("=IIIIQQ", 0x46494742, 1, 8, 0, 1, 48))
+                    out.write(struct.pack("=QQ", 5, 0) + struct.pack("=QQ", *entry))
+                self.assertEqual(lib.bigint_file_open(crafted, ctypes.byref(f)), 0)
+                self.assertEqual(lib.bigint_file_view(ctypes.byref(f), 0, ctypes.byref(view)), 6)
+                self.assertEqual(lib.bigint_file_get(ctypes.byref(f), 0, res), 6)
+                lib.bigint_file_close(ctypes.byref(f))
+
+        # a short write poisons the writer, later offsets would be wrong
+        if os.path.exists("/dev/full"):
+            self.assertEqual(lib.bigint_file_writer_open(b"/dev/full", 2, ctypes.byref(w)), 0)
+            self.assertEqual(lib.bigint_file_writer_append(ctypes.byref(w),
+                to_bigint(rand(1 << 20))), 7)
+            self.assertEqual(lib.bigint_file_writer_append(ctypes.byref(w), to_bigint(1)), 7)
+            self.assertEqual(lib.bigint_file_writer_close(ctypes.byref(w)), 7)
+
+    def test_montgomery_lanes(self):
+        for n in (0, 1, 3, 4, 5, 9, TESTS):
+            sizes = [random.choice((LIMB_SIZE_BITS - 3, 32, 33, 256, 521, 1024, 2048)) for _ in range(n)]
+            moduli = [rand(bits) | (1 << (bits - 1)) | 1 for bits in sizes]
+            moduli[:1] = [1] if n == 9 else moduli[:1]
+            ms = [montgomery(modulus) for modulus in moduli]
+            ms_array = (ctypes.POINTER(Montgomery) * n)(*map(ctypes.pointer, ms))
+            R = [1 << modulus.bit_length() for modulus in moduli]
+            xs = [rand(bits) % modulus for bits, modulus in zip(sizes, moduli)]
+            ys = [rand(bits + 5) for bits in sizes]
+            out = [lib.bigint_new_capacity(0) for _ in range(n)]
+            out_array = (ctypes.POINTER(Bigint) * n)(*out)
+            self.assertEqual(lib.bigint_montgomery_mul_lanes(ms_array, bigint_array(xs),
+                bigint_array(ys), out_array, n), 0)
+            self.assertEqual([from_bigint(r) for r in out],
+                [x * y * pow(r, -1, m) % m for x, y, r, m in zip(xs, ys, R, moduli)])
+            es = [rand(random.randint(0, 300)) for _ in range(n)]
+            self.assertEqual(lib.bigint_montgomery_exp_lanes(ms_array, bigint_array(ys),
+                bigint_array(es), out_array, n), 0)
+            self.assertEqual([from_bigint(r) for r in out],
+                [pow(y, e, m) for y, e, m in zip(ys, es, moduli)])
+        self.assertEqual(lib.bigint_montgomery_exp_lanes(ms_array, bigint_array(ys),
+            bigint_array([-1] * n), out_array, n), 3)
+
+    def test_montgomery_acc(self):
+        for bits in (LIMB_SIZE_BITS - 3, 256, 1024):
+            modulus = rand(bits) | (1 << (bits - 1)) | 1
+            m = montgomery(modulus)
+            R = 1 << modulus.bit_length()
+            acc = MontgomeryAcc()
+            self.assertEqual(lib.bigint_montgomery_acc_init(ctypes.byref(m), ctypes.byref(acc)), 0)
+            res = lib.bigint_new_capacity(0)
+            for max_terms in (acc.max_terms, 3, 1):
+                acc.max_terms = max_terms
+                for n in (0, 1, 2, TESTS):
+                    xs = [rand(bits) % modulus for i in range(n)]
+                    ys = [rand(bits) % modulus for i in range(n)]
+                    for x, y in zip(xs, ys):
+                        lib.bigint_montgomery_acc_addmul(ctypes.byref(acc),
+                            to_bigint(x * R % modulus), to_bigint(y * R % modulus))
+                    lib.bigint_montgomery_acc_finish(ctypes.byref(acc), res)
+                    expected = sum(x * y for x, y in zip(xs, ys)) * R % modulus
+                    self.assertEqual(from_bigint(res), expected)
+            lib.bigint_montgomery_acc_free(ctypes.byref(acc))
+
+    def test_comba(self):
+        res = lib.bigint_new_capacity(0)
+        for limbs in range(1, 20):
+            for i in range(TESTS):
+                bits = random.randint(LIMB_SIZE_BITS * (limbs - 1) + 1, LIMB_SIZE_BITS * limbs)
+                a, b = rand(bits) | 1 << (bits - 1), rand(bits) | 1 << (bits - 1)
+                lib.bigint_mul_classic(to_bigint(a), to_bigint(b), res)
+                self.assertEqual(from_bigint(res), a * b)
+                x = to_bigint(a)
+                lib.bigint_mul(x, x, res)
+                self.assertEqual(from_bigint(res), a * a)
+                modulus = b | 1
+                m = montgomery(modulus)
+                R = 1 << modulus.bit_length()
+                x, y = a % modulus, rand(bits) % modulus
+                lib.bigint_montgomery_mul(ctypes.byref(m), to_bigint(x), to_bigint(y), res)
+                self.assertEqual(from_bigint(res), x * y * pow(R, -1, modulus) % modulus)
+                lib.bigint_montgomery_mul(ctypes.byref(m), to_bigint(a), to_bigint(modulus + y), res)
+                self.assertEqual(from_bigint(res), a * y * pow(R, -1, modulus) % modulus)
+                lib.bigint_montgomery_reduce(ctypes.byref(m), to_bigint(a * b * 5), res)
+                self.assertEqual(from_bigint(res), a * b * 5 * pow(R, -1, modulus) % modulus)
+
+    def test_stats(self):
+        stats = Stats()
+        self.assertEqual(lib.bigint_stats_snapshot(ctypes.byref(stats)), 3)
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, "bigint_stats.so")
+            sources = sorted(f for f in os.listdir(".")
+                if f.endswith(".c") and (f.startswith("bigint") or f == "utils.c"))
+            subprocess.run(["cc", "-shared", "-fPIC", "-pthread", "-DBIGINT_THREADS",
+                "-DBIGINT_STATS", "-std=c99", "-g", *sources, "-o", path], check=True)
+            stats_lib = ctypes.CDLL(path)
+        stats_lib.bigint_new_capacity.restype = ctypes.POINTER(Bigint)
+        stats_lib.bigint_set_hex.argtypes = [ctypes.c_char_p, ctypes.POINTER(Bigint)]
+        def big(num):
+            bigint = stats_lib.bigint_new_capacity(0)
+            stats_lib.bigint_set_hex(prepare_buffer(num), bigint)
+            return bigint
+
+        a, b, m = big(rand(8192) | 1 << 8191), big(rand(4096) | 1 << 4095), big(rand(512) | 1)
+        self.assertEqual(stats_lib.bigint_stats_reset(), 0)
+        result = stats_lib.bigint_new_capacity(0)
+        q = stats_lib.bigint_new_capacity(0)
+        stats_lib.bigint_mul(a, a, result)
+        stats_lib.bigint_mul(a, m, result)
+        stats_lib.bigint_mul(m, m, result)
+        stats_lib.bigint_div(a, b, q, result)
+        mont = Montgomery()
+        stats_lib.bigint_montgomery_init(m, ctypes.byref(mont))
+        stats_lib.bigint_div(a, m, q, result)
+        stats_lib.bigint_montgomery_mul(ctypes.byref(mont), result, result, result)
+        # a thread that exits keeps its counts in the snapshot
+        thread = threading.Thread(target=stats_lib.bigint_mul, args=(b, b, result))
+        thread.start()
+        thread.join()
+
+        self.assertEqual(stats_lib.bigint_stats_snapshot(ctypes.byref(stats)), 0)
+        ops = dict(zip(STATS_OPS, stats.ops))
+        self.assertEqual(ops["mul_karatsuba"].sizes[8], 1)
+        self.assertEqual(ops["mul_karatsuba"].sizes[7], 4)
+        self.assertGreater(ops["mul_karatsuba"].ns, 0)
+        self.assertEqual(stats.karatsuba_max_depth, 2)
+        # a m, and the 32 limb leaves of a a and b b
+        self.assertEqual(ops["mul_classic"].calls, 1 + 9 + 3)
+        self.assertGreater(ops["mul_comba"].calls, 0)
+        self.assertEqual(ops["div"].calls, 3)
+        self.assertEqual(ops["montgomery_mul"].calls, 1)
+        self.assertEqual(ops["montgomery_mul"].sizes[4], 1)
+        self.assertGreater(stats.allocations, 0)
+        self.assertGreater(stats.bytes, 0)
+        self.assertEqual(stats_lib.bigint_stats_reset(), 0)
+        stats_lib.bigint_stats_snapshot(ctypes.byref(stats))
+        self.assertEqual(stats.allocations, 0)
+        self.assertEqual(ops["div"].calls, 0)
+
+    def test_python_extension(self):
+        with tempfile.TemporaryDirectory() as directory:
+            subprocess.run([sys.executable, "setup.py", "-q", "build_ext",
+                "--build-lib", directory, "--build-temp", os.path.join(directory, "tmp")],
+                check=True, capture_output=True)
+            sys.path.insert(0, directory)
+            try:
+                ext = importlib.import_module("bigint_ext")
+            finally:
+                sys.path.remove(directory)
+        for bits in (1, LIMB_SIZE_BITS, 200, BITS_A):
+            a = rand(bits) * random.choice((1, -1))
+            b = (rand(bits) or 1) * random.choice((1, -1))
+            self.assertEqual(ext.add(a, b), a + b)
+            self.assertEqual(ext.sub(a, b), a - b)
+            self.assertEqual(ext.mul(a, b), a * b)
+            self.assertEqual(ext.divmod(a, b), divmod(a, b))
+            self.assertEqual(ext.isqrt(abs(a)), math.isqrt(abs(a)))
+            self.assertEqual(int.from_bytes(ext.limbs(a), "little"), abs(a))
+            self.assertEqual(ext.add(abs(a).to_bytes(bits // 8 + 1, "little"), 0), abs(a))
+            m = rand(bits) | 3
+            e = rand(256)
+            self.assertEqual(ext.powmod(a, e, m), pow(a, e, m))
+        xs = [rand(BITS_A) for i in range(10)]
+        ys = [rand(BITS_B) for i in range(10)]
+        self.assertEqual(ext.mul_many(xs, ys), [x * y for x, y in zip(xs, ys)])
+        self.assertEqual(ext.product(xs + [-1]), -math.prod(xs))
+        m = 2**521 - 1
+        es = [rand(200) for i in range(10)]
+        self.assertEqual(ext.powmod_many(xs, es, m), [pow(x, e, m) for x, e in zip(xs, es)])
+        self.assertEqual(ext.next_prime(2**127 - 2), 2**127 - 1)
+        self.assertEqual(ext.is_prime(2**127 + 1), 0)
+        self.assertRaises(ZeroDivisionError, ext.divmod, 1, 0)
+        self.assertRaises(ValueError, ext.powmod, 2, 3, 4)
+        self.assertRaises(ValueError, ext.powmod, 2, -1, 7)
+        self.assertRaises(ValueError, ext.mul_many, [1], [1, 2])
+        self.assertRaises(TypeError, ext.add, "1", 2)
+
+    @unittest.skipIf(shutil.which("c++") is None, "no C++ compiler")
+    def test_cpp_wrapper(self):
+        with tempfile.TemporaryDirectory() as directory:
+            binary = os.path.join(directory, "test_cpp")
+            subprocess.run(["c++", "-std=c++11", "-Wall", "-Wextra", "-Werror", "-g",
+                "test.cpp", "./bigint.so", "-Wl,-rpath," + os.getcwd(), "-o", binary],
+                check=True)
+            self.assertEqual(subprocess.run([binary], capture_output=True).stdout, b"ok\n")
+
 if __name__ == '__main__':
     unittest.main()